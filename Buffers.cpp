@@ -11,7 +11,11 @@
 ///
 
 #include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
@@ -21,18 +25,31 @@
 // GLEW and GLFW header files also pull in the OpenGL definitions
 //
 
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
 #ifndef __APPLE__
 #include <GL/glew.h>
 #endif
 
 #include <GLFW/glfw3.h>
+#endif
 
 #include "Buffers.h"
+#include "GeometryArena.h"
+#include "GLState.h"
+#include "MeshCache.h"
+
+// GL calls issued by selectBuffers()
+long BufferSet::selectCalls = 0;
 
 ///
 // Constructor
+//
+// @param layout - how createBuffers() should organize vertex data
 ///
-BufferSet::BufferSet( void ) {
+BufferSet::BufferSet( int layout ) : layout(layout), arena(NULL) {
     // do this the easy way
     initBuffer();
 }
@@ -42,9 +59,24 @@ BufferSet::BufferSet( void ) {
 ///
 void BufferSet::initBuffer( void ) {
     vbuffer = ebuffer = 0;
-    numElements = 0;
+    numElements = numVertices = 0;
     vSize = eSize = tSize = cSize = nSize = 0;
+    stride = 0;
     bufferInit = false;
+    handle = -1;
+    for( int i = 0; i < 3; ++i ) {
+        boxMin[i] = boxMax[i] = center[i] = 0.0f;
+    }
+    radius = 0.0f;
+    posScale = 1.0f;
+    posBias[0] = posBias[1] = posBias[2] = 0.0f;
+    quantError.position = quantError.normal = quantError.uv = 0.0f;
+    uvHalf = false;
+    vector<float>().swap( points );
+    vector<float>().swap( normals );
+    vector<float>().swap( uv );
+    vector<float>().swap( colors );
+    vector<GLuint>().swap( indices );
 }
 
 ///
@@ -59,9 +91,17 @@ void BufferSet::dumpBuffer( const char *which ) {
     }
     cout << "initialized)" << endl;
     cout << "  IDs: v " << vbuffer << " e " << ebuffer <<
-        " #elements: " << numElements << endl;
+        " #elements: " << numElements << " #vertices: " << numVertices << endl;
     cout << "  Sizes:  v " << vSize << " e " << eSize <<
         " t " << tSize << " c " << cSize << " n " << nSize << endl;
+    static const char *layouts[] = {
+        "planar", "interleaved", "quantized", "quantized (half)"
+    };
+    cout << "  Layout: " << layouts[layout] << ", stride " << stride << endl;
+    if( handle >= 0 ) {
+        cout << "  Arena:  base vertex " << baseVertex() <<
+            " first index " << arena->mesh( handle ).firstIndex << endl;
+    }
 }
 
 ///
@@ -77,29 +117,279 @@ GLuint BufferSet::makeBuffer( GLenum target, const void *data, GLsizei size ) {
     GLuint buffer;
 
     glGenBuffers( 1, &buffer );
-    glBindBuffer( target, buffer );
+    stBindBuffer( target, buffer );
     glBufferData( target, size, data, GL_STATIC_DRAW );
 
     return( buffer );
 }
 
+///
+// Pack a normal, normalized, into GL_INT_2_10_10_10_REV format
+///
+static GLuint packNormal( const float *n )
+{
+    float len = sqrtf( n[0] * n[0] + n[1] * n[1] + n[2] * n[2] );
+    float scale = len > 0.0f ? 511.0f / len : 0.0f;
+    GLuint packed = 0;
+
+    for( int i = 0; i < 3; ++i ) {
+        int v = (int) lrintf( n[i] * scale );
+        packed |= ((GLuint) v & 0x3ff) << (10 * i);
+    }
+
+    return packed;
+}
+
+///
+// Unpack a GL_INT_2_10_10_10_REV normal, as the GL does
+///
+static void unpackNormal( GLuint packed, float *n )
+{
+    for( int i = 0; i < 3; ++i ) {
+        int v = (int) ((packed >> (10 * i)) & 0x3ff);
+        if( v >= 512 ) {
+            v -= 1024;
+        }
+        n[i] = v < -511 ? -1.0f : v / 511.0f;
+    }
+}
+
+///
+// Convert a float to a half float (rounding to nearest, ties to even;
+// anything too large becomes infinity)
+///
+static GLushort toHalf( float f )
+{
+    GLuint x;
+    memcpy( &x, &f, sizeof(x) );
+
+    GLuint sign = (x >> 16) & 0x8000;
+    int e = (int) ((x >> 23) & 0xff) - 127 + 15;
+    GLuint m = x & 0x7fffff;
+
+    if( e >= 31 ) {
+        return (GLushort) (sign | 0x7c00);
+    }
+
+    // too small for a normal half float:  a denormal, or zero
+    int shift = 13;
+    if( e <= 0 ) {
+        if( e < -10 ) {
+            return (GLushort) sign;
+        }
+        m |= 0x800000;
+        shift = 14 - e;
+        e = 0;
+    }
+
+    GLuint h = ((GLuint) e << 10) + (m >> shift);
+    GLuint rest = m & ((1u << shift) - 1), halfway = 1u << (shift - 1);
+    if( rest > halfway || (rest == halfway && (h & 1)) ) {
+        ++h;    // (a carry into the exponent is still right)
+    }
+
+    return (GLushort) (sign | h);
+}
+
+///
+// Convert a half float back to a float
+///
+static float fromHalf( GLushort h )
+{
+    int e = (h >> 10) & 0x1f;
+    int m = h & 0x3ff;
+    float v;
+
+    if( e == 0 ) {
+        v = ldexpf( (float) m, -24 );
+    } else if( e == 31 ) {
+        v = HUGE_VALF;
+    } else {
+        v = ldexpf( (float) (m | 0x400), e - 25 );
+    }
+
+    return (h & 0x8000) ? -v : v;
+}
+
+///
+// Convert to and from normalized shorts and unsigned shorts, as the GL
+// does
+///
+static GLshort toSnorm16( float f )
+{
+    f = f < -1.0f ? -1.0f : (f > 1.0f ? 1.0f : f);
+    return (GLshort) lrintf( f * 32767.0f );
+}
+
+static float fromSnorm16( GLshort s )
+{
+    return s < -32767 ? -1.0f : s / 32767.0f;
+}
+
+static GLushort toUnorm16( float f )
+{
+    f = f < 0.0f ? 0.0f : (f > 1.0f ? 1.0f : f);
+    return (GLushort) lrintf( f * 65535.0f );
+}
+
+static float fromUnorm16( GLushort u )
+{
+    return u / 65535.0f;
+}
+
+///
+// Pack an RGBA color into four normalized unsigned bytes
+///
+static void packColor( const float *c, unsigned char *dst )
+{
+    for( int i = 0; i < 4; ++i ) {
+        float v = c[i] < 0.0f ? 0.0f : (c[i] > 1.0f ? 1.0f : c[i]);
+        dst[i] = (unsigned char) lrintf( v * 255.0f );
+    }
+}
+
 ///
 // createBuffers(buf,canvas) create a set of buffers for the object
 //     currently held in 'canvas'.
 //
-// @param C   - the Canvas we'll use for drawing
+// @param C    - the Canvas we'll use for drawing
+// @param keep - if true, move the Canvas's vertex data into this
+//               BufferSet (leaving the Canvas empty)
 ///
-void BufferSet::createBuffers( Canvas &C ) {
+void BufferSet::createBuffers( Canvas &C, bool keep ) {
 
     // reset this BufferSet if it has already been used
+    reset();
+
+    // get the vertex and element counts (these differ once the
+    // Canvas has been welded)
+    numVertices = C.numVertices();
+    numElements = C.numIndices();
+
+    // if there are no vertices, there's nothing for us to do
+    if( numVertices < 1 ) {
+        return;
+    }
+
+    // OK, we have vertices!  We look at the Canvas's own arrays
+    // rather than copies of them; the only copy made is the upload
+    AttribView pts = C.viewVertices();
+    AttribView cols = C.viewColors();
+    AttribView norms = C.viewNormals();
+    AttribView tex = C.viewUV();
+
+    computeBounds( pts );
+
+    // get the element data
+    GLuint *elements = C.getElements();
+
+    // the indices aren't the Canvas's to hand over, so they're copied
+    if( keep ) {
+        indices.assign( elements, elements + numElements );
+    }
+
+    upload( pts, cols, norms, tex, elements, NULL );
+
+    // NOTE:  'elements' is dynamically allocated, but we don't free it
+    // here because it will be freed at the next call to clear() or
+    // getElements()
+
+    // hand the vertex data over if we were asked to keep it
+    if( keep ) {
+        C.moveData( points, normals, uv, colors );
+    }
+
+    // finally, mark it as set up
+    bufferInit = true;
+}
+
+///
+// createBuffers(buf,file) create a set of buffers for the mesh in
+//     an open mesh file
+//
+// @param F    - the file
+// @param keep - if true, copy the vertex data and indices into this
+//               BufferSet
+///
+void BufferSet::createBuffers( const MeshFile &F, bool keep ) {
+
+    reset();
+
+    numVertices = F.numVertices();
+    numElements = F.numIndices();
+
+    if( numVertices < 1 ) {
+        return;
+    }
+
+    // the file has the bounds already
+    const MeshFileHeader &h = F.header();
+    for( int i = 0; i < 3; ++i ) {
+        boxMin[i] = h.boxMin[i];
+        boxMax[i] = h.boxMax[i];
+        center[i] = h.center[i];
+    }
+    radius = h.radius;
+
+    if( keep ) {
+        indices.assign( F.indices(), F.indices() + numElements );
+        AttribView views[4] = { F.positions(), F.normals(), F.uv(),
+            F.colors() };
+        vector<float> *dst[4] = { &points, &normals, &uv, &colors };
+        for( int i = 0; i < 4; ++i ) {
+            if( views[i].data != NULL ) {
+                dst[i]->assign( views[i].data,
+                    views[i].data + views[i].count );
+            }
+        }
+    }
+
+    // its vertex block is laid out just as a planar vertex buffer is
+    upload( F.positions(), F.colors(), F.normals(), F.uv(), F.indices(),
+        F.vertexBlock() );
+
+    bufferInit = true;
+}
+
+///
+// reset() - delete this BufferSet's buffers (or give its space back
+//     to the arena), and the vertex arrays that refer to them, and
+//     start afresh
+///
+void BufferSet::reset( void ) {
+
     if( bufferInit ) {
-        // must delete the existing buffer IDs first
-        glDeleteBuffers( 1, &(vbuffer) );
-        glDeleteBuffers( 1, &(ebuffer) );
+        if( handle >= 0 ) {
+            arena->release( handle );
+        } else {
+            stDeleteBuffers( 1, &(vbuffer) );
+            stDeleteBuffers( 1, &(ebuffer) );
+        }
+        deleteArrays();
         // clear everything out
         initBuffer();
     }
 
+    // don't let the element buffer binding made by upload() land in
+    // whatever vertex array object happens to be bound
+    stBindVertexArray( 0 );
+}
+
+///
+// upload() - create the buffers (or the space in the arena) for the
+//     vertex data and indices, in this BufferSet's layout
+//
+// @param pts      - vertex locations (XYZW)
+// @param cols     - colors (RGBA), if any
+// @param norms    - normals (XYZ), if any
+// @param tex      - texture coordinates (UV), if any
+// @param elements - the indices
+// @param planar   - all of the above, already laid out as a planar
+//                   vertex buffer is (see below), or NULL
+///
+void BufferSet::upload( AttribView pts, AttribView cols, AttribView norms,
+    AttribView tex, const GLuint *elements, const void *planar ) {
+
     ///
     // vertex buffer structure
     //
@@ -112,59 +402,74 @@ void BufferSet::createBuffers( Canvas &C ) {
     //          [ colors    ]  RGBA         vSize
     //          [ normals   ]  XYZ          vSize+cSize
     //          [ t. coords ]  UV           vSize+cSize+nSize
+    //
+    // or, with LAYOUT_INTERLEAVED, one packed record per vertex
+    //
+    //          [ XYZ | RGBA | normal | UV ] [ XYZ | ...
+    //            12     4      4       8    bytes
     ///
 
-    // get the vertex count
-    numElements = C.numVertices();
-
-    // if there are no vertices, there's nothing for us to do
-    if( numElements < 1 ) {
-        return;
-    }
-
-    // OK, we have vertices!
-    float *points = C.getVertices();
-    // #bytes = number of elements * 4 floats/element * bytes/float
-    vSize = numElements * 4 * sizeof(float);
+    // #bytes = number of vertices * 4 floats/vertex * bytes/float
+    vSize = numVertices * 4 * sizeof(float);
 
     // accumulate the total vertex buffer size
     GLsizeiptr vbufSize = vSize;
 
     // get the color data (if there is any)
-    float *colors = C.getColors();
-    if( colors != NULL ) {
-        cSize = numElements * 4 * sizeof(float);
+    if( cols.data != NULL ) {
+        cSize = numVertices * 4 * sizeof(float);
         vbufSize += cSize;
     }
 
     // get the normal data (if there is any)
-    float *normals = C.getNormals();
-    if( normals != NULL ) {
-        nSize = numElements * 3 * sizeof(float);
+    if( norms.data != NULL ) {
+        nSize = numVertices * 3 * sizeof(float);
         vbufSize += nSize;
     }
 
     // get the (u,v) data (if there is any)
-    float *uv = C.getUV();
-    if( uv != NULL ) {
-        tSize = numElements * 2 * sizeof(float);
+    if( tex.data != NULL ) {
+        tSize = numVertices * 2 * sizeof(float);
         vbufSize += tSize;
     }
 
-    // get the element data
-    GLuint *elements = C.getElements();
     // #bytes = number of elements * bytes/element
     eSize = numElements * sizeof(GLuint);
 
+    // a mesh in an arena just needs copying in
+    if( arena != NULL ) {
+        handle = arena->add( pts, norms, tex, elements, numElements );
+        vSize = nSize = numVertices * 3 * sizeof(float);
+        tSize = numVertices * 2 * sizeof(float);
+        cSize = 0;
+        stride = ARENA_STRIDE;
+        return;
+    }
+
     // first, create the connectivity data
     ebuffer = makeBuffer( GL_ELEMENT_ARRAY_BUFFER, elements, eSize );
 
+    if( layout != LAYOUT_PLANAR ) {
+        if( layout == LAYOUT_INTERLEAVED ) {
+            createInterleaved( pts, cols, norms, tex );
+        } else {
+            createQuantized( pts, cols, norms, tex );
+        }
+        return;
+    }
+
+    // data which is already in one block goes up in one call
+    if( planar != NULL ) {
+        vbuffer = makeBuffer( GL_ARRAY_BUFFER, planar, vbufSize );
+        return;
+    }
+
     // next, the vertex buffer, containing vertices and "extra" data
     // note that we use glBufferSubData() calls to do the copying
     vbuffer = makeBuffer( GL_ARRAY_BUFFER, NULL, vbufSize );
 
     // copy in the location data
-    glBufferSubData( GL_ARRAY_BUFFER, 0, vSize, points );
+    glBufferSubData( GL_ARRAY_BUFFER, 0, vSize, pts.data );
 
     // offsets to subsequent sections are the sum of
     // the preceding section sizes (in bytes)
@@ -172,19 +477,19 @@ void BufferSet::createBuffers( Canvas &C ) {
 
     // add in the color data (if there is any)
     if( cSize > 0 ) {
-        glBufferSubData( GL_ARRAY_BUFFER, offset, cSize, colors );
+        glBufferSubData( GL_ARRAY_BUFFER, offset, cSize, cols.data );
         offset += cSize;
     }
 
     // add in the normal data (if there is any)
     if( nSize > 0 ) {
-        glBufferSubData( GL_ARRAY_BUFFER, offset, nSize, normals );
+        glBufferSubData( GL_ARRAY_BUFFER, offset, nSize, norms.data );
         offset += nSize;
     }
 
     // add in the (u,v) data (if there is any)
     if( tSize > 0 ) {
-        glBufferSubData( GL_ARRAY_BUFFER, offset, tSize, uv );
+        glBufferSubData( GL_ARRAY_BUFFER, offset, tSize, tex.data );
         offset += tSize;
     }
 
@@ -193,13 +498,227 @@ void BufferSet::createBuffers( Canvas &C ) {
         cerr << "*** createBuffers: size mismatch, offset "
             << offset << " vbufSize " << vbufSize << endl;
     }
+}
 
-    // NOTE:  'points', 'colors', and 'elements' are dynamically allocated,
-    // but we don't free them here because they will be freed at the next
-    // call to clear() or the get*() functions
+///
+// computeBounds() - find the bounding box and sphere of the vertex
+//     locations (XYZW)
+///
+void BufferSet::computeBounds( AttribView pts ) {
 
-    // finally, mark it as set up
-    bufferInit = true;
+    for( int i = 0; i < 3; ++i ) {
+        boxMin[i] = boxMax[i] = pts.data[i];
+    }
+
+    for( size_t v = 0; v < pts.count; v += 4 ) {
+        for( int i = 0; i < 3; ++i ) {
+            if( pts.data[v+i] < boxMin[i] ) {
+                boxMin[i] = pts.data[v+i];
+            } else if( pts.data[v+i] > boxMax[i] ) {
+                boxMax[i] = pts.data[v+i];
+            }
+        }
+    }
+
+    for( int i = 0; i < 3; ++i ) {
+        center[i] = 0.5f * (boxMin[i] + boxMax[i]);
+    }
+
+    // the sphere is centered on the box, but only as large as the
+    // farthest vertex needs, which is usually less than the box's
+    float r2 = 0.0f;
+    for( size_t v = 0; v < pts.count; v += 4 ) {
+        float dx = pts.data[v]   - center[0];
+        float dy = pts.data[v+1] - center[1];
+        float dz = pts.data[v+2] - center[2];
+        float d2 = dx * dx + dy * dy + dz * dz;
+        if( d2 > r2 ) {
+            r2 = d2;
+        }
+    }
+    radius = sqrtf( r2 );
+}
+
+///
+// createInterleaved() - build and upload the packed, interleaved
+//     vertex buffer for createBuffers()
+//
+// @param pts   - vertex locations (XYZW)
+// @param cols  - colors (RGBA), if any
+// @param norms - normals (XYZ), if any
+// @param tex   - texture coordinates (UV), if any
+///
+void BufferSet::createInterleaved( AttribView pts, AttribView cols,
+    AttribView norms, AttribView tex ) {
+
+    // section sizes now describe the packed data
+    vSize = numVertices * 3 * sizeof(float);
+    cSize = cols.data != NULL ? numVertices * 4 : 0;
+    nSize = norms.data != NULL ? numVertices * sizeof(GLuint) : 0;
+    tSize = tex.data != NULL ? numVertices * 2 * sizeof(float) : 0;
+
+    stride = (GLsizei) ((vSize + cSize + nSize + tSize) / numVertices);
+
+    vector<unsigned char> data( (size_t) numVertices * stride );
+    unsigned char *dst = &data[0];
+
+    for( int i = 0; i < numVertices; ++i ) {
+        memcpy( dst, pts.data + 4 * i, 3 * sizeof(float) );
+        dst += 3 * sizeof(float);
+
+        if( cSize > 0 ) {
+            packColor( cols.data + 4 * i, dst );
+            dst += 4;
+        }
+
+        if( nSize > 0 ) {
+            GLuint n = packNormal( norms.data + 3 * i );
+            memcpy( dst, &n, sizeof(n) );
+            dst += sizeof(n);
+        }
+
+        if( tSize > 0 ) {
+            memcpy( dst, tex.data + 2 * i, 2 * sizeof(float) );
+            dst += 2 * sizeof(float);
+        }
+    }
+
+    // the whole thing goes up in one call
+    vbuffer = makeBuffer( GL_ARRAY_BUFFER, &data[0], (GLsizei) data.size() );
+}
+
+///
+// createQuantized() - build and upload the quantized, interleaved
+//     vertex buffer for createBuffers(), and measure its error
+//
+// @param pts   - vertex locations (XYZW)
+// @param cols  - colors (RGBA), if any
+// @param norms - normals (XYZ), if any
+// @param tex   - texture coordinates (UV), if any
+///
+void BufferSet::createQuantized( AttribView pts, AttribView cols,
+    AttribView norms, AttribView tex ) {
+
+    bool half = layout == LAYOUT_QUANTIZED_HALF;
+
+    // snorm16 locations fill [-1,1] along the box's longest side (one
+    // scale for all three, so that bounding spheres stay spheres)
+    if( !half ) {
+        posScale = 0.0f;
+        for( int i = 0; i < 3; ++i ) {
+            GLfloat extent = 0.5f * (boxMax[i] - boxMin[i]);
+            if( extent > posScale ) {
+                posScale = extent;
+            }
+            posBias[i] = center[i];
+        }
+        if( posScale <= 0.0f ) {
+            posScale = 1.0f;
+        }
+    }
+
+    // unorm16 only covers [0,1]; (u,v) outside that (for repeating
+    // textures) need half floats
+    uvHalf = false;
+    for( size_t i = 0; tex.data != NULL && i < tex.count; ++i ) {
+        if( tex.data[i] < 0.0f || tex.data[i] > 1.0f ) {
+            uvHalf = true;
+            break;
+        }
+    }
+
+    // section sizes now describe the packed data
+    vSize = numVertices * 4 * sizeof(GLushort);
+    cSize = cols.data != NULL ? numVertices * 4 : 0;
+    nSize = norms.data != NULL ? numVertices * sizeof(GLuint) : 0;
+    tSize = tex.data != NULL ? numVertices * 2 * sizeof(GLushort) : 0;
+
+    stride = (GLsizei) ((vSize + cSize + nSize + tSize) / numVertices);
+
+    vector<unsigned char> data( (size_t) numVertices * stride );
+    unsigned char *dst = &data[0];
+
+    quantError.position = quantError.normal = quantError.uv = 0.0f;
+
+    for( int i = 0; i < numVertices; ++i ) {
+
+        // the location, and how far off the GL will read it
+        const float *p = pts.data + 4 * i;
+        GLushort q[4];
+        float d2 = 0.0f;
+        for( int k = 0; k < 3; ++k ) {
+            float back;
+            if( half ) {
+                q[k] = toHalf( p[k] );
+                back = fromHalf( q[k] );
+            } else {
+                GLshort s = toSnorm16( (p[k] - posBias[k]) / posScale );
+                memcpy( &q[k], &s, sizeof(s) );
+                back = fromSnorm16( s ) * posScale + posBias[k];
+            }
+            d2 += (back - p[k]) * (back - p[k]);
+        }
+        q[3] = half ? 0x3c00 : 32767;
+        quantError.position = max( quantError.position, sqrtf(d2) );
+        memcpy( dst, q, sizeof(q) );
+        dst += sizeof(q);
+
+        if( cSize > 0 ) {
+            packColor( cols.data + 4 * i, dst );
+            dst += 4;
+        }
+
+        // the normal, and the angle it is turned through
+        if( nSize > 0 ) {
+            const float *n = norms.data + 3 * i;
+            GLuint packed = packNormal( n );
+            float m[3];
+            unpackNormal( packed, m );
+            float c[3] = { n[1] * m[2] - n[2] * m[1],
+                           n[2] * m[0] - n[0] * m[2],
+                           n[0] * m[1] - n[1] * m[0] };
+            float dot = n[0] * m[0] + n[1] * m[1] + n[2] * m[2];
+            float cross = sqrtf( c[0] * c[0] + c[1] * c[1] + c[2] * c[2] );
+            if( dot != 0.0f || cross != 0.0f ) {
+                float angle = atan2f( cross, dot ) * 57.2957795f;
+                quantError.normal = max( quantError.normal, angle );
+            }
+            memcpy( dst, &packed, sizeof(packed) );
+            dst += sizeof(packed);
+        }
+
+        if( tSize > 0 ) {
+            const float *t = tex.data + 2 * i;
+            GLushort u[2];
+            for( int k = 0; k < 2; ++k ) {
+                float back;
+                if( uvHalf ) {
+                    u[k] = toHalf( t[k] );
+                    back = fromHalf( u[k] );
+                } else {
+                    u[k] = toUnorm16( t[k] );
+                    back = fromUnorm16( u[k] );
+                }
+                quantError.uv = max( quantError.uv, fabsf(back - t[k]) );
+            }
+            memcpy( dst, u, sizeof(u) );
+            dst += sizeof(u);
+        }
+    }
+
+    // the whole thing goes up in one call
+    vbuffer = makeBuffer( GL_ARRAY_BUFFER, &data[0], (GLsizei) data.size() );
+}
+
+///
+// deleteArrays() - delete the vertex array objects built by
+//     selectBuffers()
+///
+void BufferSet::deleteArrays( void ) {
+    for( size_t i = 0; i < vaos.size(); ++i ) {
+        stDeleteVertexArrays( 1, &vaos[i].vao );
+    }
+    vaos.clear();
 }
 
 ///
@@ -214,17 +733,116 @@ void BufferSet::createBuffers( Canvas &C ) {
 void BufferSet::selectBuffers( GLuint program,
     const char *vp, const char *vc, const char *vn, const char *vt ) {
 
+    // meshes in an arena use the arena's vertex arrays
+    if( handle >= 0 ) {
+        selectCalls += arena->select( program, vp, vn, vt );
+        return;
+    }
+
+    // have we already built a vertex array for this combination?
+    for( size_t i = 0; i < vaos.size(); ++i ) {
+        const VaoEntry &e = vaos[i];
+        if( e.program == program && e.vp == vp && e.vc == vc &&
+            e.vn == vn && e.vt == vt ) {
+            stBindVertexArray( vaos[i].vao );
+            selectCalls += 1;
+            return;
+        }
+    }
+
+    // no - build one, recording the attribute setup in it
+    VaoEntry entry;
+    entry.program = program;
+    entry.vp = vp;
+    entry.vc = vc;
+    entry.vn = vn;
+    entry.vt = vt;
+    glGenVertexArrays( 1, &entry.vao );
+    stBindVertexArray( entry.vao );
+    selectCalls += 2;
+
+    setupArrays( program, vp, vc, vn, vt );
+
+    vaos.push_back( entry );
+}
+
+///
+// indexOffset(), firstIndex(), baseVertex() - where the mesh is in its
+//     buffers
+///
+const GLvoid *BufferSet::indexOffset( void ) const {
+    return BUFFER_OFFSET(firstIndex() * sizeof(GLuint));
+}
+
+GLuint BufferSet::firstIndex( void ) const {
+    return handle < 0 ? 0 : arena->mesh( handle ).firstIndex;
+}
+
+GLint BufferSet::baseVertex( void ) const {
+    return handle < 0 ? 0 : arena->mesh( handle ).baseVertex;
+}
+
+///
+// elementBuffer() - the element buffer the mesh is drawn from
+///
+GLuint BufferSet::elementBuffer( void ) const {
+    return handle < 0 ? ebuffer : arena->ebuffer;
+}
+
+///
+// positionTransform() - apply the scale and bias of the vertex
+//     locations to a model (or model-view) matrix
+//
+// @param model - the matrix, changed in place
+///
+void BufferSet::positionTransform( GLfloat *model ) const {
+
+    if( posScale == 1.0f && posBias[0] == 0.0f && posBias[1] == 0.0f &&
+        posBias[2] == 0.0f ) {
+        return;
+    }
+
+    // model * translate(posBias) * scale(posScale)
+    for( int i = 0; i < 4; ++i ) {
+        model[12+i] += model[i] * posBias[0] + model[4+i] * posBias[1] +
+            model[8+i] * posBias[2];
+    }
+    for( int i = 0; i < 12; ++i ) {
+        model[i] *= posScale;
+    }
+}
+
+///
+// setupArrays() - bind the buffers and set up the vertex attribute
+//     variables (recorded in the current vertex array object)
+//
+// @param program - GLSL program object
+// @param vp      - name of the position attribute variable
+// @param vc      - name of the color attribute variable (or NULL)
+// @param vn      - name of the normal attribute variable (or NULL)
+// @param vt      - name of the texture coord attribute variable (or NULL)
+///
+void BufferSet::setupArrays( GLuint program,
+    const char *vp, const char *vc, const char *vn, const char *vt ) {
+
     // bind the buffers
-    glBindBuffer( GL_ARRAY_BUFFER, vbuffer );
-    glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, ebuffer );
+    stBindBuffer( GL_ARRAY_BUFFER, vbuffer );
+    stBindBuffer( GL_ELEMENT_ARRAY_BUFFER, ebuffer );
+    selectCalls += 2;
 
     // set up the vertex attribute variables
 
+    if( layout != LAYOUT_PLANAR ) {
+        setupInterleaved( program, vp, vc, vn, vt );
+        return;
+    }
+
     // we always have position data
     GLint vPosition = glGetAttribLocation( program , vp );
     glEnableVertexAttribArray( vPosition );
     glVertexAttribPointer( vPosition, 4, GL_FLOAT, GL_FALSE, 0,
                            BUFFER_OFFSET(0) );
+    selectCalls += 3;
 
     // cumulative byte offset for subsequent data sections
     int offset = vSize;
@@ -236,6 +854,7 @@ void BufferSet::selectBuffers( GLuint program,
         glVertexAttribPointer( vColor, 4, GL_FLOAT, GL_FALSE, 0,
                                BUFFER_OFFSET(offset) );
         offset += cSize;
+        selectCalls += 3;
     }
 
     // how about a surface normal?
@@ -245,6 +864,7 @@ void BufferSet::selectBuffers( GLuint program,
         glVertexAttribPointer( vNormal, 3, GL_FLOAT, GL_FALSE, 0,
                                BUFFER_OFFSET(offset) );
         offset += nSize;
+        selectCalls += 3;
     }
 
     // what about texture coordinates?
@@ -254,5 +874,77 @@ void BufferSet::selectBuffers( GLuint program,
         glVertexAttribPointer( vTexCoord, 2, GL_FLOAT, GL_FALSE, 0,
                                BUFFER_OFFSET(offset) );
         offset += tSize;
+        selectCalls += 3;
+    }
+}
+
+///
+// setupInterleaved() - set up the vertex attribute variables for
+//     an interleaved or quantized buffer (called by setupArrays())
+//
+// @param program - GLSL program object
+// @param vp      - name of the position attribute variable
+// @param vc      - name of the color attribute variable (or NULL)
+// @param vn      - name of the normal attribute variable (or NULL)
+// @param vt      - name of the texture coord attribute variable (or NULL)
+///
+void BufferSet::setupInterleaved( GLuint program,
+    const char *vp, const char *vc, const char *vn, const char *vt ) {
+
+    // interleaved positions are XYZ only, and the shader supplies
+    // W = 1; quantized ones have a W of their own
+    GLint vPosition = glGetAttribLocation( program , vp );
+    glEnableVertexAttribArray( vPosition );
+    if( layout == LAYOUT_QUANTIZED ) {
+        glVertexAttribPointer( vPosition, 4, GL_SHORT, GL_TRUE, stride,
+                               BUFFER_OFFSET(0) );
+    } else if( layout == LAYOUT_QUANTIZED_HALF ) {
+        glVertexAttribPointer( vPosition, 4, GL_HALF_FLOAT, GL_FALSE,
+                               stride, BUFFER_OFFSET(0) );
+    } else {
+        glVertexAttribPointer( vPosition, 3, GL_FLOAT, GL_FALSE, stride,
+                               BUFFER_OFFSET(0) );
+    }
+    selectCalls += 3;
+
+    // byte offset of the next field within a vertex
+    int offset = (int) (vSize / numVertices);
+
+    if( cSize > 0 ) {
+        if( vc != NULL ) {
+            GLint vColor = glGetAttribLocation( program, vc );
+            glEnableVertexAttribArray( vColor );
+            glVertexAttribPointer( vColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,
+                                   stride, BUFFER_OFFSET(offset) );
+            selectCalls += 3;
+        }
+        offset += 4;
+    }
+
+    if( nSize > 0 ) {
+        if( vn != NULL ) {
+            GLint vNormal = glGetAttribLocation( program, vn );
+            glEnableVertexAttribArray( vNormal );
+            glVertexAttribPointer( vNormal, 4, GL_INT_2_10_10_10_REV,
+                                   GL_TRUE, stride, BUFFER_OFFSET(offset) );
+            selectCalls += 3;
+        }
+        offset += sizeof(GLuint);
+    }
+
+    if( tSize > 0 && vt != NULL ) {
+        GLint vTexCoord = glGetAttribLocation( program, vt );
+        glEnableVertexAttribArray( vTexCoord );
+        if( layout == LAYOUT_INTERLEAVED ) {
+            glVertexAttribPointer( vTexCoord, 2, GL_FLOAT, GL_FALSE,
+                                   stride, BUFFER_OFFSET(offset) );
+        } else if( uvHalf ) {
+            glVertexAttribPointer( vTexCoord, 2, GL_HALF_FLOAT, GL_FALSE,
+                                   stride, BUFFER_OFFSET(offset) );
+        } else {
+            glVertexAttribPointer( vTexCoord, 2, GL_UNSIGNED_SHORT, GL_TRUE,
+                                   stride, BUFFER_OFFSET(offset) );
+        }
+        selectCalls += 3;
     }
 }
@@ -17,21 +17,71 @@
 #include <windows.h>
 #endif
 
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
 #ifndef __APPLE__
 #include <GL/glew.h>
 #endif
 
 #include <GLFW/glfw3.h>
+#endif
 
 using namespace std;
 
+#include <string>
+
 #include "Canvas.h"
 
+class GeometryArena;
+class MeshFile;
+
 ///
 // How to calculate an offset into the vertex buffer
 ///
 #define BUFFER_OFFSET(i)        ((GLvoid *)(((char *)0) + (i)))
 
+///
+// Vertex buffer layouts
+//
+// LAYOUT_PLANAR keeps each attribute in its own section of the buffer,
+// as full floats (XYZW locations, RGBA colors, XYZ normals, UV).
+//
+// LAYOUT_INTERLEAVED stores each vertex contiguously, packed:
+// XYZ location (floats), RGBA color (unsigned bytes), normal
+// (normalized, 10_10_10_2), UV (floats); absent attributes take
+// no space.
+//
+// LAYOUT_QUANTIZED is interleaved like LAYOUT_INTERLEAVED, but packs
+// the location into four normalized shorts (snorm16, W = 1), relative
+// to the center of the mesh's bounding box and divided by its largest
+// half-extent (posBias and posScale), and the UV into two normalized
+// unsigned shorts (unorm16) when they all lie in [0,1], or two half
+// floats otherwise:  16 bytes for a vertex with a normal and UV, where
+// LAYOUT_PLANAR takes 36.  The model matrix the mesh is drawn with
+// must include the scale and bias; see positionTransform().
+//
+// LAYOUT_QUANTIZED_HALF is the same, but with the location as four
+// half floats, unscaled, so that it can be drawn with any shader.
+//
+// Meshes in a GeometryArena use the arena's own format instead.
+///
+#define LAYOUT_PLANAR           0
+#define LAYOUT_INTERLEAVED      1
+#define LAYOUT_QUANTIZED        2
+#define LAYOUT_QUANTIZED_HALF   3
+
+///
+// The largest difference between a quantized mesh's vertex data, as
+// the GL will read it, and the floats it was made from
+///
+typedef struct st_quanterror {
+    GLfloat position;           // distance, in model coordinates
+    GLfloat normal;             // angle, in degrees
+    GLfloat uv;                 // in either coordinate
+} QuantError;
+
 ///
 // All the relevant information needed to keep
 // track of vertex and element buffers
@@ -43,24 +93,68 @@ public:
     // buffer handles
     GLuint vbuffer, ebuffer;
 
-    // total number of vertices
-    int numElements;
+    // total number of elements (indices), and of distinct vertices
+    int numElements, numVertices;
 
     // component sizes (bytes)
     long vSize, eSize, tSize, cSize, nSize;
 
+    // how the vertex buffer is organized (LAYOUT_*), and the distance
+    // between vertices (0 for planar data)
+    int layout;
+    GLsizei stride;
+
     // have these already been set up?
     bool bufferInit;
 
+    // if set (before createBuffers()), the mesh goes into this shared
+    // arena instead of buffers of its own; vbuffer and ebuffer are then
+    // 0, and 'handle' says where in the arena the mesh is
+    GeometryArena *arena;
+    int handle;
+
+    // bounds of the vertex locations, in model coordinates:  an
+    // axis-aligned box, and a sphere around the center of the box
+    GLfloat boxMin[3], boxMax[3];
+    GLfloat center[3], radius;
+
+    // the vertex buffer holds (location - posBias) / posScale (1 and 0
+    // unless the layout is LAYOUT_QUANTIZED), and how far it is from
+    // the original data
+    GLfloat posScale, posBias[3];
+    QuantError quantError;
+
+    // CPU-side vertex data, moved out of the Canvas when createBuffers()
+    // is asked to keep it, and a copy of the indices (otherwise empty)
+    vector<float> points, normals, uv, colors;
+    vector<GLuint> indices;
+
+    // vertex array objects built by selectBuffers(), one for each
+    // combination of program and attribute names it has been given;
+    // the names are kept as the pointers passed in (string literals),
+    // so finding an entry again costs no string work
+    struct VaoEntry {
+        GLuint program;
+        const char *vp, *vc, *vn, *vt;
+        GLuint vao;
+    };
+    vector<VaoEntry> vaos;
+
+    // number of GL calls issued by selectBuffers(), over all BufferSets
+    static long selectCalls;
+
 public:
 
     ///
     // Constructor
+    //
+    // @param layout - how createBuffers() should organize vertex data
     ///
-    BufferSet( void );
+    BufferSet( int layout = LAYOUT_PLANAR );
 
     ///
     // initBuffer(buf) - reset the supplied buffer to its "empty" state
+    // (the layout and arena are left alone)
     ///
     void initBuffer( void );
 
@@ -86,13 +180,38 @@ public:
     // createBuffers(buf,canvas) - create a set of buffers for the object
     //     currently held in 'canvas'.
     //
-    // @param C   - the Canvas we'll use for drawing
+    // @param C    - the Canvas we'll use for drawing
+    // @param keep - if true, move the Canvas's vertex data into this
+    //               BufferSet (leaving the Canvas empty) instead of
+    //               leaving it in the Canvas, and copy the indices
     ///
-    void createBuffers( Canvas &C );
+    void createBuffers( Canvas &C, bool keep = false );
+
+    ///
+    // createBuffers(buf,file) - create a set of buffers for the mesh
+    //     in an open mesh file (see MeshCache.h), straight from the
+    //     file's mapping
+    //
+    // @param F    - the file
+    // @param keep - if true, copy the vertex data and indices into
+    //               this BufferSet
+    ///
+    void createBuffers( const MeshFile &F, bool keep = false );
+
+    ///
+    // computeBounds() - find the bounding box and sphere of the vertex
+    //     locations (XYZW)
+    ///
+    void computeBounds( AttribView pts );
 
     ///
     // selectBuffers() - bind the correct vertex and element buffers
     //
+    // The first call for a given program and set of attribute names
+    // builds a vertex array object; later calls just bind it.  The
+    // names are matched by address, so they must be string literals
+    // (or otherwise outlive the BufferSet).
+    //
     // @param program - GLSL program object
     // @param vp      - name of the position attribute variable
     // @param vc      - name of the color attribute variable (or NULL)
@@ -102,6 +221,53 @@ public:
     void selectBuffers( GLuint program,
         const char *vp, const char * vc, const char *vn, const char *vt );
 
+    ///
+    // What to pass to glDrawElementsBaseVertex() and its relatives:
+    // where the mesh's indices start in the element buffer (as a byte
+    // offset, or counting indices), and what is added to each of them
+    // (all 0 unless the mesh is in an arena)
+    ///
+    const GLvoid *indexOffset( void ) const;
+    GLuint firstIndex( void ) const;
+    GLint baseVertex( void ) const;
+
+    ///
+    // elementBuffer() - the element buffer the mesh is drawn from
+    //     (shared by all meshes in the same arena)
+    ///
+    GLuint elementBuffer( void ) const;
+
+    ///
+    // positionTransform() - turn a model matrix into the one to draw
+    //     the mesh with, by applying the scale and bias of its vertex
+    //     locations first (this leaves the normals alone, so normal
+    //     matrices must be made from the original model matrix)
+    //
+    // @param model - the model (or model-view) matrix, changed in place
+    ///
+    void positionTransform( GLfloat *model ) const;
+
+private:
+
+    ///
+    // Helpers for createBuffers() and selectBuffers(); see Buffers.cpp
+    ///
+    void reset( void );
+    void upload( AttribView pts, AttribView cols, AttribView norms,
+        AttribView tex, const GLuint *elements, const void *planar );
+    void createInterleaved( AttribView pts, AttribView cols,
+        AttribView norms, AttribView tex );
+    void createQuantized( AttribView pts, AttribView cols,
+        AttribView norms, AttribView tex );
+    void deleteArrays( void );
+    void setupArrays( GLuint program,
+        const char *vp, const char * vc, const char *vn, const char *vt );
+    void setupInterleaved( GLuint program,
+        const char *vp, const char * vc, const char *vn, const char *vt );
+
+    // how LAYOUT_QUANTIZED* store (u,v) data
+    bool uvHalf;
+
 };
 
 #endif
@@ -11,6 +11,7 @@
 //
 
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 
@@ -73,6 +74,7 @@ void Canvas::clear( void )
     normals.clear();
     uv.clear();
     colors.clear();
+    elements.clear();
     numElements = 0;
     currentColor.r = 0.0f;
     currentColor.g = 0.0f;
@@ -80,6 +82,28 @@ void Canvas::clear( void )
     currentColor.a = 1.0f;
 }
 
+///
+// Reserve space for triangles about to be added
+//
+// @param triangles  number of triangles to make room for
+// @param attributes CANVAS_* flags for the optional data that will
+//                   be added along with positions and normals
+///
+void Canvas::reserve( int triangles, int attributes )
+{
+    // three vertices per triangle
+    size_t nv = 3 * (size_t) triangles;
+
+    points.reserve( points.size() + 4 * nv );
+    normals.reserve( normals.size() + 3 * nv );
+    if( attributes & CANVAS_UV ) {
+        uv.reserve( uv.size() + 2 * nv );
+    }
+    if( attributes & CANVAS_COLORS ) {
+        colors.reserve( colors.size() + 4 * nv );
+    }
+}
+
 ///
 // Add a triangle to the current shape
 //
@@ -204,6 +228,145 @@ void Canvas::addTriangleWithNorms( Vertex p0, Normal n0,
     normals.push_back( n2.z );
 
     numElements += 3;  // three vertices per triangle
+
+    if( !elements.empty() ) {
+        extendElements();
+    }
+}
+
+///
+// adds a whole set of triangles to the current shape in one pass
+//
+// @param n            number of triangles
+// @param positions    vertex positions (XYZ)
+// @param norms        vertex normals (XYZ), or NULL for face normals
+// @param texCoords    texture coordinates (UV), or NULL
+// @param elements     vertex indices, three per triangle, or NULL
+// @param normElements separate normal indices, or NULL to use 'elements'
+///
+void Canvas::addTriangles( int n, const float *positions,
+        const float *norms, const float *texCoords, const int *elements,
+        const int *normElements )
+{
+    if( n < 1 ) {
+        return;
+    }
+
+    if( normElements == NULL ) {
+        normElements = elements;
+    }
+
+    // grow each array once, then fill in the new section directly
+    size_t nv = 3 * (size_t) n;
+    size_t pBase = points.size();
+    size_t nBase = normals.size();
+    size_t tBase = uv.size();
+
+    points.resize( pBase + 4 * nv );
+    normals.resize( nBase + 3 * nv );
+    if( texCoords != NULL ) {
+        uv.resize( tBase + 2 * nv );
+    }
+
+    float *pDst = &points[pBase];
+    float *nDst = &normals[nBase];
+    float *tDst = texCoords != NULL ? &uv[tBase] : NULL;
+
+    for( size_t i = 0; i < nv; i += 3 ) {
+        const float *p[3];
+
+        for( int k = 0; k < 3; ++k ) {
+            size_t v = elements ? elements[i + k] : i + k;
+            p[k] = positions + 3 * v;
+
+            *pDst++ = p[k][0];
+            *pDst++ = p[k][1];
+            *pDst++ = p[k][2];
+            *pDst++ = 1.0f;
+
+            if( texCoords != NULL ) {
+                *tDst++ = texCoords[2 * v];
+                *tDst++ = texCoords[2 * v + 1];
+            }
+        }
+
+        if( norms != NULL ) {
+            for( int k = 0; k < 3; ++k ) {
+                size_t v = normElements ? normElements[i + k] : i + k;
+                *nDst++ = norms[3 * v];
+                *nDst++ = norms[3 * v + 1];
+                *nDst++ = norms[3 * v + 2];
+            }
+        } else {
+            // same (unnormalized) face normal as addTriangle() uses
+            float ux = p[1][0] - p[0][0];
+            float uy = p[1][1] - p[0][1];
+            float uz = p[1][2] - p[0][2];
+
+            float vx = p[2][0] - p[0][0];
+            float vy = p[2][1] - p[0][1];
+            float vz = p[2][2] - p[0][2];
+
+            float nx = (uy * vz) - (uz * vy);
+            float ny = (uz * vx) - (ux * vz);
+            float nz = (ux * vy) - (uy * vx);
+
+            for( int k = 0; k < 3; ++k ) {
+                *nDst++ = nx;
+                *nDst++ = ny;
+                *nDst++ = nz;
+            }
+        }
+    }
+
+    numElements += (int) nv;
+
+    if( !this->elements.empty() ) {
+        extendElements();
+    }
+}
+
+///
+// makes room for an indexed mesh at the end of the current shape,
+// for the caller to fill in directly
+//
+// @param vertices  number of vertices in the mesh
+// @param triangles number of triangles in the mesh
+// @param positions receives where the positions (XYZW) go
+// @param norms     receives where the normals (XYZ) go
+// @param elements  receives where the indices go
+// @param texCoords receives where the (u,v) data go, or NULL
+//
+// @return the number of the mesh's first vertex
+///
+GLuint Canvas::addMesh( int vertices, int triangles, float **positions,
+        float **norms, GLuint **elements, float **texCoords )
+{
+    // whatever is here already needs real element data first
+    extendElements();
+
+    GLuint base = (GLuint) (points.size() / 4);
+    size_t pBase = points.size();
+    size_t nBase = normals.size();
+    size_t eBase = this->elements.size();
+
+    points.resize( pBase + 4 * (size_t) vertices );
+    normals.resize( nBase + 3 * (size_t) vertices );
+    this->elements.resize( eBase + 3 * (size_t) triangles );
+
+    *positions = vertices > 0 ? &points[pBase] : NULL;
+    *norms = vertices > 0 ? &normals[nBase] : NULL;
+    *elements = triangles > 0 ? &this->elements[eBase] : NULL;
+
+    // earlier vertices without (u,v) data get (0,0)
+    if( texCoords != NULL ) {
+        uv.resize( 2 * ((size_t) base + vertices) );
+        *texCoords = vertices > 0 ? &uv[2 * (size_t) base] : NULL;
+    }
+
+    numElements += 3 * triangles;
+
+    return base;
 }
 
 ///
@@ -250,6 +413,10 @@ void Canvas::setPixel( float x, float y )
     colors.push_back( 1.0f );  // ignore the alpha channel
 
     numElements += 1;
+
+    if( !elements.empty() ) {
+        extendElements();
+    }
 }
 
 ///
@@ -272,6 +439,10 @@ void Canvas::setPixelColor( float x, float y, Color color )
     colors.push_back( 1.0f );  // ignore the alpha channel
 
     numElements += 1;
+
+    if( !elements.empty() ) {
+        extendElements();
+    }
 }
 
 ///
@@ -285,7 +456,13 @@ GLuint *Canvas::getElements( void )
         elemArray = 0;
     }
 
-    int n = points.size();
+    // after a weld(), we already have the real thing
+    if( !elements.empty() ) {
+        return &elements[0];
+    }
+
+    // otherwise, one element per vertex
+    int n = numElements;
 
     if( n > 0 ) {
         // create and fill a new element array
@@ -414,11 +591,282 @@ float *Canvas::getColors( void )
     return colorArray;
 }
 
+///
+// Make a view of an attribute array
+///
+static AttribView makeView( const vector<float> &v )
+{
+    AttribView view;
+
+    view.data = v.empty() ? NULL : &v[0];
+    view.count = v.size();
+
+    return view;
+}
+
+///
+// Views of the vertex, normal, (u,v), and color data
+///
+AttribView Canvas::viewVertices( void ) const
+{
+    return makeView( points );
+}
+
+AttribView Canvas::viewNormals( void ) const
+{
+    return makeView( normals );
+}
+
+AttribView Canvas::viewUV( void ) const
+{
+    return makeView( uv );
+}
+
+AttribView Canvas::viewColors( void ) const
+{
+    return makeView( colors );
+}
+
+///
+// Hand all of the vertex data over to the caller without copying it
+//
+// @param pts       receives the vertex locations (XYZW)
+// @param norms     receives the normals (XYZ)
+// @param texCoords receives the (u,v) data
+// @param cols      receives the colors (RGBA)
+///
+void Canvas::moveData( vector<float> &pts, vector<float> &norms,
+    vector<float> &texCoords, vector<float> &cols )
+{
+    pts.swap( points );
+    norms.swap( normals );
+    texCoords.swap( uv );
+    cols.swap( colors );
+
+    // release whatever the caller's vectors held before
+    vector<float>().swap( points );
+    vector<float>().swap( normals );
+    vector<float>().swap( uv );
+    vector<float>().swap( colors );
+
+    clear();
+}
+
+///
+// Keep 'elements' covering vertices added after a weld(); new vertices
+// are not shared until weld() is called again
+///
+void Canvas::extendElements( void )
+{
+    size_t next = points.size() / 4 - (numElements - elements.size());
+
+    while( elements.size() < (size_t) numElements ) {
+        elements.push_back( (GLuint) next++ );
+    }
+}
+
+///
+// Hash a float for weld(), treating -0.0 and 0.0 as the same value
+///
+static inline unsigned int floatBits( float f )
+{
+    unsigned int u;
+
+    if( f == 0.0f ) {
+        f = 0.0f;
+    }
+    memcpy( &u, &f, sizeof(u) );
+
+    return u;
+}
+
+///
+// Merge identical vertices, building real element data
+//
+// @return the number of vertices removed
+///
+int Canvas::weld( void )
+{
+    size_t n = points.size() / 4;
+    if( n == 0 ) {
+        return 0;
+    }
+
+    // the attributes present, and their sizes (in floats); each must
+    // cover every vertex or none, or there's no telling which floats
+    // belong to which vertex
+    const int NATTR = 4;
+    static const char *names[NATTR] = { "point", "normal", "uv", "color" };
+    static const size_t sizes[NATTR] = { 4, 3, 2, 4 };
+    vector<float> *attr[NATTR] = { &points, &normals, &uv, &colors };
+    size_t width[NATTR];
+    for( int a = 0; a < NATTR; ++a ) {
+        size_t count = attr[a]->size();
+        if( count != 0 && count != n * sizes[a] ) {
+            cerr << "weld: " << count / sizes[a] << " of " << n <<
+                " vertices have " << names[a] << " data; not welding" <<
+                endl;
+            return 0;
+        }
+        width[a] = count == 0 ? 0 : sizes[a];
+    }
+
+    // the current element data (the identity, if never welded)
+    vector<GLuint> old;
+    old.swap( elements );
+    if( old.empty() ) {
+        old.resize( n );
+        for( size_t i = 0; i < n; ++i ) {
+            old[i] = (GLuint) i;
+        }
+    }
+
+    // open-addressed hash table of vertex numbers, at most half full
+    size_t tableSize = 16;
+    while( tableSize < 2 * n ) {
+        tableSize <<= 1;
+    }
+    vector<GLuint> table( tableSize, ~0u );
+
+    // remap[i] is the new number of old vertex i
+    vector<GLuint> remap( n );
+    size_t kept = 0;
+
+    for( size_t i = 0; i < n; ++i ) {
+
+        unsigned int h = 2166136261u;
+        for( int a = 0; a < NATTR; ++a ) {
+            const float *v = attr[a]->data() + i * width[a];
+            for( size_t k = 0; k < width[a]; ++k ) {
+                h = (h ^ floatBits(v[k])) * 16777619u;
+            }
+        }
+
+        size_t slot = h & (tableSize - 1);
+        for( ;; ) {
+            GLuint j = table[slot];
+
+            if( j == ~0u ) {
+                // first time we've seen this vertex; compact it down
+                // (kept <= i, so this never overwrites unread data)
+                for( int a = 0; a < NATTR; ++a ) {
+                    float *dst = attr[a]->data() + kept * width[a];
+                    const float *src = attr[a]->data() + i * width[a];
+                    for( size_t k = 0; k < width[a]; ++k ) {
+                        dst[k] = src[k];
+                    }
+                }
+                table[slot] = (GLuint) kept;
+                remap[i] = (GLuint) kept++;
+                break;
+            }
+
+            // compare against the (already compacted) candidate
+            bool same = true;
+            for( int a = 0; a < NATTR && same; ++a ) {
+                const float *v = attr[a]->data() + i * width[a];
+                const float *w = attr[a]->data() + j * width[a];
+                for( size_t k = 0; k < width[a]; ++k ) {
+                    if( floatBits(v[k]) != floatBits(w[k]) ) {
+                        same = false;
+                        break;
+                    }
+                }
+            }
+            if( same ) {
+                remap[i] = j;
+                break;
+            }
+
+            slot = (slot + 1) & (tableSize - 1);
+        }
+    }
+
+    for( int a = 0; a < NATTR; ++a ) {
+        attr[a]->resize( kept * width[a] );
+    }
+
+    elements.resize( old.size() );
+    for( size_t i = 0; i < old.size(); ++i ) {
+        elements[i] = remap[ old[i] ];
+    }
+
+    numElements = (int) elements.size();
+
+    return (int) (n - kept);
+}
+
+///
+// Reorder the triangles for the vertex cache and overdraw, and the
+// vertices for fetching
+///
+void Canvas::optimize( CacheStats *before, CacheStats *after )
+{
+    size_t n = points.size() / 4;
+    extendElements();
+    size_t count = elements.size();
+
+    CacheStats old = measureCache( elements.data(), count, n );
+    if( before != NULL ) {
+        *before = old;
+    }
+    if( count < 3 ) {
+        if( after != NULL ) {
+            *after = old;
+        }
+        return;
+    }
+
+    vector<GLuint> ordered( count ), clustered( count );
+    optimizeVertexCache( ordered.data(), elements.data(), count, n );
+    optimizeOverdraw( clustered.data(), ordered.data(), count,
+        points.data(), 4, n, OVERDRAW_THRESHOLD );
+
+    // a small mesh may already have been generated in an order that
+    // suits the cache better; keep that if the new order costs more
+    // than optimizeOverdraw() is allowed to
+    CacheStats now = measureCache( clustered.data(), count, n );
+    if( now.transforms <= old.transforms * OVERDRAW_THRESHOLD ) {
+        elements.swap( clustered );
+    } else {
+        now = old;
+    }
+
+    vector<GLuint> remap( n );
+    optimizeVertexFetch( remap.data(), elements.data(), count, n );
+
+    // move every attribute to its vertex's new place
+    const int NATTR = 4;
+    vector<float> *attr[NATTR] = { &points, &normals, &uv, &colors };
+    for( int a = 0; a < NATTR; ++a ) {
+        size_t width = attr[a]->size() / n;
+        vector<float> moved( attr[a]->size() );
+        for( size_t i = 0; i < n; ++i ) {
+            for( size_t k = 0; k < width; ++k ) {
+                moved[remap[i] * width + k] = (*attr[a])[i * width + k];
+            }
+        }
+        attr[a]->swap( moved );
+    }
+
+    // (renumbering the vertices doesn't change which ones are reused)
+    if( after != NULL ) {
+        *after = now;
+    }
+}
 
 ///
 // Retrieve the vertex count from this Canvas
 ///
 int Canvas::numVertices( void )
+{
+    return (int) (points.size() / 4);
+}
+
+///
+// Retrieve the element (index) count from this Canvas
+///
+int Canvas::numIndices( void )
 {
     return numElements;
 }
@@ -19,20 +19,43 @@
 #include <windows.h>
 #endif
 
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
 #ifndef __APPLE__
 #include <GL/glew.h>
 #endif
 
 #include <GLFW/glfw3.h>
+#endif
 
 using namespace std;
 
+#include <cstddef>
 #include <vector>
 
 #include "Vertex.h"
 #include "Color.h"
 #include "TexCoord.h"
 #include "Normal.h"
+#include "MeshOptimizer.h"
+
+///
+// Per-vertex attribute flags for Canvas::reserve()
+///
+#define CANVAS_UV       0x1
+#define CANVAS_COLORS   0x2
+
+///
+// Non-owning view of one of the Canvas's attribute arrays; valid
+// until the Canvas is next modified or cleared
+///
+typedef
+    struct st_attview {
+        const float *data;  // NULL if there is no such data
+        size_t count;       // number of floats
+    } AttribView;
 
 ///
 // Simple canvas class that allows for pixel-by-pixel rendering.
@@ -66,10 +89,18 @@ class Canvas {
     vector<float> colors;
     float *colorArray;
 
-    // element count and connectivity data
+    // element count and connectivity data (each vertex added is also
+    // a new element, until weld() shares them)
     int numElements;
     GLuint *elemArray;
 
+    // real connectivity data, once weld() has shared the vertices;
+    // until then, vertex i is simply element i
+    vector<GLuint> elements;
+
+    // keep 'elements' covering vertices added after a weld()
+    void extendElements( void );
+
     ///
     // other Canvas defaults
     ///
@@ -99,6 +130,16 @@ public:
     ///
     void clear( void );
 
+    ///
+    // Reserve space for triangles about to be added, so that building
+    // a large mesh does not repeatedly reallocate the vertex data
+    //
+    // @param triangles  number of triangles to make room for
+    // @param attributes CANVAS_* flags for the optional data that will
+    //                   be added along with positions and normals
+    ///
+    void reserve( int triangles, int attributes );
+
     ///
     // adds a triangle to the current shape
     //
@@ -134,6 +175,51 @@ public:
     void addTriangleWithNorms( Vertex p0, Normal n0,
             Vertex p1, Normal n1, Vertex p2, Normal n2 );
 
+    ///
+    // adds a whole set of triangles to the current shape in one pass
+    //
+    // Vertex j of the mesh has its position at positions[3*j],
+    // its normal at norms[3*j], and its (u,v) at texCoords[2*j].  Triangle
+    // i uses vertices elements[3*i] through elements[3*i+2] (or simply
+    // 3*i through 3*i+2 if elements is NULL).
+    //
+    // @param n            number of triangles
+    // @param positions    vertex positions (XYZ)
+    // @param norms        vertex normals (XYZ), or NULL to use the
+    //                     face normal, as addTriangle() does
+    // @param texCoords    texture coordinates (UV), or NULL
+    // @param elements     vertex indices, three per triangle, or NULL
+    // @param normElements separate normal indices, three per triangle,
+    //                     or NULL to index normals with 'elements'
+    ///
+    void addTriangles( int n, const float *positions, const float *norms,
+            const float *texCoords, const int *elements = NULL,
+            const int *normElements = NULL );
+
+    ///
+    // makes room for an indexed mesh at the end of the current shape,
+    // for the caller to fill in directly
+    //
+    // The mesh's vertices are not shared with anything already in
+    // the Canvas.  The caller writes 'vertices' positions (XYZW) and
+    // normals (XYZ), and 'triangles' triangles of indices; the indices
+    // are relative to the Canvas, so each one must have the returned
+    // base vertex added to it.  The pointers are valid until the
+    // Canvas is next modified.
+    //
+    // @param vertices  number of vertices in the mesh
+    // @param triangles number of triangles in the mesh
+    // @param positions receives where the positions go
+    // @param norms     receives where the normals go
+    // @param elements  receives where the indices go
+    // @param texCoords receives where the (u,v) data go, or NULL if
+    //                  the mesh has none
+    //
+    // @return the number of the mesh's first vertex
+    ///
+    GLuint addMesh( int vertices, int triangles, float **positions,
+            float **norms, GLuint **elements, float **texCoords = NULL );
+
     ///
     // Set the pixel Z coordinate
     //
@@ -169,6 +255,7 @@ public:
 
     ///
     // Retrieve the array of element data from this Canvas
+    // (numIndices() entries)
     ///
     GLuint *getElements( void );
 
@@ -192,11 +279,63 @@ public:
     ///
     float *getColors( void );
 
+    ///
+    // Views of the vertex, normal, (u,v), and color data held by this
+    // Canvas; unlike the get*() functions, these do not copy anything
+    ///
+    AttribView viewVertices( void ) const;
+    AttribView viewNormals( void ) const;
+    AttribView viewUV( void ) const;
+    AttribView viewColors( void ) const;
+
+    ///
+    // Hand all of the vertex data over to the caller without copying
+    // it, leaving this Canvas empty (as if clear() had been called)
+    //
+    // @param pts       receives the vertex locations (XYZW)
+    // @param norms     receives the normals (XYZ)
+    // @param texCoords receives the (u,v) data
+    // @param cols      receives the colors (RGBA)
+    ///
+    void moveData( vector<float> &pts, vector<float> &norms,
+        vector<float> &texCoords, vector<float> &cols );
+
+    ///
+    // Merge vertices whose position, normal, (u,v), and color data
+    // are all identical, turning the triangle soup built up by the
+    // add*() functions into a compact vertex array plus real element
+    // (index) data.  After this, numVertices() is the number of
+    // distinct vertices and numIndices() the number of elements.
+    // Each attribute must be given for every vertex or for none; if
+    // one covers only some of them, that is reported and nothing is
+    // welded.
+    //
+    // @return the number of vertices removed
+    ///
+    int weld( void );
+
+    ///
+    // Reorder the triangles for the post-transform vertex cache and
+    // for overdraw, then renumber the vertices in the order they are
+    // first used (see MeshOptimizer.h).  Best done after weld(), as a
+    // triangle soup has no vertices to share.
+    //
+    // @param before receives how well the old order used the cache,
+    //               or NULL
+    // @param after  receives how well the new order does, or NULL
+    ///
+    void optimize( CacheStats *before = NULL, CacheStats *after = NULL );
+
     ///
     // Retrieve the vertex count from this Canvas
     ///
     int numVertices( void );
 
+    ///
+    // Retrieve the element (index) count from this Canvas
+    ///
+    int numIndices( void );
+
 };
 
 #endif
@@ -0,0 +1,139 @@
+///
+//  CommandBuffer.cpp
+//
+//  A list of indirect draw commands, kept in a GPU buffer along with
+//  the per-draw records they use.
+///
+
+#include <cstdio>
+#include <cstring>
+
+#include "CommandBuffer.h"
+#include "GLState.h"
+
+///
+// Constructor
+///
+CommandBuffer::CommandBuffer( void ) :
+    commandBuffer(0), recordBuffer(0), uploads(0), reuses(0) {
+}
+
+///
+// supported() - can the current GL context draw indirectly, with
+//     base instances?
+///
+bool CommandBuffer::supported( void ) {
+
+    const char *version = (const char *) glGetString( GL_VERSION );
+    int major = 0, minor = 0;
+
+    if( version != NULL &&
+        sscanf(version, "%d.%d", &major, &minor) == 2 &&
+        (major > 4 || (major == 4 && minor >= 3)) ) {
+        return true;
+    }
+
+    bool indirect = false, baseInstance = false;
+    GLint n = 0;
+    glGetIntegerv( GL_NUM_EXTENSIONS, &n );
+    for( GLint i = 0; i < n; ++i ) {
+        const char *ext = (const char *) glGetStringi( GL_EXTENSIONS, i );
+        if( ext == NULL ) {
+            continue;
+        }
+        if( !strcmp(ext, "GL_ARB_multi_draw_indirect") ) {
+            indirect = true;
+        } else if( !strcmp(ext, "GL_ARB_base_instance") ) {
+            baseInstance = true;
+        }
+    }
+
+    return indirect && (baseInstance || major > 4 ||
+        (major == 4 && minor >= 2));
+}
+
+///
+// clear() - start a new list
+///
+void CommandBuffer::clear( void ) {
+    commands.clear();
+    records.clear();
+}
+
+///
+// add() - add a command drawing a mesh with some records
+//
+// @param mesh - what to draw
+// @param recs - the records
+// @param n    - how many records (each is one instance)
+//
+// @return the command's index in the list
+///
+int CommandBuffer::add( const BufferSet *mesh, const InstanceData *recs,
+    GLuint n ) {
+
+    DrawCommand c;
+    c.count = (GLuint) mesh->numElements;
+    c.instanceCount = n;
+    c.firstIndex = mesh->firstIndex();
+    c.baseVertex = mesh->baseVertex();
+    c.baseInstance = (GLuint) records.size();
+
+    records.insert( records.end(), recs, recs + n );
+    commands.push_back( c );
+
+    return (int) commands.size() - 1;
+}
+
+///
+// same() - are two lists byte-for-byte the same?
+///
+template <class T>
+static bool same( const vector<T> &a, const vector<T> &b )
+{
+    return a.size() == b.size() &&
+        (a.empty() || !memcmp(a.data(), b.data(), a.size() * sizeof(T)));
+}
+
+///
+// upload() - send the list to the GPU, unless it is the same as the
+//     one sent last time
+///
+void CommandBuffer::upload( void ) {
+
+    if( commandBuffer != 0 && same(commands, sentCommands) &&
+        same(records, sentRecords) ) {
+        ++reuses;
+        return;
+    }
+
+    if( commandBuffer == 0 ) {
+        glGenBuffers( 1, &commandBuffer );
+        glGenBuffers( 1, &recordBuffer );
+    }
+
+    stBindBuffer( GL_DRAW_INDIRECT_BUFFER, commandBuffer );
+    glBufferData( GL_DRAW_INDIRECT_BUFFER,
+        commands.size() * sizeof(DrawCommand), commands.data(),
+        GL_DYNAMIC_DRAW );
+    stBindBuffer( GL_ARRAY_BUFFER, recordBuffer );
+    glBufferData( GL_ARRAY_BUFFER, records.size() * sizeof(InstanceData),
+        records.data(), GL_DYNAMIC_DRAW );
+
+    sentCommands = commands;
+    sentRecords = records;
+    ++uploads;
+}
+
+///
+// draw() - issue a run of commands with one call
+//
+// @param first - index of the first command
+// @param n     - number of commands
+///
+void CommandBuffer::draw( int first, int n ) {
+
+    stBindBuffer( GL_DRAW_INDIRECT_BUFFER, commandBuffer );
+    glMultiDrawElementsIndirect( GL_TRIANGLES, GL_UNSIGNED_INT,
+        BUFFER_OFFSET(first * sizeof(DrawCommand)), n, 0 );
+}
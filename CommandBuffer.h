@@ -0,0 +1,126 @@
+///
+//  CommandBuffer.h
+//
+//  A list of indirect draw commands, kept in a GPU buffer along with
+//  the per-draw records they use, for glMultiDrawElementsIndirect().
+//
+//  Each command draws one mesh from a GeometryArena (or any BufferSet)
+//  with one or more records, which are InstanceData as for instanced
+//  drawing:  the command's base instance says where its records start,
+//  so the per-instance attributes find each draw's own transformations
+//  and material.  Any run of commands for meshes sharing their vertex
+//  arrays is then a single draw call.
+//
+//  The list is rebuilt on the CPU every frame, which is cheap; it is
+//  only sent to the GPU when it differs from what was sent last time,
+//  so a frame in which nothing has changed uploads nothing at all.
+//
+//  This needs GL 4.3 (or ARB_multi_draw_indirect with base instances);
+//  supported() says whether the context has them.
+///
+
+#ifndef _COMMANDBUFFER_H_
+#define _COMMANDBUFFER_H_
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
+#ifndef __APPLE__
+#include <GL/glew.h>
+#endif
+
+#include <GLFW/glfw3.h>
+#endif
+
+#include <vector>
+
+#include "Buffers.h"
+#include "Instances.h"
+
+using namespace std;
+
+///
+// One command, laid out as glMultiDrawElementsIndirect() reads it
+///
+typedef struct st_drawcommand {
+    GLuint count;               // number of indices
+    GLuint instanceCount;       // number of records
+    GLuint firstIndex;          // first index
+    GLint baseVertex;           // added to every index
+    GLuint baseInstance;        // first record
+} DrawCommand;
+
+///
+// The command list
+///
+class CommandBuffer {
+
+public:
+
+    // the commands and records for the current frame
+    vector<DrawCommand> commands;
+    vector<InstanceData> records;
+
+    // the buffers they are sent in (0 until the first upload())
+    GLuint commandBuffer, recordBuffer;
+
+    // how many upload() calls sent the lists, and how many found them
+    // unchanged
+    long uploads, reuses;
+
+    ///
+    // Constructor
+    ///
+    CommandBuffer( void );
+
+    ///
+    // supported() - can the current GL context draw indirectly, with
+    //     base instances?
+    ///
+    static bool supported( void );
+
+    ///
+    // clear() - start a new list
+    ///
+    void clear( void );
+
+    ///
+    // add() - add a command drawing a mesh with some records
+    //
+    // @param mesh - what to draw
+    // @param recs - the records
+    // @param n    - how many records (each is one instance)
+    //
+    // @return the command's index in the list
+    ///
+    int add( const BufferSet *mesh, const InstanceData *recs, GLuint n );
+
+    ///
+    // upload() - send the list to the GPU, unless it is the same as
+    //     the one sent last time
+    ///
+    void upload( void );
+
+    ///
+    // draw() - issue a run of commands with one call, using whatever
+    //     program and vertex arrays are current (the per-instance
+    //     attributes must read from recordBuffer, from offset 0)
+    //
+    // @param first - index of the first command
+    // @param n     - number of commands
+    ///
+    void draw( int first, int n );
+
+private:
+
+    // what the last upload() sent
+    vector<DrawCommand> sentCommands;
+    vector<InstanceData> sentRecords;
+};
+
+#endif
@@ -0,0 +1,264 @@
+///
+//  Culling.cpp
+//
+//  View-frustum culling with bounding spheres.
+///
+
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define CULL_SSE
+#include <xmmintrin.h>
+#endif
+
+#include "Culling.h"
+
+///
+// frustumFromMatrix(m,f) - find the planes of the frustum for a
+//     combined projection and view matrix
+//
+// Each plane is a sum or difference of the matrix's fourth row and
+// one of the others (Gribb and Hartmann):  left, right, bottom, top,
+// near, far.
+//
+// @param m - the matrix (16 values, column-major)
+// @param f - the resulting frustum
+///
+void frustumFromMatrix( const GLfloat *m, Frustum &f )
+{
+    for( int i = 0; i < 6; ++i ) {
+        int row = i / 2;
+        GLfloat sign = (i % 2 == 0) ? 1.0f : -1.0f;
+        GLfloat *p = f.planes[i];
+
+        for( int c = 0; c < 4; ++c ) {
+            p[c] = m[c*4+3] + sign * m[c*4+row];
+        }
+
+        GLfloat len = sqrtf( p[0] * p[0] + p[1] * p[1] + p[2] * p[2] );
+        for( int c = 0; c < 4; ++c ) {
+            p[c] /= len;
+        }
+    }
+}
+
+///
+// clear() - discard all the spheres
+///
+void SphereSet::clear( void ) {
+    x.clear();
+    y.clear();
+    z.clear();
+    r.clear();
+}
+
+///
+// size() - the number of spheres in the set
+///
+size_t SphereSet::size( void ) const {
+    return x.size();
+}
+
+///
+// resize() - change the number of spheres
+//
+// @param n - the new number of spheres
+///
+void SphereSet::resize( size_t n ) {
+    x.resize( n );
+    y.resize( n );
+    z.resize( n );
+    r.resize( n );
+}
+
+///
+// worldSphere() - find the bounding sphere of a mesh in world
+//     coordinates
+//
+// The radius grows by the largest scale factor, so non-uniform
+// scaling gives a sphere which is larger than it needs to be, but
+// never smaller.  'model' is the matrix the mesh is drawn with, so it
+// includes the scale and bias of quantized vertex locations, and the
+// sphere is taken into the same terms first.
+///
+static void worldSphere( const BufferSet *B, const GLfloat *model,
+    GLfloat *center, GLfloat *radius )
+{
+    GLfloat c[3];
+    for( int i = 0; i < 3; ++i ) {
+        c[i] = (B->center[i] - B->posBias[i]) / B->posScale;
+    }
+
+    for( int i = 0; i < 3; ++i ) {
+        center[i] = model[i] * c[0] + model[4+i] * c[1] +
+            model[8+i] * c[2] + model[12+i];
+    }
+
+    GLfloat scale2 = 0.0f;
+    for( int col = 0; col < 3; ++col ) {
+        const GLfloat *v = model + col * 4;
+        GLfloat len2 = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+        if( len2 > scale2 ) {
+            scale2 = len2;
+        }
+    }
+
+    *radius = B->radius / B->posScale * sqrtf( scale2 );
+}
+
+///
+// add() - add a sphere
+//
+// @param center - the center (XYZ)
+// @param radius - the radius
+///
+void SphereSet::add( const GLfloat *center, GLfloat radius ) {
+    x.push_back( center[0] );
+    y.push_back( center[1] );
+    z.push_back( center[2] );
+    r.push_back( radius );
+}
+
+///
+// add() - add the bounding sphere of a mesh, moved into world
+//     coordinates by a model matrix
+//
+// @param B     - the mesh
+// @param model - the model matrix (16 values, column-major)
+///
+void SphereSet::add( const BufferSet *B, const GLfloat *model ) {
+
+    GLfloat center[3], radius;
+
+    worldSphere( B, model, center, &radius );
+    add( center, radius );
+}
+
+///
+// set() - replace sphere 'i' with the bounding sphere of a mesh,
+//     moved into world coordinates by a model matrix
+//
+// @param i     - which sphere
+// @param B     - the mesh
+// @param model - the model matrix (16 values, column-major)
+///
+void SphereSet::set( size_t i, const BufferSet *B, const GLfloat *model ) {
+
+    GLfloat center[3];
+
+    worldSphere( B, model, center, &r[i] );
+    x[i] = center[0];
+    y[i] = center[1];
+    z[i] = center[2];
+}
+
+///
+// cullRange() - the scalar test for spheres first..last-1
+///
+size_t SphereSet::cullRange( const Frustum &f, size_t first, size_t last,
+    unsigned char *visible ) const {
+
+    size_t count = 0;
+
+    for( size_t i = first; i < last; ++i ) {
+        unsigned char in = 1;
+        for( int p = 0; p < 6; ++p ) {
+            const GLfloat *pl = f.planes[p];
+            // summed in the same order as the SSE version
+            GLfloat dist = (pl[0] * x[i] + pl[1] * y[i]) +
+                (pl[2] * z[i] + pl[3]);
+            if( dist < -r[i] ) {
+                in = 0;
+                break;
+            }
+        }
+        visible[i] = in;
+        count += in;
+    }
+
+    return count;
+}
+
+///
+// cullScalar() - cull() one sphere at a time, without SSE
+///
+size_t SphereSet::cullScalar( const Frustum &f,
+    vector<unsigned char> &visible ) const {
+
+    visible.resize( x.size() );
+    return cullRange( f, 0, x.size(), visible.data() );
+}
+
+///
+// cull() - test every sphere against a frustum
+//
+// @param f       - the frustum
+// @param visible - set to one entry per sphere:  1 if any part of
+//                  it may be inside the frustum, else 0
+//
+// @return the number of visible spheres
+///
+size_t SphereSet::cull( const Frustum &f,
+    vector<unsigned char> &visible ) const {
+
+    visible.resize( x.size() );
+    return cull( f, 0, x.size(), visible.data() );
+}
+
+///
+// cull() - test some of the spheres against a frustum
+//
+// @param f       - the frustum
+// @param first   - the first sphere to test
+// @param last    - one past the last sphere to test
+// @param visible - one entry per sphere, of which entries
+//                  first..last-1 are set as above
+//
+// @return the number of visible spheres in the range
+///
+size_t SphereSet::cull( const Frustum &f, size_t first, size_t last,
+    unsigned char *visible ) const {
+
+#if defined(CULL_SSE)
+    size_t n = first + ((last - first) & ~(size_t) 3);
+    size_t count = 0;
+
+    __m128 a[6], b[6], c[6], d[6];
+    for( int p = 0; p < 6; ++p ) {
+        a[p] = _mm_set1_ps( f.planes[p][0] );
+        b[p] = _mm_set1_ps( f.planes[p][1] );
+        c[p] = _mm_set1_ps( f.planes[p][2] );
+        d[p] = _mm_set1_ps( f.planes[p][3] );
+    }
+
+    // four spheres at a time:  a sphere is out if its center is
+    // farther than its radius outside any one plane
+    for( size_t i = first; i < n; i += 4 ) {
+        __m128 sx = _mm_loadu_ps( &x[i] );
+        __m128 sy = _mm_loadu_ps( &y[i] );
+        __m128 sz = _mm_loadu_ps( &z[i] );
+        __m128 nr = _mm_sub_ps( _mm_setzero_ps(), _mm_loadu_ps(&r[i]) );
+        __m128 out = _mm_setzero_ps();
+
+        for( int p = 0; p < 6; ++p ) {
+            __m128 dist = _mm_add_ps(
+                _mm_add_ps( _mm_mul_ps(a[p], sx), _mm_mul_ps(b[p], sy) ),
+                _mm_add_ps( _mm_mul_ps(c[p], sz), d[p] ) );
+            out = _mm_or_ps( out, _mm_cmplt_ps(dist, nr) );
+        }
+
+        int mask = _mm_movemask_ps( out );
+        for( int k = 0; k < 4; ++k ) {
+            unsigned char in = (mask >> k) & 1 ? 0 : 1;
+            visible[i+k] = in;
+            count += in;
+        }
+    }
+
+    // and whatever is left over
+    return count + cullRange( f, n, last, visible );
+#else
+    return cullRange( f, first, last, visible );
+#endif
+}
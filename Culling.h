@@ -0,0 +1,151 @@
+///
+//  Culling.h
+//
+//  View-frustum culling with bounding spheres.
+//
+//  The frustum's six planes are taken from the combined projection
+//  and view matrix (see viewProjMatrix() in Viewing.h).  Spheres are
+//  kept as separate arrays of X, Y, Z, and radius so that cull() can
+//  test four of them at a time with SSE where it is available.
+///
+
+#ifndef _CULLING_H_
+#define _CULLING_H_
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
+#ifndef __APPLE__
+#include <GL/glew.h>
+#endif
+
+#include <GLFW/glfw3.h>
+#endif
+
+#include <vector>
+
+#include "Buffers.h"
+
+using namespace std;
+
+///
+// The six planes of a view frustum, each as (a,b,c,d) with (a,b,c)
+// of unit length and pointing inward:  a point p is inside a plane
+// when a*p.x + b*p.y + c*p.z + d >= 0
+///
+typedef struct st_frustum {
+    GLfloat planes[6][4];
+} Frustum;
+
+///
+// frustumFromMatrix(m,f) - find the planes of the frustum for a
+//     combined projection and view matrix
+//
+// @param m - the matrix (16 values, column-major)
+// @param f - the resulting frustum
+///
+void frustumFromMatrix( const GLfloat *m, Frustum &f );
+
+///
+// A set of bounding spheres, in world coordinates
+///
+class SphereSet {
+
+public:
+
+    // sphere centers and radii, one entry per sphere
+    vector<GLfloat> x, y, z, r;
+
+    ///
+    // clear() - discard all the spheres
+    ///
+    void clear( void );
+
+    ///
+    // size() - the number of spheres in the set
+    ///
+    size_t size( void ) const;
+
+    ///
+    // resize() - change the number of spheres, so that set() can fill
+    //     them in (from several threads, for different spheres)
+    //
+    // @param n - the new number of spheres
+    ///
+    void resize( size_t n );
+
+    ///
+    // add() - add a sphere
+    //
+    // @param center - the center (XYZ)
+    // @param radius - the radius
+    ///
+    void add( const GLfloat *center, GLfloat radius );
+
+    ///
+    // add() - add the bounding sphere of a mesh, moved into world
+    //     coordinates by a model matrix
+    //
+    // @param B     - the mesh
+    // @param model - the model matrix (16 values, column-major)
+    ///
+    void add( const BufferSet *B, const GLfloat *model );
+
+    ///
+    // set() - replace sphere 'i' with the bounding sphere of a mesh,
+    //     moved into world coordinates by a model matrix
+    //
+    // @param i     - which sphere
+    // @param B     - the mesh
+    // @param model - the model matrix (16 values, column-major)
+    ///
+    void set( size_t i, const BufferSet *B, const GLfloat *model );
+
+    ///
+    // cull() - test every sphere against a frustum
+    //
+    // @param f       - the frustum
+    // @param visible - set to one entry per sphere:  1 if any part of
+    //                  it may be inside the frustum, else 0
+    //
+    // @return the number of visible spheres
+    ///
+    size_t cull( const Frustum &f, vector<unsigned char> &visible ) const;
+
+    ///
+    // cull() - test some of the spheres against a frustum (different
+    //     ranges may be tested from different threads at once)
+    //
+    // @param f       - the frustum
+    // @param first   - the first sphere to test
+    // @param last    - one past the last sphere to test
+    // @param visible - one entry per sphere, of which entries
+    //                  first..last-1 are set as above
+    //
+    // @return the number of visible spheres in the range
+    ///
+    size_t cull( const Frustum &f, size_t first, size_t last,
+        unsigned char *visible ) const;
+
+    ///
+    // cullScalar() - cull() one sphere at a time, without SSE
+    //     (parameters and result as for cull())
+    ///
+    size_t cullScalar( const Frustum &f,
+        vector<unsigned char> &visible ) const;
+
+private:
+
+    ///
+    // cullRange() - the scalar test for spheres first..last-1
+    ///
+    size_t cullRange( const Frustum &f, size_t first, size_t last,
+        unsigned char *visible ) const;
+};
+
+#endif
@@ -0,0 +1,283 @@
+///
+//  GLState.cpp
+//
+//  A thin layer over the GL calls which change binding and uniform
+//  state, which skips calls that would change nothing.
+///
+
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "GLState.h"
+
+using namespace std;
+
+// stands for "we don't know what is bound"
+#define UNKNOWN         0xffffffffu
+
+// texture units we keep track of
+#define MAX_UNITS       32
+
+GLStateStats stateStats = { 0, 0, 0 };
+
+// current bindings
+static GLuint program = UNKNOWN;
+static GLuint vao = UNKNOWN;
+static GLuint arrayBuffer = UNKNOWN;
+static GLuint elementBuffer = UNKNOWN;
+static GLuint uniformBuffer = UNKNOWN;
+static GLenum activeUnit = UNKNOWN;
+static GLuint texture2D[MAX_UNITS];
+static bool texturesKnown = false;
+
+// uniform values, by program and then by location; each value is
+// stored as a tag for the kind of call that set it, then its bytes
+typedef map<GLint, vector<unsigned char> > UniformValues;
+static map<GLuint, UniformValues> uniforms;
+
+// the values for the current program, if it is known
+static UniformValues *current = NULL;
+
+///
+// stResetStats() - zero the counts
+///
+void stResetStats( void )
+{
+    stateStats.issued = stateStats.elided = stateStats.ignored = 0;
+}
+
+///
+// stInvalidate() - forget everything we know about the current state,
+//     so that the next call of each kind goes to GL
+///
+void stInvalidate( void )
+{
+    program = vao = UNKNOWN;
+    arrayBuffer = elementBuffer = uniformBuffer = UNKNOWN;
+    activeUnit = UNKNOWN;
+    texturesKnown = false;
+    uniforms.clear();
+    current = NULL;
+}
+
+///
+// count() - record whether a call went to GL
+//
+// @param changed - true if the call was issued
+//
+// @return changed
+///
+static bool count( bool changed )
+{
+    if( changed ) {
+        ++stateStats.issued;
+    } else {
+        ++stateStats.elided;
+    }
+    return changed;
+}
+
+///
+// Bindings
+///
+void stUseProgram( GLuint p )
+{
+    if( count(p != program) ) {
+        glUseProgram( p );
+        program = p;
+        current = &uniforms[p];
+    }
+}
+
+void stBindVertexArray( GLuint v )
+{
+    if( count(v != vao) ) {
+        glBindVertexArray( v );
+        vao = v;
+        // the element buffer binding belongs to the vertex array
+        elementBuffer = UNKNOWN;
+    }
+}
+
+///
+// binding(target) - where we keep track of a buffer binding point
+//
+// @return the cached binding, or NULL if we don't track this target
+///
+static GLuint *binding( GLenum target )
+{
+    switch( target ) {
+    case GL_ARRAY_BUFFER:           return &arrayBuffer;
+    case GL_ELEMENT_ARRAY_BUFFER:   return &elementBuffer;
+    case GL_UNIFORM_BUFFER:         return &uniformBuffer;
+    }
+    return NULL;
+}
+
+void stBindBuffer( GLenum target, GLuint buffer )
+{
+    GLuint *b = binding( target );
+    if( count(b == NULL || *b != buffer) ) {
+        glBindBuffer( target, buffer );
+        if( b != NULL ) {
+            *b = buffer;
+        }
+    }
+}
+
+void stBindBufferBase( GLenum target, GLuint index, GLuint buffer )
+{
+    // indexed bindings aren't tracked, but this also sets the
+    // target's general binding
+    count( true );
+    glBindBufferBase( target, index, buffer );
+    GLuint *b = binding( target );
+    if( b != NULL ) {
+        *b = buffer;
+    }
+}
+
+void stActiveTexture( GLenum unit )
+{
+    if( count(unit != activeUnit) ) {
+        glActiveTexture( unit );
+        activeUnit = unit;
+    }
+}
+
+void stBindTexture( GLenum target, GLuint texture )
+{
+    GLuint unit = activeUnit - GL_TEXTURE0;
+    bool tracked = target == GL_TEXTURE_2D && activeUnit != UNKNOWN &&
+        unit < MAX_UNITS;
+
+    if( tracked && !texturesKnown ) {
+        for( int i = 0; i < MAX_UNITS; ++i ) {
+            texture2D[i] = UNKNOWN;
+        }
+        texturesKnown = true;
+    }
+
+    if( count(!tracked || texture2D[unit] != texture) ) {
+        glBindTexture( target, texture );
+        if( tracked ) {
+            texture2D[unit] = texture;
+        }
+    }
+}
+
+///
+// Deletion
+///
+void stDeleteBuffers( GLsizei n, const GLuint *buffers )
+{
+    count( true );
+    glDeleteBuffers( n, buffers );
+
+    // deleting a bound buffer unbinds it
+    for( GLsizei i = 0; i < n; ++i ) {
+        if( arrayBuffer == buffers[i] ) {
+            arrayBuffer = 0;
+        }
+        if( uniformBuffer == buffers[i] ) {
+            uniformBuffer = 0;
+        }
+        if( elementBuffer == buffers[i] ) {
+            elementBuffer = 0;
+        }
+    }
+}
+
+void stDeleteVertexArrays( GLsizei n, const GLuint *vaos )
+{
+    count( true );
+    glDeleteVertexArrays( n, vaos );
+
+    for( GLsizei i = 0; i < n; ++i ) {
+        if( vao == vaos[i] ) {
+            vao = 0;
+            elementBuffer = UNKNOWN;
+        }
+    }
+}
+
+///
+// changed(loc,kind,data,size) - record a uniform value for the current
+//     program
+//
+// @return true if the value differs from the one we had (or we don't
+//     know the current program), so the call must be made
+///
+static bool changed( GLint loc, unsigned char kind, const void *data,
+    size_t size )
+{
+    if( loc < 0 ) {
+        // GL would ignore it anyway; this is no saving of ours
+        ++stateStats.ignored;
+        return false;
+    }
+    if( current == NULL ) {
+        return count( true );
+    }
+
+    vector<unsigned char> &v = (*current)[loc];
+    if( v.size() == size + 1 && v[0] == kind &&
+        memcmp(&v[1], data, size) == 0 ) {
+        return count( false );
+    }
+
+    v.resize( size + 1 );
+    v[0] = kind;
+    memcpy( &v[1], data, size );
+    return count( true );
+}
+
+///
+// Uniforms
+///
+void stUniform1i( GLint loc, GLint v )
+{
+    if( changed(loc, 1, &v, sizeof(v)) ) {
+        glUniform1i( loc, v );
+    }
+}
+
+void stUniform1f( GLint loc, GLfloat v )
+{
+    if( changed(loc, 2, &v, sizeof(v)) ) {
+        glUniform1f( loc, v );
+    }
+}
+
+void stUniform3fv( GLint loc, GLsizei n, const GLfloat *v )
+{
+    if( changed(loc, 3, v, n * 3 * sizeof(GLfloat)) ) {
+        glUniform3fv( loc, n, v );
+    }
+}
+
+void stUniform4fv( GLint loc, GLsizei n, const GLfloat *v )
+{
+    if( changed(loc, 4, v, n * 4 * sizeof(GLfloat)) ) {
+        glUniform4fv( loc, n, v );
+    }
+}
+
+void stUniformMatrix3fv( GLint loc, GLsizei n, GLboolean transpose,
+    const GLfloat *v )
+{
+    unsigned char kind = transpose ? 6 : 5;
+    if( changed(loc, kind, v, n * 9 * sizeof(GLfloat)) ) {
+        glUniformMatrix3fv( loc, n, transpose, v );
+    }
+}
+
+void stUniformMatrix4fv( GLint loc, GLsizei n, GLboolean transpose,
+    const GLfloat *v )
+{
+    unsigned char kind = transpose ? 8 : 7;
+    if( changed(loc, kind, v, n * 16 * sizeof(GLfloat)) ) {
+        glUniformMatrix4fv( loc, n, transpose, v );
+    }
+}
@@ -0,0 +1,83 @@
+///
+//  GLState.h
+//
+//  A thin layer over the GL calls which change binding and uniform
+//  state.  Each function remembers what it last set and skips the GL
+//  call when asked to set the same thing again.
+//
+//  This only works if every change to that state goes through these
+//  functions.  Code which changes it behind their back (e.g., a
+//  library which binds its own textures) must call stInvalidate()
+//  afterward.
+///
+
+#ifndef _GLSTATE_H_
+#define _GLSTATE_H_
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
+#ifndef __APPLE__
+#include <GL/glew.h>
+#endif
+
+#include <GLFW/glfw3.h>
+#endif
+
+///
+// Counts of calls made through this layer
+///
+typedef struct st_glstats {
+    long issued;        // passed on to GL
+    long elided;        // dropped, because they would change nothing
+    long ignored;       // dropped, for a uniform the program lacks
+} GLStateStats;
+
+extern GLStateStats stateStats;
+
+///
+// stResetStats() - zero the counts
+///
+void stResetStats( void );
+
+///
+// stInvalidate() - forget everything we know about the current state,
+//     so that the next call of each kind goes to GL
+///
+void stInvalidate( void );
+
+///
+// Bindings
+///
+void stUseProgram( GLuint program );
+void stBindVertexArray( GLuint vao );
+void stBindBuffer( GLenum target, GLuint buffer );
+void stBindBufferBase( GLenum target, GLuint index, GLuint buffer );
+void stActiveTexture( GLenum unit );
+void stBindTexture( GLenum target, GLuint texture );
+
+///
+// Deletion (deleted objects are unbound, so we must know about it)
+///
+void stDeleteBuffers( GLsizei n, const GLuint *buffers );
+void stDeleteVertexArrays( GLsizei n, const GLuint *vaos );
+
+///
+// Uniforms of the current program (locations of -1 are ignored, as
+// GL itself would, and counted as such rather than as elided)
+///
+void stUniform1i( GLint loc, GLint v );
+void stUniform1f( GLint loc, GLfloat v );
+void stUniform3fv( GLint loc, GLsizei count, const GLfloat *v );
+void stUniform4fv( GLint loc, GLsizei count, const GLfloat *v );
+void stUniformMatrix3fv( GLint loc, GLsizei count, GLboolean transpose,
+    const GLfloat *v );
+void stUniformMatrix4fv( GLint loc, GLsizei count, GLboolean transpose,
+    const GLfloat *v );
+
+#endif
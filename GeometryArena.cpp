@@ -0,0 +1,314 @@
+///
+//  GeometryArena.cpp
+//
+//  One vertex buffer and one element buffer shared by many static
+//  meshes.
+///
+
+#include <cstring>
+
+#include "GeometryArena.h"
+#include "Buffers.h"
+#include "GLState.h"
+
+///
+// Constructor
+///
+GeometryArena::GeometryArena( void ) :
+    vbuffer(0), ebuffer(0), vertexCapacity(0), indexCapacity(0),
+    vertexTop(0), indexTop(0), vertexHoles(0), indexHoles(0),
+    compactions(0) {
+}
+
+///
+// add() - copy a mesh into the arena
+//
+// @param pts      - vertex locations (XYZW)
+// @param norms    - normals (XYZ), if any
+// @param tex      - texture coordinates (UV), if any
+// @param elements - the indices, relative to the mesh's vertices
+// @param count    - the number of indices
+//
+// @return the mesh's handle
+///
+int GeometryArena::add( AttribView pts, AttribView norms, AttribView tex,
+    const GLuint *elements, GLsizei count ) {
+
+    GLsizei vertices = (GLsizei) (pts.count / 4);
+
+    // make room at the end:  compacting may be enough, but if not,
+    // double the buffers until it is
+    if( vertexTop + vertices > vertexCapacity ||
+        indexTop + count > indexCapacity ) {
+        GLsizei vcap = vertexCapacity > 0 ? vertexCapacity : ARENA_VERTICES;
+        GLsizei icap = indexCapacity > 0 ? indexCapacity : ARENA_INDICES;
+        while( vertexTop - vertexHoles + vertices > vcap ) {
+            vcap *= 2;
+        }
+        while( indexTop - indexHoles + count > icap ) {
+            icap *= 2;
+        }
+        rebuild( vcap, icap );
+    }
+
+    ArenaMesh m;
+    m.baseVertex = vertexTop;
+    m.firstIndex = (GLuint) indexTop;
+    m.count = count;
+    m.vertices = vertices;
+    m.live = true;
+
+    vertexTop += vertices;
+    indexTop += count;
+
+    // build the vertices in the arena's format
+    vector<float> data( (size_t) vertices * ARENA_FLOATS, 0.0f );
+    for( GLsizei i = 0; i < vertices; ++i ) {
+        float *dst = &data[(size_t) i * ARENA_FLOATS];
+        memcpy( dst, pts.data + 4 * i, 3 * sizeof(float) );
+        if( norms.data != NULL ) {
+            memcpy( dst + 3, norms.data + 3 * i, 3 * sizeof(float) );
+        }
+        if( tex.data != NULL ) {
+            memcpy( dst + 6, tex.data + 2 * i, 2 * sizeof(float) );
+        }
+    }
+
+    // keep the element buffer binding out of whatever vertex array
+    // object happens to be bound
+    stBindVertexArray( 0 );
+
+    stBindBuffer( GL_ARRAY_BUFFER, vbuffer );
+    glBufferSubData( GL_ARRAY_BUFFER, (GLintptr) m.baseVertex * ARENA_STRIDE,
+        (GLsizeiptr) vertices * ARENA_STRIDE, &data[0] );
+    stBindBuffer( GL_ELEMENT_ARRAY_BUFFER, ebuffer );
+    glBufferSubData( GL_ELEMENT_ARRAY_BUFFER,
+        (GLintptr) m.firstIndex * sizeof(GLuint),
+        (GLsizeiptr) count * sizeof(GLuint), elements );
+
+    // reuse a released mesh's handle if there is one
+    if( !freeHandles.empty() ) {
+        int handle = freeHandles.back();
+        freeHandles.pop_back();
+        meshes[handle] = m;
+        return handle;
+    }
+
+    meshes.push_back( m );
+    return (int) meshes.size() - 1;
+}
+
+///
+// release() - give a mesh's space back (compacting the arena if
+//     enough has been given back)
+//
+// @param handle - as returned by add()
+///
+void GeometryArena::release( int handle ) {
+
+    ArenaMesh &m = meshes[handle];
+    if( !m.live ) {
+        return;
+    }
+    m.live = false;
+    freeHandles.push_back( handle );
+
+    // the most recently added mesh can just be taken off the end
+    if( m.baseVertex + m.vertices == vertexTop &&
+        (GLsizei) m.firstIndex + m.count == indexTop ) {
+        vertexTop -= m.vertices;
+        indexTop -= m.count;
+    } else {
+        vertexHoles += m.vertices;
+        indexHoles += m.count;
+    }
+
+    // compact once there is more hole than mesh
+    if( 2 * vertexHoles > vertexTop || 2 * indexHoles > indexTop ) {
+        compact();
+    }
+}
+
+///
+// compact() - move the live meshes together, removing the holes
+//     left by released ones
+///
+void GeometryArena::compact( void ) {
+
+    if( vertexHoles == 0 && indexHoles == 0 ) {
+        return;
+    }
+
+    rebuild( vertexCapacity, indexCapacity );
+}
+
+///
+// rebuild() - move the live meshes, packed together, into new buffers
+//     of the given sizes (the first time, just create the buffers)
+///
+void GeometryArena::rebuild( GLsizei vertices, GLsizei indices ) {
+
+    GLuint vnew, enew;
+
+    stBindVertexArray( 0 );
+
+    glGenBuffers( 1, &vnew );
+    stBindBuffer( GL_ARRAY_BUFFER, vnew );
+    glBufferData( GL_ARRAY_BUFFER, (GLsizeiptr) vertices * ARENA_STRIDE,
+        NULL, GL_STATIC_DRAW );
+
+    glGenBuffers( 1, &enew );
+    stBindBuffer( GL_ELEMENT_ARRAY_BUFFER, enew );
+    glBufferData( GL_ELEMENT_ARRAY_BUFFER,
+        (GLsizeiptr) indices * sizeof(GLuint), NULL, GL_STATIC_DRAW );
+
+    // the copies stay on the GPU; indices are relative to their mesh's
+    // base vertex, so they are copied unchanged
+    GLsizei vtop = 0, itop = 0;
+    for( size_t i = 0; i < meshes.size(); ++i ) {
+        ArenaMesh &m = meshes[i];
+        if( !m.live ) {
+            continue;
+        }
+
+        stBindBuffer( GL_COPY_READ_BUFFER, vbuffer );
+        stBindBuffer( GL_COPY_WRITE_BUFFER, vnew );
+        glCopyBufferSubData( GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+            (GLintptr) m.baseVertex * ARENA_STRIDE,
+            (GLintptr) vtop * ARENA_STRIDE,
+            (GLsizeiptr) m.vertices * ARENA_STRIDE );
+
+        stBindBuffer( GL_COPY_READ_BUFFER, ebuffer );
+        stBindBuffer( GL_COPY_WRITE_BUFFER, enew );
+        glCopyBufferSubData( GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+            (GLintptr) m.firstIndex * sizeof(GLuint),
+            (GLintptr) itop * sizeof(GLuint),
+            (GLsizeiptr) m.count * sizeof(GLuint) );
+
+        m.baseVertex = vtop;
+        m.firstIndex = (GLuint) itop;
+        vtop += m.vertices;
+        itop += m.count;
+    }
+
+    if( vbuffer != 0 ) {
+        stDeleteBuffers( 1, &vbuffer );
+        stDeleteBuffers( 1, &ebuffer );
+        ++compactions;
+    }
+
+    // the vertex arrays point at the old buffers
+    deleteArrays();
+
+    vbuffer = vnew;
+    ebuffer = enew;
+    vertexCapacity = vertices;
+    indexCapacity = indices;
+    vertexTop = vtop;
+    indexTop = itop;
+    vertexHoles = indexHoles = 0;
+}
+
+///
+// mesh() - where a mesh currently is
+//
+// @param handle - as returned by add()
+///
+const ArenaMesh &GeometryArena::mesh( int handle ) const {
+    return meshes[handle];
+}
+
+///
+// deleteArrays() - delete the vertex array objects built by select()
+///
+void GeometryArena::deleteArrays( void ) {
+    for( size_t i = 0; i < vaos.size(); ++i ) {
+        stDeleteVertexArrays( 1, &vaos[i].vao );
+    }
+    vaos.clear();
+}
+
+///
+// select() - bind the vertex array object for the arena, building
+//     it the first time
+//
+// @param program - GLSL program object
+// @param vp      - name of the position attribute variable
+// @param vn      - name of the normal attribute variable (or NULL)
+// @param vt      - name of the texture coord attribute variable (or NULL)
+//
+// @return the number of GL calls made
+///
+int GeometryArena::select( GLuint program,
+    const char *vp, const char *vn, const char *vt ) {
+
+    for( size_t i = 0; i < vaos.size(); ++i ) {
+        const VaoEntry &e = vaos[i];
+        if( e.program == program && e.vp == vp && e.vn == vn &&
+            e.vt == vt ) {
+            stBindVertexArray( vaos[i].vao );
+            return 1;
+        }
+    }
+
+    VaoEntry entry;
+    entry.program = program;
+    entry.vp = vp;
+    entry.vn = vn;
+    entry.vt = vt;
+    glGenVertexArrays( 1, &entry.vao );
+    stBindVertexArray( entry.vao );
+
+    stBindBuffer( GL_ARRAY_BUFFER, vbuffer );
+    stBindBuffer( GL_ELEMENT_ARRAY_BUFFER, ebuffer );
+    int calls = 4;
+
+    // positions are XYZ only; the shader supplies W = 1
+    GLint vPosition = glGetAttribLocation( program, vp );
+    glEnableVertexAttribArray( vPosition );
+    glVertexAttribPointer( vPosition, 3, GL_FLOAT, GL_FALSE, ARENA_STRIDE,
+        BUFFER_OFFSET(0) );
+    calls += 3;
+
+    if( vn != NULL ) {
+        GLint vNormal = glGetAttribLocation( program, vn );
+        glEnableVertexAttribArray( vNormal );
+        glVertexAttribPointer( vNormal, 3, GL_FLOAT, GL_FALSE, ARENA_STRIDE,
+            BUFFER_OFFSET(3 * sizeof(float)) );
+        calls += 3;
+    }
+
+    if( vt != NULL ) {
+        GLint vTexCoord = glGetAttribLocation( program, vt );
+        glEnableVertexAttribArray( vTexCoord );
+        glVertexAttribPointer( vTexCoord, 2, GL_FLOAT, GL_FALSE,
+            ARENA_STRIDE, BUFFER_OFFSET(6 * sizeof(float)) );
+        calls += 3;
+    }
+
+    vaos.push_back( entry );
+    return calls;
+}
+
+///
+// draw() - draw several meshes with one call
+//
+// @param handles - the meshes
+// @param n       - how many of them
+///
+void GeometryArena::draw( const int *handles, int n ) {
+
+    drawCounts.resize( n );
+    drawOffsets.resize( n );
+    drawBases.resize( n );
+
+    for( int i = 0; i < n; ++i ) {
+        const ArenaMesh &m = meshes[handles[i]];
+        drawCounts[i] = m.count;
+        drawOffsets[i] = BUFFER_OFFSET(m.firstIndex * sizeof(GLuint));
+        drawBases[i] = m.baseVertex;
+    }
+
+    glMultiDrawElementsBaseVertex( GL_TRIANGLES, drawCounts.data(),
+        GL_UNSIGNED_INT, drawOffsets.data(), n, drawBases.data() );
+}
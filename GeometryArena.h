@@ -0,0 +1,184 @@
+///
+//  GeometryArena.h
+//
+//  One vertex buffer and one element buffer shared by many static
+//  meshes.
+//
+//  Each mesh added is given a contiguous run of vertices and of
+//  indices, and is then described by a small handle:  where its
+//  vertices start (the base vertex, added to every index by
+//  glDrawElementsBaseVertex()), where its indices start, and how
+//  many of them there are.  The indices themselves are relative to
+//  the mesh's first vertex, so a mesh can be moved without touching
+//  them.
+//
+//  Because every mesh in the arena shares the same buffers and the
+//  same vertex format, they also share their vertex array objects:
+//  going from one mesh to another needs no binding at all, and any
+//  number of them can be drawn with one glMultiDrawElementsBaseVertex()
+//  call.
+//
+//  Released meshes leave holes; once the holes add up to more than
+//  the space in use, the arena compacts itself by copying the live
+//  meshes, on the GPU, into fresh buffers.  Handles stay valid across
+//  a compaction (their offsets change, which is why users look them
+//  up rather than keep copies).
+///
+
+#ifndef _GEOMETRYARENA_H_
+#define _GEOMETRYARENA_H_
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
+#ifndef __APPLE__
+#include <GL/glew.h>
+#endif
+
+#include <GLFW/glfw3.h>
+#endif
+
+#include <vector>
+
+#include "Canvas.h"
+
+using namespace std;
+
+///
+// Every vertex in the arena is XYZ location, XYZ normal and UV, as
+// floats; meshes without normals or (u,v) data get zeros
+///
+#define ARENA_FLOATS            8
+#define ARENA_STRIDE            (ARENA_FLOATS * sizeof(float))
+
+///
+// Initial capacities (vertices and indices); both double as needed
+///
+#define ARENA_VERTICES          (64 * 1024)
+#define ARENA_INDICES           (256 * 1024)
+
+///
+// Where one mesh lives in the arena
+///
+typedef
+    struct st_arenamesh {
+        GLint baseVertex;       // first vertex (added to every index)
+        GLuint firstIndex;      // first index
+        GLsizei count;          // number of indices
+        GLsizei vertices;       // number of vertices
+        bool live;              // false once released
+    } ArenaMesh;
+
+///
+// The arena
+///
+class GeometryArena {
+
+public:
+
+    // the shared buffers (0 until the first mesh is added)
+    GLuint vbuffer, ebuffer;
+
+    // space in the buffers, in vertices and in indices
+    GLsizei vertexCapacity, indexCapacity;
+
+    // space handed out so far (meshes are added at the end), and how
+    // much of that belongs to released meshes
+    GLsizei vertexTop, indexTop;
+    GLsizei vertexHoles, indexHoles;
+
+    // number of times the arena has been compacted or grown
+    long compactions;
+
+    ///
+    // Constructor
+    ///
+    GeometryArena( void );
+
+    ///
+    // add() - copy a mesh into the arena
+    //
+    // @param pts      - vertex locations (XYZW)
+    // @param norms    - normals (XYZ), if any
+    // @param tex      - texture coordinates (UV), if any
+    // @param elements - the indices, relative to the mesh's vertices
+    // @param count    - the number of indices
+    //
+    // @return the mesh's handle
+    ///
+    int add( AttribView pts, AttribView norms, AttribView tex,
+        const GLuint *elements, GLsizei count );
+
+    ///
+    // release() - give a mesh's space back (compacting the arena if
+    //     enough has been given back)
+    //
+    // @param handle - as returned by add()
+    ///
+    void release( int handle );
+
+    ///
+    // compact() - move the live meshes together, removing the holes
+    //     left by released ones
+    ///
+    void compact( void );
+
+    ///
+    // mesh() - where a mesh currently is
+    //
+    // @param handle - as returned by add()
+    ///
+    const ArenaMesh &mesh( int handle ) const;
+
+    ///
+    // select() - bind the vertex array object for the arena, building
+    //     it the first time (as BufferSet::selectBuffers() does; the
+    //     names are matched by address, so they must be literals)
+    //
+    // @param program - GLSL program object
+    // @param vp      - name of the position attribute variable
+    // @param vn      - name of the normal attribute variable (or NULL)
+    // @param vt      - name of the texture coord attribute variable (or NULL)
+    //
+    // @return the number of GL calls made
+    ///
+    int select( GLuint program,
+        const char *vp, const char *vn, const char *vt );
+
+    ///
+    // draw() - draw several meshes with one call, using whatever
+    //     program, uniforms and vertex arrays are current
+    //
+    // @param handles - the meshes
+    // @param n       - how many of them
+    ///
+    void draw( const int *handles, int n );
+
+private:
+
+    vector<ArenaMesh> meshes;
+    vector<int> freeHandles;
+
+    // keyed by the attribute names' addresses, as in BufferSet
+    struct VaoEntry {
+        GLuint program;
+        const char *vp, *vn, *vt;
+        GLuint vao;
+    };
+    vector<VaoEntry> vaos;
+
+    // scratch space for draw()
+    vector<GLsizei> drawCounts;
+    vector<const GLvoid *> drawOffsets;
+    vector<GLint> drawBases;
+
+    void rebuild( GLsizei vertices, GLsizei indices );
+    void deleteArrays( void );
+};
+
+#endif
@@ -0,0 +1,206 @@
+///
+//  Headless.cpp
+//
+//  Offscreen rendering support for machines without a display.
+//
+//  This file is only compiled into HEADLESS builds.
+///
+
+#if defined(HEADLESS)
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include "Headless.h"
+
+using namespace std;
+
+// EGL state
+static EGLDisplay display = EGL_NO_DISPLAY;
+static EGLContext context = EGL_NO_CONTEXT;
+
+// offscreen framebuffer and its attachments
+static GLuint fbo, colorRB, depthRB;
+static int fbWidth, fbHeight;
+
+///
+// headlessInit(w,h) - create the EGL context and the offscreen
+//     framebuffer, and make both current
+//
+// @param w - width of the framebuffer, in pixels
+// @param h - height of the framebuffer, in pixels
+//
+// @return true on success, else false (after printing a message)
+///
+bool headlessInit( int w, int h )
+{
+    // prefer the surfaceless platform; fall back to the default display
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC)
+            eglGetProcAddress( "eglGetPlatformDisplayEXT" );
+    if( getPlatformDisplay != NULL ) {
+        display = getPlatformDisplay( EGL_PLATFORM_SURFACELESS_MESA,
+            EGL_DEFAULT_DISPLAY, NULL );
+    }
+    if( display == EGL_NO_DISPLAY ) {
+        display = eglGetDisplay( EGL_DEFAULT_DISPLAY );
+    }
+
+    EGLint major, minor;
+    if( display == EGL_NO_DISPLAY ||
+        !eglInitialize(display, &major, &minor) ) {
+        cerr << "EGL: cannot initialize display" << endl;
+        return false;
+    }
+
+    if( !eglBindAPI(EGL_OPENGL_API) ) {
+        cerr << "EGL: desktop OpenGL not supported" << endl;
+        return false;
+    }
+
+    // we never render to an EGL surface, so any GL-capable config will do
+    EGLint configAttribs[] = {
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+    EGLConfig config;
+    EGLint numConfigs = 0;
+    eglChooseConfig( display, configAttribs, &config, 1, &numConfigs );
+    if( numConfigs < 1 ) {
+        // EGL_KHR_no_config_context
+        config = (EGLConfig) 0;
+    }
+
+    context = eglCreateContext( display, config, EGL_NO_CONTEXT, NULL );
+    if( context == EGL_NO_CONTEXT ) {
+        cerr << "EGL: context creation failed, error 0x" << hex <<
+            eglGetError() << dec << endl;
+        return false;
+    }
+
+    if( !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context) ) {
+        cerr << "EGL: cannot make surfaceless context current" << endl;
+        return false;
+    }
+
+    cerr << "EGL " << major << "." << minor << ": " <<
+        glGetString( GL_RENDERER ) << ", " << glGetString( GL_VERSION ) << endl;
+
+    // the shaders are GLSL 1.40, with uniform blocks (3.1), and every
+    // mesh is drawn with a base vertex (3.2)
+    int glMajor = 0, glMinor = 0;
+    const char *version = (const char *) glGetString( GL_VERSION );
+    if( version == NULL ||
+        sscanf(version, "%d.%d", &glMajor, &glMinor) != 2 ||
+        glMajor < 3 || (glMajor == 3 && glMinor < 1) ) {
+        cerr << "EGL: OpenGL 3.1 (GLSL 1.40, uniform buffers) "
+            "not available" << endl;
+        return false;
+    }
+    if( glMajor == 3 && glMinor == 1 ) {
+        bool baseVertex = false;
+        GLint n = 0;
+        glGetIntegerv( GL_NUM_EXTENSIONS, &n );
+        for( GLint i = 0; i < n && !baseVertex; ++i ) {
+            const char *ext = (const char *) glGetStringi( GL_EXTENSIONS, i );
+            baseVertex = ext != NULL &&
+                !strcmp( ext, "GL_ARB_draw_elements_base_vertex" );
+        }
+        if( !baseVertex ) {
+            cerr << "EGL: OpenGL 3.2 (or ARB_draw_elements_base_vertex) "
+                "not available" << endl;
+            return false;
+        }
+    }
+
+    // now, the framebuffer we will actually draw into
+    fbWidth = w;
+    fbHeight = h;
+
+    glGenRenderbuffers( 1, &colorRB );
+    glBindRenderbuffer( GL_RENDERBUFFER, colorRB );
+    glRenderbufferStorage( GL_RENDERBUFFER, GL_RGBA8, w, h );
+
+    glGenRenderbuffers( 1, &depthRB );
+    glBindRenderbuffer( GL_RENDERBUFFER, depthRB );
+    glRenderbufferStorage( GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, w, h );
+
+    glGenFramebuffers( 1, &fbo );
+    glBindFramebuffer( GL_FRAMEBUFFER, fbo );
+    glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+        GL_RENDERBUFFER, colorRB );
+    glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+        GL_RENDERBUFFER, depthRB );
+
+    if( glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE ) {
+        cerr << "offscreen framebuffer is incomplete" << endl;
+        return false;
+    }
+
+    // there is no window to set this up for us
+    glViewport( 0, 0, w, h );
+
+    return true;
+}
+
+///
+// headlessWriteFrame(name) - read back the current contents of the
+//     offscreen framebuffer and write them as a binary PPM file
+//
+// @param name - name of the file to be written
+//
+// @return true on success, else false
+///
+bool headlessWriteFrame( const char *name )
+{
+    vector<unsigned char> pixels( fbWidth * fbHeight * 3 );
+
+    glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+    glReadPixels( 0, 0, fbWidth, fbHeight, GL_RGB, GL_UNSIGNED_BYTE,
+        &pixels[0] );
+
+    FILE *fp = fopen( name, "wb" );
+    if( fp == NULL ) {
+        cerr << "cannot write frame '" << name << "'" << endl;
+        return false;
+    }
+
+    fprintf( fp, "P6\n%d %d\n255\n", fbWidth, fbHeight );
+
+    // GL rows run bottom to top; PPM rows run top to bottom
+    int rowSize = fbWidth * 3;
+    for( int row = fbHeight - 1; row >= 0; --row ) {
+        fwrite( &pixels[row * rowSize], 1, rowSize, fp );
+    }
+
+    fclose( fp );
+
+    return true;
+}
+
+///
+// headlessFinish() - release the framebuffer and the EGL context
+///
+void headlessFinish( void )
+{
+    if( context != EGL_NO_CONTEXT ) {
+        glDeleteFramebuffers( 1, &fbo );
+        glDeleteRenderbuffers( 1, &colorRB );
+        glDeleteRenderbuffers( 1, &depthRB );
+        eglMakeCurrent( display, EGL_NO_SURFACE, EGL_NO_SURFACE,
+            EGL_NO_CONTEXT );
+        eglDestroyContext( display, context );
+        context = EGL_NO_CONTEXT;
+    }
+    if( display != EGL_NO_DISPLAY ) {
+        eglTerminate( display );
+        display = EGL_NO_DISPLAY;
+    }
+}
+
+#endif
@@ -0,0 +1,53 @@
+///
+//  Headless.h
+//
+//  Offscreen rendering support for machines without a display.
+//
+//  When the program is built with HEADLESS defined, no GLFW window
+//  is created; instead, an EGL context is made current without any
+//  surface (EGL_MESA_platform_surfaceless, which works with software
+//  drivers such as llvmpipe), and all drawing goes to a framebuffer
+//  object of the requested size.  Frames can be read back and written
+//  out as binary PPM files.
+//
+//  HEADLESS builds take their GL entry points directly from libOpenGL,
+//  so GL_GLEXT_PROTOTYPES must also be defined when compiling.
+///
+
+#ifndef _HEADLESS_H_
+#define _HEADLESS_H_
+
+#if defined(HEADLESS)
+
+#include <GL/gl.h>
+#include <GL/glext.h>
+
+///
+// headlessInit(w,h) - create the EGL context and the offscreen
+//     framebuffer, and make both current
+//
+// @param w - width of the framebuffer, in pixels
+// @param h - height of the framebuffer, in pixels
+//
+// @return true on success, else false (after printing a message)
+///
+bool headlessInit( int w, int h );
+
+///
+// headlessWriteFrame(name) - read back the current contents of the
+//     offscreen framebuffer and write them as a binary PPM file
+//
+// @param name - name of the file to be written
+//
+// @return true on success, else false
+///
+bool headlessWriteFrame( const char *name );
+
+///
+// headlessFinish() - release the framebuffer and the EGL context
+///
+void headlessFinish( void );
+
+#endif
+
+#endif
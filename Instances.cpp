@@ -0,0 +1,176 @@
+///
+//  Instances.cpp
+//
+//  Per-instance data for drawing many copies of one mesh with a single
+//  glDrawElementsInstanced() call.
+///
+
+#include <cstddef>
+#include <cstring>
+
+#include "Instances.h"
+#include "Viewing.h"
+#include "GLState.h"
+
+///
+// Constructor
+//
+// @param B - the mesh to be instanced
+///
+InstanceSet::InstanceSet( BufferSet *B ) :
+    buffers(B), ibuffer(0), source(0), sourceOffset(0), uploaded(0) {
+}
+
+///
+// clear() - discard all the instances
+///
+void InstanceSet::clear( void ) {
+    instances.clear();
+}
+
+///
+// add() - add an instance
+//
+// @param material - material id
+// @param scale    - scale factors for each axis
+// @param rotate   - rotation angles around the three axes, in degrees
+// @param xlate    - amount of translation along each axis
+///
+void InstanceSet::add( int material, Tuple scale, Tuple rotate,
+    Tuple xlate ) {
+
+    InstanceData inst;
+
+    modelMatrix( scale, rotate, xlate, inst.model );
+    normalMatrix( inst.model, inst.normal );
+    buffers->positionTransform( inst.model );
+    inst.material = material;
+
+    instances.push_back( inst );
+}
+
+///
+// cull() - discard the instances which are outside a view frustum
+//
+// @param f - the frustum
+//
+// @return the number of instances discarded
+///
+int InstanceSet::cull( const Frustum &f ) {
+
+    SphereSet spheres;
+    vector<unsigned char> visible;
+
+    for( size_t i = 0; i < instances.size(); ++i ) {
+        spheres.add( buffers, instances[i].model );
+    }
+
+    if( spheres.cull(f, visible) == instances.size() ) {
+        return 0;
+    }
+
+    // keep the visible ones, in their original order
+    size_t kept = 0;
+    for( size_t i = 0; i < instances.size(); ++i ) {
+        if( visible[i] ) {
+            instances[kept++] = instances[i];
+        }
+    }
+
+    int culled = (int) (instances.size() - kept);
+    instances.resize( kept );
+    return culled;
+}
+
+///
+// upload() - copy the instances into the instance buffer
+//
+// @param ring - if not NULL, copy them into this ring buffer's
+//               current section instead (a memory write)
+///
+void InstanceSet::upload( RingBuffer *ring ) {
+
+    GLsizeiptr size = instances.size() * sizeof(InstanceData);
+
+    uploaded = (int) instances.size();
+
+    if( ring != NULL ) {
+        void *dst = ring->alloc( size, &sourceOffset );
+        if( dst != NULL ) {
+            memcpy( dst, instances.data(), size );
+            source = ring->buffer;
+            return;
+        }
+        // no room; use our own buffer after all
+    }
+
+    if( ibuffer == 0 ) {
+        glGenBuffers( 1, &ibuffer );
+    }
+
+    // the buffer keeps its name, so vertex array objects which refer
+    // to it stay valid; glBufferData() just replaces the storage
+    stBindBuffer( GL_ARRAY_BUFFER, ibuffer );
+    glBufferData( GL_ARRAY_BUFFER, size, instances.data(), GL_STREAM_DRAW );
+
+    source = ibuffer;
+    sourceOffset = 0;
+}
+
+///
+// select() - set up the per-instance attribute variables in the
+//     currently-bound vertex array object
+//
+// @param program - GLSL program object
+// @param vm      - name of the model matrix attribute variable
+// @param vn      - name of the normal matrix attribute variable
+// @param vmat    - name of the material id attribute variable
+///
+void InstanceSet::select( GLuint program,
+    const char *vm, const char *vn, const char *vmat ) {
+    selectRecords( program, source, sourceOffset, vm, vn, vmat );
+}
+
+///
+// selectRecords() - set up the per-instance attribute variables in the
+//     currently-bound vertex array object to read InstanceData records
+//
+// @param program - GLSL program object
+// @param buffer  - the buffer holding the records
+// @param offset  - where in the buffer the first record is
+// @param vm      - name of the model matrix attribute variable
+// @param vn      - name of the normal matrix attribute variable
+// @param vmat    - name of the material id attribute variable
+///
+void selectRecords( GLuint program, GLuint buffer, GLintptr offset,
+    const char *vm, const char *vn, const char *vmat ) {
+
+    GLsizei stride = sizeof(InstanceData);
+
+    stBindBuffer( GL_ARRAY_BUFFER, buffer );
+
+    // matrix attributes take one location per column
+    GLint vModel = glGetAttribLocation( program, vm );
+    for( int c = 0; c < 4; ++c ) {
+        glEnableVertexAttribArray( vModel + c );
+        glVertexAttribPointer( vModel + c, 4, GL_FLOAT, GL_FALSE, stride,
+            BUFFER_OFFSET(offset + offsetof(InstanceData, model) +
+                c * 4 * sizeof(GLfloat)) );
+        glVertexAttribDivisor( vModel + c, 1 );
+    }
+
+    GLint vNormal = glGetAttribLocation( program, vn );
+    for( int c = 0; c < 3; ++c ) {
+        glEnableVertexAttribArray( vNormal + c );
+        glVertexAttribPointer( vNormal + c, 3, GL_FLOAT, GL_FALSE, stride,
+            BUFFER_OFFSET(offset + offsetof(InstanceData, normal) +
+                c * 3 * sizeof(GLfloat)) );
+        glVertexAttribDivisor( vNormal + c, 1 );
+    }
+
+    GLint vMaterial = glGetAttribLocation( program, vmat );
+    glEnableVertexAttribArray( vMaterial );
+    glVertexAttribIPointer( vMaterial, 1, GL_INT, stride,
+        BUFFER_OFFSET(offset + offsetof(InstanceData, material)) );
+    glVertexAttribDivisor( vMaterial, 1 );
+}
@@ -0,0 +1,137 @@
+///
+//  Instances.h
+//
+//  Per-instance data for drawing many copies of one mesh with a single
+//  glDrawElementsInstanced() call.
+//
+//  Each instance carries its own model matrix, normal matrix, and
+//  material id.  The matrices are in world space, so the instance data
+//  does not change when the camera moves.
+///
+
+#ifndef _INSTANCES_H_
+#define _INSTANCES_H_
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
+#ifndef __APPLE__
+#include <GL/glew.h>
+#endif
+
+#include <GLFW/glfw3.h>
+#endif
+
+#include <vector>
+
+#include "Buffers.h"
+#include "Culling.h"
+#include "RingBuffer.h"
+#include "Tuple.h"
+
+using namespace std;
+
+///
+// The data for one instance, as stored in the instance buffer
+///
+typedef struct st_instance {
+    GLfloat model[16];      // model matrix, column-major
+    GLfloat normal[9];      // normal matrix, column-major
+    GLint material;         // material id (see Lighting.h)
+} InstanceData;
+
+///
+// Information about the instances of one mesh
+///
+class InstanceSet {
+
+public:
+
+    // the mesh being instanced
+    BufferSet *buffers;
+
+    // the instances added since the last clear()
+    vector<InstanceData> instances;
+
+    // buffer holding the instance data, created on the first upload()
+    // which isn't given a ring buffer
+    GLuint ibuffer;
+
+    // where the last upload() put the instances (ibuffer, or a ring
+    // buffer), and how many it put there
+    GLuint source;
+    GLintptr sourceOffset;
+    int uploaded;
+
+    ///
+    // Constructor
+    //
+    // @param B - the mesh to be instanced
+    ///
+    InstanceSet( BufferSet *B );
+
+    ///
+    // clear() - discard all the instances
+    ///
+    void clear( void );
+
+    ///
+    // add() - add an instance
+    //
+    // @param material - material id
+    // @param scale    - scale factors for each axis
+    // @param rotate   - rotation angles around the three axes, in degrees
+    // @param xlate    - amount of translation along each axis
+    ///
+    void add( int material, Tuple scale, Tuple rotate, Tuple xlate );
+
+    ///
+    // cull() - discard the instances which are outside a view frustum
+    //
+    // @param f - the frustum
+    //
+    // @return the number of instances discarded
+    ///
+    int cull( const Frustum &f );
+
+    ///
+    // upload() - copy the instances into the instance buffer
+    //
+    // @param ring - if not NULL, copy them into this ring buffer's
+    //               current section instead (a memory write)
+    ///
+    void upload( RingBuffer *ring = NULL );
+
+    ///
+    // select() - set up the per-instance attribute variables in the
+    //     currently-bound vertex array object
+    //
+    // @param program - GLSL program object
+    // @param vm      - name of the model matrix attribute variable
+    // @param vn      - name of the normal matrix attribute variable
+    // @param vmat    - name of the material id attribute variable
+    ///
+    void select( GLuint program,
+        const char *vm, const char *vn, const char *vmat );
+};
+
+///
+// selectRecords() - set up the per-instance attribute variables in the
+//     currently-bound vertex array object to read InstanceData records
+//
+// @param program - GLSL program object
+// @param buffer  - the buffer holding the records
+// @param offset  - where in the buffer the first record is
+// @param vm      - name of the model matrix attribute variable
+// @param vn      - name of the normal matrix attribute variable
+// @param vmat    - name of the material id attribute variable
+///
+void selectRecords( GLuint program, GLuint buffer, GLintptr offset,
+    const char *vm, const char *vn, const char *vmat );
+
+#endif
@@ -0,0 +1,158 @@
+///
+//  LevelOfDetail.cpp
+//
+//  Discrete levels of detail, chosen from each object's size on the
+//  screen.
+///
+
+#include <cmath>
+
+#include "LevelOfDetail.h"
+#include "Viewing.h"
+
+///
+// Constructor
+//
+// @param radius - radius of the meshes' circles, in model space
+// @param axes   - the axes the circles lie in (LOD_X, etc.)
+///
+LodChain::LodChain( GLfloat radius, int axes ) :
+    enabled(true), hysteresis(LOD_HYSTERESIS), radius(radius),
+    axes(axes), height(1), next(0) {
+
+    for( int i = 0; i < LOD_LEVELS; ++i ) {
+        instances.push_back( InstanceSet(&levels[i]) );
+        slices[i] = 0;
+        limit[i] = 1.0e30f;
+    }
+    for( int i = 0; i < 16; ++i ) {
+        view[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+    }
+    stats.objects = stats.switches = 0;
+    stats.fullTriangles = stats.triangles = 0;
+}
+
+///
+// setLevel() - say how finely a level's mesh was tessellated
+//
+// @param level  - which level
+// @param n      - the number of segments in its circles
+///
+void LodChain::setLevel( int level, int n ) {
+
+    slices[level] = n;
+
+    // the finest level has to do for anything bigger
+    if( level == 0 ) {
+        limit[level] = 1.0e30f;
+    } else {
+        limit[level] = LOD_TOLERANCE /
+            (1.0f - cosf(3.14159265358979f / n));
+    }
+}
+
+///
+// frame() - start a new frame
+//
+// @param eye, lookat, up - the camera for this frame
+// @param height          - height of the viewport, in pixels
+///
+void LodChain::frame( Tuple eye, Tuple lookat, Tuple up, int height ) {
+
+    viewMatrix( eye, lookat, up, view );
+    this->height = height;
+
+    next = 0;
+    stats.objects = stats.switches = 0;
+    stats.fullTriangles = stats.triangles = 0;
+}
+
+///
+// select() - choose the level for the next object of this frame
+//
+// @param scale, rotate, xlate - the object's transformations
+//
+// @return the level to draw it with
+///
+int LodChain::select( Tuple scale, Tuple rotate, Tuple xlate ) {
+
+    if( next == current.size() ) {
+        current.push_back( -1 );
+    }
+    int &level = current[next++];
+    int want = 0;
+
+    if( enabled ) {
+
+        // where the mesh is, and how big its circles are
+        GLfloat m[16], center[3];
+        modelMatrix( scale, rotate, xlate, m );
+        const GLfloat *c = levels[0].center;
+        for( int r = 0; r < 3; ++r ) {
+            center[r] = m[r] * c[0] + m[4 + r] * c[1] + m[8 + r] * c[2] +
+                m[12 + r];
+        }
+
+        GLfloat s = 0.0f;
+        if( (axes & LOD_X) && fabsf(scale.x) > s ) {
+            s = fabsf( scale.x );
+        }
+        if( (axes & LOD_Y) && fabsf(scale.y) > s ) {
+            s = fabsf( scale.y );
+        }
+        if( (axes & LOD_Z) && fabsf(scale.z) > s ) {
+            s = fabsf( scale.z );
+        }
+
+        GLfloat px = screenRadius( view, center, radius * s, height );
+
+        // the coarsest level that is fine enough
+        while( want + 1 < LOD_LEVELS && slices[want + 1] > 0 &&
+            px <= limit[want + 1] ) {
+            ++want;
+        }
+
+        // but only go coarser than last time once well inside the limit
+        if( level >= 0 && want > level ) {
+            want = level;
+            while( want + 1 < LOD_LEVELS && slices[want + 1] > 0 &&
+                px <= limit[want + 1] * hysteresis ) {
+                ++want;
+            }
+        }
+    }
+
+    if( level >= 0 && level != want ) {
+        ++stats.switches;
+    }
+    level = want;
+
+    ++stats.objects;
+    stats.fullTriangles += levels[0].numElements / 3;
+    stats.triangles += levels[want].numElements / 3;
+
+    return want;
+}
+
+///
+// clear() - discard the instances of every level
+///
+void LodChain::clear( void ) {
+    for( size_t i = 0; i < instances.size(); ++i ) {
+        instances[i].clear();
+    }
+}
+
+///
+// addLodStats() - add one chain's counts to a total
+//
+// @param total - the total
+// @param s     - the counts to add
+///
+void addLodStats( LodStats &total, const LodStats &s )
+{
+    total.objects += s.objects;
+    total.fullTriangles += s.fullTriangles;
+    total.triangles += s.triangles;
+    total.switches += s.switches;
+}
@@ -0,0 +1,172 @@
+///
+//  LevelOfDetail.h
+//
+//  Discrete levels of detail:  a mesh is built at several
+//  tessellations, finest first, and each object is drawn with the
+//  coarsest one whose silhouette is within LOD_TOLERANCE pixels of the
+//  finest, judged from how large the object appears on the screen.
+//
+//  The meshes are those of the shape generators, whose curves are
+//  circles of 'slices' segments:  a circle of radius r pixels drawn
+//  that way is off by r * (1 - cos(pi / slices)) pixels at most, which
+//  gives the largest size each level may be drawn at.  Only the scale
+//  factors along the axes the circles lie in matter (the sides of cones
+//  and cylinders are straight, so their length does not).
+//
+//  An object which grows on the screen moves to a finer level as soon
+//  as it needs to, but one which shrinks only moves to a coarser level
+//  once it is LOD_HYSTERESIS times smaller than that level's limit, so
+//  an object hovering around a limit doesn't flicker between levels.
+//  As with the static batcher, objects are given to the chain every
+//  frame in the same order; that is how it knows which level each one
+//  was drawn with last time.
+///
+
+#ifndef _LEVELOFDETAIL_H_
+#define _LEVELOFDETAIL_H_
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
+#ifndef __APPLE__
+#include <GL/glew.h>
+#endif
+
+#include <GLFW/glfw3.h>
+#endif
+
+#include <vector>
+
+#include "Buffers.h"
+#include "Instances.h"
+#include "Tuple.h"
+
+using namespace std;
+
+///
+// Number of levels in a chain
+///
+#define LOD_LEVELS          4
+
+///
+// Most pixels a level's silhouette may be off by
+///
+#define LOD_TOLERANCE       0.5f
+
+///
+// How far below a coarser level's limit an object must shrink before
+// it moves to that level
+///
+#define LOD_HYSTERESIS      0.8f
+
+///
+// Axes whose scale factors size a chain's circles
+///
+#define LOD_X               1
+#define LOD_Y               2
+#define LOD_Z               4
+
+///
+// What the objects given to the chains in one frame were drawn with
+///
+typedef struct st_lodstats {
+    int objects;                // objects given to select()
+    long fullTriangles;         // triangles, had all been at level 0
+    long triangles;             // triangles at the levels chosen
+    int switches;               // objects whose level changed
+} LodStats;
+
+///
+// A chain of levels of one mesh
+///
+class LodChain {
+
+public:
+
+    // the meshes, finest first, and the instances of each collected
+    // this frame
+    BufferSet levels[LOD_LEVELS];
+    vector<InstanceSet> instances;
+
+    // the slices in each level's circles, and the largest radius (in
+    // pixels) each level may be drawn at
+    int slices[LOD_LEVELS];
+    GLfloat limit[LOD_LEVELS];
+
+    // if not set, everything is drawn at level 0
+    bool enabled;
+
+    // shrinking objects move to a coarser level below this fraction of
+    // its limit (1 for no hysteresis)
+    GLfloat hysteresis;
+
+    // counts for the current frame
+    LodStats stats;
+
+    ///
+    // Constructor
+    //
+    // @param radius - radius of the meshes' circles, in model space
+    // @param axes   - the axes the circles lie in (LOD_X, etc.)
+    ///
+    LodChain( GLfloat radius, int axes );
+
+    ///
+    // setLevel() - say how finely a level's mesh was tessellated
+    //
+    // @param level  - which level
+    // @param n      - the number of segments in its circles
+    ///
+    void setLevel( int level, int n );
+
+    ///
+    // frame() - start a new frame
+    //
+    // @param eye, lookat, up - the camera for this frame
+    // @param height          - height of the viewport, in pixels
+    ///
+    void frame( Tuple eye, Tuple lookat, Tuple up, int height );
+
+    ///
+    // select() - choose the level for the next object of this frame
+    //
+    // @param scale, rotate, xlate - the object's transformations
+    //
+    // @return the level to draw it with
+    ///
+    int select( Tuple scale, Tuple rotate, Tuple xlate );
+
+    ///
+    // clear() - discard the instances of every level
+    ///
+    void clear( void );
+
+private:
+
+    GLfloat radius;
+    int axes;
+
+    // the current camera
+    GLfloat view[16];
+    int height;
+
+    // the level each object was last drawn with (-1 if never), and
+    // the number of objects given this frame
+    vector<int> current;
+    size_t next;
+};
+
+///
+// addLodStats() - add one chain's counts to a total
+//
+// @param total - the total
+// @param s     - the counts to add
+///
+void addLodStats( LodStats &total, const LodStats &s );
+
+#endif
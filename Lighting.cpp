@@ -14,11 +14,148 @@
 ///
 
 #include "Lighting.h"
+#include "Uniforms.h"
+#include "Viewing.h"
 #include "Shapes.h"
 #include "Shape_Nonorm.h"
+#include "GLState.h"
 #include <iostream>
 // Add any global definitions and/or variables you need here.
 
+// the materials, by material id
+static const Material materials[] = {
+	// id                 Oa                        Od                          Os                     ka    kd    ks    exponent
+	{ OBJ_TEAPOT,        { 0.1, 0.1, 0.1, 1.0 },   { 0.6, 0.6, 0.6, 1.0 },     { 1.0, 1.0, 1.0, 1.0 }, 0.5,  0.7,  1.0,  90.0 },
+	{ OBJ_SPHERE,        { 0.5, 0.5, 0.5, 1.0 },   { 0.49, 0.99, 0.0, 1.0 },   { 1.0, 1.0, 1.0, 1.0 }, 0.5,  0.8,  1.0,  50.0 },
+	{ MATL_MUFFIN,       { 0.3, 0.3, 0.3, 1.0 },   { 0.75, 0.5, 0.1, 1.0 },    { 1.0, 1.0, 1.0, 1.0 }, 0.8,  0.8,  0.1,  2.0 },
+	{ MATL_MUFFINCUP,    { 0.5, 0.3, 0.05, 1.0 },  { 0.75, 0.5, 0.1, 1.0 },    { 1.0, 1.0, 1.0, 1.0 }, 0.8,  0.1,  0.01, 2.0 },
+	{ MATL_APPLE,        { 0.2, 0.2, 0.2, 1.0 },   { 1.0, 0.0, 0.0, 1.0 },     { 1.0, 1.0, 1.0, 1.0 }, 0.8,  0.8,  1.0,  100.0 },
+	{ MATL_FLOWER,       { 0.2, 0.2, 0.2, 1.0 },   { 0.8, 0.0, 0.0, 1.0 },     { 1.0, 1.0, 1.0, 1.0 }, 0.8,  0.8,  0.1,  2.0 },
+	{ MATL_YELLOWFLOWER, { 0.2, 0.5, 0.2, 1.0 },   { 0.7, 0.7, 0.0, 1.0 },     { 1.0, 1.0, 1.0, 1.0 }, 0.3,  0.8,  0.1,  2.0 },
+	{ MATL_WOOD,         { 0.5, 0.3, 0.05, 1.0 },  { 0.75, 0.5, 0.1, 1.0 },    { 1.0, 1.0, 1.0, 1.0 }, 0.8,  0.1,  0.01, 1.0 },
+	{ MATL_VASE,         { 0.1, 0.25, 0.1, 1.0 },  { 0.5, 0.5, 0.5, 1.0 },     { 1.0, 1.0, 1.0, 1.0 }, 0.5,  0.8,  0.6,  100.0 },
+	{ MATL_CUP,          { 0.8, 0.8, 0.8, 1.0 },   { 0.5, 0.5, 0.5, 1.0 },     { 1.0, 1.0, 1.0, 1.0 }, 0.2,  0.8,  0.6,  100.0 },
+	{ MATL_CANDLE,       { 0.8, 0.8, 0.8, 1.0 },   { 0.5, 0.5, 0.75, 1.0 },    { 1.0, 1.0, 1.0, 1.0 }, 0.5,  0.3,  0.1,  100.0 },
+	{ MATL_LEAF,         { 0.35, 0.5, 0.25, 1.0 }, { 0.35, 0.8, 0.25, 1.0 },   { 1.0, 1.0, 1.0, 1.0 }, 0.3,  0.4,  0.05, 1.0 },
+};
+
+static const int numMaterials = sizeof(materials) / sizeof(materials[0]);
+
+///
+// This function looks up the material for an object type.
+//
+// @param obj - The object type (or material id)
+//
+// @return the material, or NULL if there is none for this id
+///
+const Material *getMaterial(int obj)
+{
+	for (int i = 0; i < numMaterials; ++i) {
+		if (materials[i].id == obj) {
+			return &materials[i];
+		}
+	}
+	return NULL;
+}
+
+// the light source, in world coordinates
+static const GLfloat light_color[4] = { 1.0, 1.0, 1.0, 1.0 };
+static const GLfloat light_ambient[4] = { 0.5, 0.5, 0.5, 1.0 };
+static const Tuple light_position = { 3.0f, 9.0f, 2.0f };
+
+// uniform buffers holding the Materials and Light blocks
+static GLuint materialBuffer, lightBuffer;
+
+// the Light block as last uploaded (std140:  three vec4s)
+static GLfloat lightBlock[12];
+
+///
+// This function creates the uniform buffers for the material and light
+// blocks, uploads the material table, and binds both buffers to their
+// binding points.
+///
+void initMaterials(void)
+{
+	// std140 layout of MaterialData:  Oa, Od, Os, and (ka, kd, ks,
+	// specular exponent), each a vec4; unused ids are left black
+	static GLfloat block[N_MATERIALS][16];
+
+	for (int i = 0; i < numMaterials; ++i) {
+		const Material &m = materials[i];
+		for (int j = 0; j < 4; ++j) {
+			block[m.id][j] = m.Oa[j];
+			block[m.id][4 + j] = m.Od[j];
+			block[m.id][8 + j] = m.Os[j];
+		}
+		block[m.id][12] = m.ka;
+		block[m.id][13] = m.kd;
+		block[m.id][14] = m.ks;
+		block[m.id][15] = m.specular_exponent;
+	}
+
+	glGenBuffers(1, &materialBuffer);
+	stBindBuffer(GL_UNIFORM_BUFFER, materialBuffer);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(block), block, GL_STATIC_DRAW);
+	stBindBufferBase(GL_UNIFORM_BUFFER, MATERIAL_BINDING, materialBuffer);
+
+	// the eye-space light position is filled in by setUpLight()
+	for (int j = 0; j < 4; ++j) {
+		lightBlock[j] = light_color[j];
+		lightBlock[4 + j] = light_ambient[j];
+		lightBlock[8 + j] = 0.0f;
+	}
+
+	glGenBuffers(1, &lightBuffer);
+	stBindBuffer(GL_UNIFORM_BUFFER, lightBuffer);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(lightBlock), lightBlock,
+		GL_DYNAMIC_DRAW);
+	stBindBufferBase(GL_UNIFORM_BUFFER, LIGHT_BINDING, lightBuffer);
+}
+
+///
+// This function connects a program's Materials and Light blocks (if it
+// has them) to the buffers created by initMaterials().
+//
+// @param program - The ID of an OpenGL (GLSL) shader program
+///
+void bindMaterialBlocks(GLuint program)
+{
+	GLuint index = glGetUniformBlockIndex(program, "Materials");
+	if (index != GL_INVALID_INDEX) {
+		glUniformBlockBinding(program, index, MATERIAL_BINDING);
+	}
+
+	index = glGetUniformBlockIndex(program, "Light");
+	if (index != GL_INVALID_INDEX) {
+		glUniformBlockBinding(program, index, LIGHT_BINDING);
+	}
+}
+
+///
+// This function brings the eye-space light position in the Light block
+// up to date with the current view matrix.  Nothing is sent to the GPU
+// unless the camera has moved since the last call.
+///
+void setUpLight(void)
+{
+	GLfloat eye[4];
+	for (int r = 0; r < 3; ++r) {
+		eye[r] = viewMat[r] * light_position.x + viewMat[4 + r] * light_position.y +
+			viewMat[8 + r] * light_position.z + viewMat[12 + r];
+	}
+	eye[3] = 1.0f;
+
+	if (eye[0] != lightBlock[8] || eye[1] != lightBlock[9] ||
+		eye[2] != lightBlock[10] || eye[3] != lightBlock[11]) {
+		for (int j = 0; j < 4; ++j) {
+			lightBlock[8 + j] = eye[j];
+		}
+		stBindBuffer(GL_UNIFORM_BUFFER, lightBuffer);
+		glBufferSubData(GL_UNIFORM_BUFFER, 8 * sizeof(GLfloat),
+			4 * sizeof(GLfloat), &lightBlock[8]);
+	}
+}
+
 ///
 // This function sets up the lighting, material, and shading parameters
 // for the Phong shader.
@@ -34,6 +171,14 @@
 
 void setUpPhong(GLuint program, int obj)
 {
+	// shaders using the material and light blocks just need the id
+	GLint material_loc = uniformLoc(program, U_MATERIAL);
+	if (material_loc >= 0) {
+		setUpLight();
+		stUniform1i(material_loc, obj);
+		return;
+	}
+
 	/*
 	in vec3 normal;
 	uniform vec4 ambient_color;
@@ -45,13 +190,13 @@ void setUpPhong(GLuint program, int obj)
 	uniform float specular_exponent;
 	*/
 	//get location of uniform variables
-	GLint Oa_loc = glGetUniformLocation(program, "Oa");
-	GLint Od_loc = glGetUniformLocation(program, "Od");
-	GLint Os_loc = glGetUniformLocation(program, "Os");
-	GLint ka_loc = glGetUniformLocation(program, "ka");
-	GLint kd_loc = glGetUniformLocation(program, "kd");
-	GLint ks_loc = glGetUniformLocation(program, "ks");
-	GLint specular_exponent_loc = glGetUniformLocation(program, "specular_exponent");
+	GLint Oa_loc = uniformLoc(program, U_OA);
+	GLint Od_loc = uniformLoc(program, U_OD);
+	GLint Os_loc = uniformLoc(program, U_OS);
+	GLint ka_loc = uniformLoc(program, U_KA);
+	GLint kd_loc = uniformLoc(program, U_KD);
+	GLint ks_loc = uniformLoc(program, U_KS);
+	GLint specular_exponent_loc = uniformLoc(program, U_SPECULAR_EXPONENT);
 
 	/*
 	Properties of the light source:
@@ -62,122 +207,19 @@ void setUpPhong(GLuint program, int obj)
 	*/
 
 	//set default light
-	GLint light_color_loc = glGetUniformLocation(program, "light_color");
-	GLint light_position_loc = glGetUniformLocation(program, "light_position");
-	GLint light_ambient_loc = glGetUniformLocation(program, "light_ambient");
-	glUniform4f(light_color_loc, 1.0, 1.0, 1.0, 1.0);
-	glUniform3f(light_position_loc, 3.0, 9.0, 2.0);
-	glUniform4f(light_ambient_loc, 0.5, 0.5, 0.5, 1.0);
-	switch (obj) {
-
-	case OBJ_TEAPOT:
-		glUniform4f(Oa_loc, 0.1, 0.1, 0.1, 1.0);
-		glUniform4f(Od_loc, 0.6, 0.6, 0.6, 1.0);
-		glUniform4f(Os_loc, 1.0, 1.0, 1.0, 1.0);
-		glUniform1f(ka_loc, 0.5);
-		glUniform1f(kd_loc, 0.7);
-		glUniform1f(ks_loc, 1.0);
-		glUniform1f(specular_exponent_loc, 90);
-		break;
-
-	case OBJ_SPHERE:
-		glUniform4f(Oa_loc, 0.5, 0.5, 0.5, 1.0);
-		glUniform4f(Od_loc, 0.49, 0.99, 0.0, 1.0);
-		glUniform4f(Os_loc, 1.0, 1.0, 1.0, 1.0);
-		glUniform1f(ka_loc, 0.5);
-		glUniform1f(kd_loc, 0.8);
-		glUniform1f(ks_loc, 1.0);
-		glUniform1f(specular_exponent_loc, 50.0);
-		break;
-	case MATL_MUFFIN:
-		glUniform4f(Oa_loc, 0.3,0.3,0.3, 1.0);
-		glUniform4f(Od_loc, 0.75,0.5,0.1, 1.0);
-		glUniform4f(Os_loc, 1.0, 1.0, 1.0, 1.0);
-		glUniform1f(ka_loc, 0.8);
-		glUniform1f(kd_loc, 0.8);
-		glUniform1f(ks_loc, 0.1);
-		glUniform1f(specular_exponent_loc, 2);
-		break;
-	case MATL_MUFFINCUP:
-		glUniform4f(Oa_loc, 0.5, 0.3, 0.05, 1.0);
-		glUniform4f(Od_loc, 0.75, 0.5, 0.1, 1.0);
-		glUniform4f(Os_loc, 1.0, 1.0, 1.0, 1.0);
-		glUniform1f(ka_loc, 0.8);
-		glUniform1f(kd_loc, 0.1);
-		glUniform1f(ks_loc, 0.01);
-		glUniform1f(specular_exponent_loc, 2);
-		break;
-	case MATL_APPLE:
-		glUniform4f(Oa_loc, 0.2, 0.2, 0.2, 1.0);
-		glUniform4f(Od_loc, 1, 0.0, 0.0, 1.0);
-		glUniform4f(Os_loc, 1.0, 1.0, 1.0, 1.0);
-		glUniform1f(ka_loc, 0.8);
-		glUniform1f(kd_loc, 0.8);
-		glUniform1f(ks_loc, 1.0);
-		glUniform1f(specular_exponent_loc, 100.0);
-		break;
-	case MATL_FLOWER:
-		glUniform4f(Oa_loc, 0.2, 0.2, 0.2, 1.0);
-		glUniform4f(Od_loc, 0.8, 0.0, 0.0, 1.0);
-		glUniform4f(Os_loc, 1.0, 1.0, 1.0, 1.0);
-		glUniform1f(ka_loc, 0.8);
-		glUniform1f(kd_loc, 0.8);
-		glUniform1f(ks_loc, 0.1);
-		glUniform1f(specular_exponent_loc,2.0);
-		break;
-	case MATL_YELLOWFLOWER:
-		glUniform4f(Oa_loc, 0.2, 0.5, 0.2, 1.0);
-		glUniform4f(Od_loc, 0.7, 0.7, 0.0, 1.0);
-		glUniform4f(Os_loc, 1.0, 1.0, 1.0, 1.0);
-		glUniform1f(ka_loc, 0.3);
-		glUniform1f(kd_loc, 0.8);
-		glUniform1f(ks_loc, 0.1);
-		glUniform1f(specular_exponent_loc, 2.0);
-		break;
-	case MATL_WOOD:
-		glUniform4f(Oa_loc, 0.5, 0.3, 0.05, 1.0);
-		glUniform4f(Od_loc, 0.75, 0.5, 0.1, 1.0);
-		glUniform4f(Os_loc, 1.0, 1.0, 1.0, 1.0);
-		glUniform1f(ka_loc, 0.8);
-		glUniform1f(kd_loc, 0.1);
-		glUniform1f(ks_loc, 0.01);
-		glUniform1f(specular_exponent_loc, 1);
-		break;
-	case MATL_VASE:
-		glUniform4f(Oa_loc, 0.1, 0.25, 0.1, 1.0);
-		glUniform4f(Od_loc, 0.5, 0.5, 0.5, 1.0);
-		glUniform4f(Os_loc, 1.0, 1.0, 1.0, 1.0);
-		glUniform1f(ka_loc, 0.5);
-		glUniform1f(kd_loc, 0.8);
-		glUniform1f(ks_loc, 0.6);
-		glUniform1f(specular_exponent_loc, 100);
-		break;
-	case MATL_CUP:
-		glUniform4f(Oa_loc, 0.8, 0.8, 0.8, 1.0);
-		glUniform4f(Od_loc, 0.5, 0.5, 0.5, 1.0);
-		glUniform4f(Os_loc, 1.0, 1.0, 1.0, 1.0);
-		glUniform1f(ka_loc, 0.2);
-		glUniform1f(kd_loc, 0.8);
-		glUniform1f(ks_loc, 0.6);
-		glUniform1f(specular_exponent_loc, 100);
-		break;
-	case MATL_CANDLE:
-		glUniform4f(Oa_loc, 0.8, 0.8, 0.8, 1.0);
-		glUniform4f(Od_loc, 0.5, 0.5, 0.75, 1.0);
-		glUniform4f(Os_loc, 1.0, 1.0, 1.0, 1.0);
-		glUniform1f(ka_loc, 0.5);
-		glUniform1f(kd_loc, 0.3);
-		glUniform1f(ks_loc, 0.1);
-		glUniform1f(specular_exponent_loc, 100);
-		break;
-	case MATL_LEAF:
-		glUniform4f(Oa_loc, 0.35, 0.5, 0.25, 1.0);
-		glUniform4f(Od_loc, 0.35, 0.8, 0.25, 1.0);
-		glUniform4f(Os_loc, 1.0, 1.0, 1.0, 1.0);
-		glUniform1f(ka_loc, 0.3);
-		glUniform1f(kd_loc, 0.4);
-		glUniform1f(ks_loc, 0.05);
-		glUniform1f(specular_exponent_loc, 1);
-		break;
+	GLint light_color_loc = uniformLoc(program, U_LIGHT_COLOR);
+	GLint light_ambient_loc = uniformLoc(program, U_LIGHT_AMBIENT);
+	stUniform4fv(light_color_loc, 1, light_color);
+	setUpLightPosition(program, light_position);
+	stUniform4fv(light_ambient_loc, 1, light_ambient);
+	const Material *m = getMaterial(obj);
+	if (m != NULL) {
+		stUniform4fv(Oa_loc, 1, m->Oa);
+		stUniform4fv(Od_loc, 1, m->Od);
+		stUniform4fv(Os_loc, 1, m->Os);
+		stUniform1f(ka_loc, m->ka);
+		stUniform1f(kd_loc, m->kd);
+		stUniform1f(ks_loc, m->ks);
+		stUniform1f(specular_exponent_loc, m->specular_exponent);
 	}
 }
@@ -18,15 +18,80 @@
 #include <windows.h>
 #endif
 
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
 #ifndef __APPLE__
 #include <GL/glew.h>
 #endif
 
 #include <GLFW/glfw3.h>
+#endif
+
+///
+// Material ids run from 0 up to (but not including) N_MATERIALS; the
+// ids in use are the OBJ_ and MATL_ values from Shapes.h and
+// Shape_Nonorm.h.  The shaders' Materials block must have this many
+// entries.
+///
+#define N_MATERIALS     256
+
+///
+// Uniform buffer binding points for the Materials and Light blocks
+///
+#define MATERIAL_BINDING    0
+#define LIGHT_BINDING       1
+
+///
+// Reflective characteristics of a material
+///
+typedef struct st_material {
+    int id;
+    GLfloat Oa[4];
+    GLfloat Od[4];
+    GLfloat Os[4];
+    GLfloat ka;
+    GLfloat kd;
+    GLfloat ks;
+    GLfloat specular_exponent;
+} Material;
+
+///
+// This function looks up the material for an object type.
+//
+// @param obj - The object type (or material id)
+//
+// @return the material, or NULL if there is none for this id
+///
+const Material *getMaterial( int obj );
+
+///
+// This function creates the uniform buffers for the material and light
+// blocks, uploads the material table, and binds both buffers to their
+// binding points.
+///
+void initMaterials( void );
+
+///
+// This function connects a program's Materials and Light blocks (if it
+// has them) to the buffers created by initMaterials().
+//
+// @param program - The ID of an OpenGL (GLSL) shader program
+///
+void bindMaterialBlocks( GLuint program );
+
+///
+// This function brings the eye-space light position in the Light block
+// up to date with the current view matrix.  Nothing is sent to the GPU
+// unless the camera has moved since the last call.
+///
+void setUpLight( void );
 
 ///
 // This function sets up the lighting, material, and shading parameters
-// for the Phong shader.
+// for the Phong shader.  For shaders using the Materials and Light
+// blocks this is just the material id.
 //
 // You will need to write this function, and maintain all of the values
 // needed to be sent to the shader.
@@ -0,0 +1,399 @@
+///
+//  MeshCache.cpp
+//
+//  Writing and mapping binary mesh files.
+///
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "MeshCache.h"
+#include "Buffers.h"
+
+using namespace std;
+
+///
+// Components of each attribute, as Canvas holds them
+///
+static const uint32_t attrComponents[MESH_ATTRIBUTES] = { 4, 4, 3, 2 };
+
+///
+// Round up to a multiple of MESHFILE_ALIGN
+///
+static uint64_t alignUp( uint64_t n )
+{
+    return (n + MESHFILE_ALIGN - 1) & ~(uint64_t) (MESHFILE_ALIGN - 1);
+}
+
+///
+// Constructor
+///
+MeshFile::MeshFile( void ) : base(NULL), length(0) {
+#if defined(_WIN32) || defined(_WIN64)
+    file = INVALID_HANDLE_VALUE;
+    mapping = NULL;
+#endif
+    for( int i = 0; i < MESH_ATTRIBUTES; ++i ) {
+        views[i].data = NULL;
+        views[i].count = 0;
+    }
+}
+
+///
+// Destructor
+///
+MeshFile::~MeshFile( void ) {
+    close();
+}
+
+///
+// open() - map a mesh file, and check it
+//
+// @param path   - the file's name
+// @param source - the meshSource() it must have been written with
+//
+// @return true if it can be used
+///
+bool MeshFile::open( const char *path, uint64_t source ) {
+
+    close();
+
+#if defined(_WIN32) || defined(_WIN64)
+    file = CreateFileA( path, GENERIC_READ, FILE_SHARE_READ, NULL,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+    if( file == INVALID_HANDLE_VALUE ) {
+        return false;
+    }
+    LARGE_INTEGER bytes;
+    if( !GetFileSizeEx(file, &bytes) || bytes.QuadPart == 0 ) {
+        close();
+        return false;
+    }
+    mapping = CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL );
+    if( mapping == NULL ) {
+        close();
+        return false;
+    }
+    base = (const unsigned char *) MapViewOfFile( mapping, FILE_MAP_READ,
+        0, 0, 0 );
+    if( base == NULL ) {
+        close();
+        return false;
+    }
+    length = (size_t) bytes.QuadPart;
+#else
+    int fd = ::open( path, O_RDONLY );
+    if( fd < 0 ) {
+        return false;
+    }
+    struct stat st;
+    if( fstat(fd, &st) != 0 || st.st_size == 0 ) {
+        ::close( fd );
+        return false;
+    }
+    void *p = mmap( NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE,
+        fd, 0 );
+    // the mapping outlives the descriptor
+    ::close( fd );
+    if( p == MAP_FAILED ) {
+        return false;
+    }
+    base = (const unsigned char *) p;
+    length = (size_t) st.st_size;
+#endif
+
+    if( !check(source) ) {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+///
+// check() - make sure the mapped file is a mesh file we can use, and
+//     find its attributes
+//
+// @param source - the meshSource() it must have been written with
+///
+bool MeshFile::check( uint64_t source ) {
+
+    if( length < sizeof(MeshFileHeader) ) {
+        return false;
+    }
+
+    const MeshFileHeader &h = header();
+    if( memcmp(h.magic, MESHFILE_MAGIC, sizeof(h.magic)) != 0 ||
+        h.byteOrder != MESHFILE_BYTE_ORDER ||
+        h.version != MESHFILE_VERSION ||
+        h.headerSize != sizeof(MeshFileHeader) ||
+        h.source != source ||
+        h.attributes < 1 || h.attributes > MESH_ATTRIBUTES ) {
+        return false;
+    }
+
+    // the blocks must be where they should, and inside the file
+    uint64_t attrEnd = h.headerSize +
+        (uint64_t) h.attributes * sizeof(MeshAttribute);
+    if( h.vertexOffset % MESHFILE_ALIGN != 0 ||
+        h.indexOffset % MESHFILE_ALIGN != 0 ||
+        h.vertexOffset < attrEnd ||
+        h.vertexOffset + h.vertexSize > length ||
+        h.indexOffset < h.vertexOffset + h.vertexSize ||
+        h.indexOffset + h.indexSize > length ||
+        h.indexSize != (uint64_t) h.indices * sizeof(GLuint) ||
+        h.vertices > 0x7fffffff || h.indices > 0x7fffffff ) {
+        return false;
+    }
+
+    // the attributes must fill the vertex block, in order, as the
+    // sections of a planar vertex buffer do; locations are a must
+    const MeshAttribute *a = (const MeshAttribute *) (base + h.headerSize);
+    uint64_t offset = 0;
+    int last = -1;
+    for( uint32_t i = 0; i < h.attributes; ++i ) {
+        uint32_t s = a[i].semantic;
+        if( (int) s <= last || s >= MESH_ATTRIBUTES ||
+            a[i].components != attrComponents[s] ||
+            a[i].type != GL_FLOAT || a[i].offset != offset ||
+            a[i].size != (uint64_t) h.vertices * a[i].components *
+                sizeof(float) ) {
+            return false;
+        }
+        views[s].data = (const float *) (base + h.vertexOffset + offset);
+        views[s].count = (size_t) h.vertices * a[i].components;
+        offset += a[i].size;
+        last = (int) s;
+    }
+
+    return offset == h.vertexSize && views[MESH_ATTR_POSITION].data != NULL;
+}
+
+///
+// close() - unmap the file
+///
+void MeshFile::close( void ) {
+
+#if defined(_WIN32) || defined(_WIN64)
+    if( base != NULL ) {
+        UnmapViewOfFile( base );
+    }
+    if( mapping != NULL ) {
+        CloseHandle( mapping );
+        mapping = NULL;
+    }
+    if( file != INVALID_HANDLE_VALUE ) {
+        CloseHandle( file );
+        file = INVALID_HANDLE_VALUE;
+    }
+#else
+    if( base != NULL ) {
+        munmap( (void *) base, length );
+    }
+#endif
+
+    base = NULL;
+    length = 0;
+    for( int i = 0; i < MESH_ATTRIBUTES; ++i ) {
+        views[i].data = NULL;
+        views[i].count = 0;
+    }
+}
+
+///
+// What is in it
+///
+const MeshFileHeader &MeshFile::header( void ) const {
+    return *(const MeshFileHeader *) base;
+}
+
+int MeshFile::numVertices( void ) const {
+    return (int) header().vertices;
+}
+
+int MeshFile::numIndices( void ) const {
+    return (int) header().indices;
+}
+
+AttribView MeshFile::positions( void ) const {
+    return views[MESH_ATTR_POSITION];
+}
+
+AttribView MeshFile::colors( void ) const {
+    return views[MESH_ATTR_COLOR];
+}
+
+AttribView MeshFile::normals( void ) const {
+    return views[MESH_ATTR_NORMAL];
+}
+
+AttribView MeshFile::uv( void ) const {
+    return views[MESH_ATTR_UV];
+}
+
+const GLuint *MeshFile::indices( void ) const {
+    return (const GLuint *) (base + header().indexOffset);
+}
+
+const void *MeshFile::vertexBlock( void ) const {
+    return base + header().vertexOffset;
+}
+
+size_t MeshFile::size( void ) const {
+    return length;
+}
+
+///
+// writeMeshFile() - write the mesh a Canvas holds to a mesh file
+//
+// @param path   - the file's name
+// @param C      - the Canvas
+// @param source - meshSource() of what the mesh was made from
+//
+// @return true if it was written
+///
+bool writeMeshFile( const char *path, Canvas &C, uint64_t source )
+{
+    int vertices = C.numVertices();
+    int count = C.numIndices();
+    if( vertices < 1 ) {
+        return false;
+    }
+
+    AttribView views[MESH_ATTRIBUTES] = {
+        C.viewVertices(), C.viewColors(), C.viewNormals(), C.viewUV()
+    };
+    const GLuint *elements = C.getElements();
+
+    // the bounds, as createBuffers() would find them
+    BufferSet bounds;
+    bounds.computeBounds( views[MESH_ATTR_POSITION] );
+
+    MeshFileHeader h;
+    memset( &h, 0, sizeof(h) );
+    memcpy( h.magic, MESHFILE_MAGIC, sizeof(h.magic) );
+    h.byteOrder = MESHFILE_BYTE_ORDER;
+    h.version = MESHFILE_VERSION;
+    h.headerSize = sizeof(MeshFileHeader);
+    h.vertices = (uint32_t) vertices;
+    h.indices = (uint32_t) count;
+    h.source = source;
+    for( int i = 0; i < 3; ++i ) {
+        h.boxMin[i] = bounds.boxMin[i];
+        h.boxMax[i] = bounds.boxMax[i];
+        h.center[i] = bounds.center[i];
+    }
+    h.radius = bounds.radius;
+
+    vector<MeshAttribute> attrs;
+    uint64_t offset = 0;
+    for( int s = 0; s < MESH_ATTRIBUTES; ++s ) {
+        if( views[s].data == NULL ) {
+            continue;
+        }
+        MeshAttribute a;
+        a.semantic = (uint32_t) s;
+        a.components = attrComponents[s];
+        a.type = GL_FLOAT;
+        a.normalized = GL_FALSE;
+        a.offset = offset;
+        a.size = (uint64_t) vertices * a.components * sizeof(float);
+        attrs.push_back( a );
+        offset += a.size;
+    }
+    h.attributes = (uint32_t) attrs.size();
+
+    uint64_t attrEnd = sizeof(h) + attrs.size() * sizeof(MeshAttribute);
+    h.vertexOffset = alignUp( attrEnd );
+    h.vertexSize = offset;
+    h.indexOffset = alignUp( h.vertexOffset + h.vertexSize );
+    h.indexSize = (uint64_t) count * sizeof(GLuint);
+
+    string temp = string( path ) + ".tmp";
+    FILE *f = fopen( temp.c_str(), "wb" );
+    if( f == NULL ) {
+        return false;
+    }
+
+    static const unsigned char zeros[MESHFILE_ALIGN] = { 0 };
+    bool ok = fwrite( &h, sizeof(h), 1, f ) == 1 &&
+        fwrite( attrs.data(), sizeof(MeshAttribute), attrs.size(), f ) ==
+            attrs.size();
+    ok = ok && fwrite( zeros, 1, h.vertexOffset - attrEnd, f ) ==
+        h.vertexOffset - attrEnd;
+    for( int s = 0; ok && s < MESH_ATTRIBUTES; ++s ) {
+        if( views[s].data != NULL ) {
+            ok = fwrite( views[s].data, sizeof(float), views[s].count, f ) ==
+                views[s].count;
+        }
+    }
+    uint64_t vertexEnd = h.vertexOffset + h.vertexSize;
+    ok = ok && fwrite( zeros, 1, h.indexOffset - vertexEnd, f ) ==
+        h.indexOffset - vertexEnd;
+    ok = ok && fwrite( elements, sizeof(GLuint), count, f ) == (size_t) count;
+
+    ok = fclose( f ) == 0 && ok;
+
+#if defined(_WIN32) || defined(_WIN64)
+    // rename() won't replace a file here
+    if( ok ) {
+        remove( path );
+    }
+#endif
+    if( !ok || rename(temp.c_str(), path) != 0 ) {
+        remove( temp.c_str() );
+        return false;
+    }
+
+    return true;
+}
+
+///
+// Add bytes to a 64-bit FNV-1a hash
+///
+static uint64_t hashBytes( uint64_t h, const void *data, size_t n )
+{
+    const unsigned char *p = (const unsigned char *) data;
+    for( size_t i = 0; i < n; ++i ) {
+        h = (h ^ p[i]) * 1099511628211ull;
+    }
+    return h;
+}
+
+///
+// meshSource() - a key for what a mesh is made from
+//
+// @param recipe - how the mesh is made
+// @param file   - the file it is read from, or NULL
+//
+// @return the key
+///
+uint64_t meshSource( const char *recipe, const char *file )
+{
+    uint64_t h = hashBytes( 14695981039346656037ull, recipe,
+        strlen(recipe) + 1 );
+
+    if( file != NULL ) {
+        h = hashBytes( h, file, strlen(file) + 1 );
+        struct stat st;
+        if( stat(file, &st) == 0 ) {
+            uint64_t size = (uint64_t) st.st_size;
+            uint64_t when = (uint64_t) st.st_mtime;
+            h = hashBytes( h, &size, sizeof(size) );
+            h = hashBytes( h, &when, sizeof(when) );
+        }
+    }
+
+    return h;
+}
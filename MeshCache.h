@@ -0,0 +1,201 @@
+///
+//  MeshCache.h
+//
+//  A binary file format for finished meshes, so that they need not be
+//  rebuilt through a Canvas at every start.
+//
+//  writeMeshFile() writes whatever mesh a Canvas holds (after weld()
+//  and optimize(), usually) once; MeshFile::open() maps the file into
+//  memory rather than reading it.  The vertex block is laid out just
+//  as a LAYOUT_PLANAR vertex buffer is, and the index block just as an
+//  element buffer, so BufferSet::createBuffers() hands both straight
+//  from the mapping to glBufferData(), with no parsing and no copies
+//  of its own (other layouts, and arenas, read the attributes where
+//  they lie).
+//
+//  A file is
+//
+//      the header              MeshFileHeader, with the bounds
+//      the attributes          a MeshAttribute for each one present
+//      the vertex block        at vertexOffset
+//      the index block         at indexOffset
+//
+//  with both blocks MESHFILE_ALIGN-byte aligned, in the writer's byte
+//  order.  The header also records where the mesh came from, as a
+//  meshSource() key of the generator and its parameters, or of the
+//  model file's path, size and modification time.  A file with the
+//  wrong magic number, byte order, version or source, or whose sizes
+//  don't add up, is refused, and the caller builds the mesh as before
+//  (and may write the file again).  MESHFILE_VERSION must change
+//  whenever the format does.  These files are a cache of
+//  our own output, not an interchange format:  the indices are not
+//  checked against the vertex count.
+///
+
+#ifndef _MESHCACHE_H_
+#define _MESHCACHE_H_
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
+#ifndef __APPLE__
+#include <GL/glew.h>
+#endif
+
+#include <GLFW/glfw3.h>
+#endif
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "Canvas.h"
+
+///
+// Identification of a mesh file
+///
+#define MESHFILE_MAGIC          "STLMESH"
+#define MESHFILE_VERSION        2
+#define MESHFILE_BYTE_ORDER     0x01020304u
+
+///
+// Alignment of the vertex and index blocks, in bytes
+///
+#define MESHFILE_ALIGN          64
+
+///
+// Vertex attributes, in the order they appear in the vertex block
+///
+#define MESH_ATTR_POSITION      0       // XYZW
+#define MESH_ATTR_COLOR         1       // RGBA
+#define MESH_ATTR_NORMAL        2       // XYZ
+#define MESH_ATTR_UV            3       // UV
+#define MESH_ATTRIBUTES         4
+
+///
+// One attribute's section of the vertex block
+///
+typedef struct st_meshattribute {
+    uint32_t semantic;          // MESH_ATTR_*
+    uint32_t components;        // per vertex
+    uint32_t type;              // GL type of each component
+    uint32_t normalized;        // for glVertexAttribPointer()
+    uint64_t offset;            // from the start of the vertex block
+    uint64_t size;              // in bytes
+} MeshAttribute;
+
+///
+// The start of a mesh file
+///
+typedef struct st_meshfileheader {
+    char magic[8];              // MESHFILE_MAGIC
+    uint32_t byteOrder;         // MESHFILE_BYTE_ORDER, as written
+    uint32_t version;           // MESHFILE_VERSION
+    uint32_t headerSize;        // sizeof(MeshFileHeader)
+    uint32_t attributes;        // MeshAttributes following the header
+    uint32_t vertices;
+    uint32_t indices;
+    uint64_t vertexOffset, vertexSize;
+    uint64_t indexOffset, indexSize;
+    uint64_t source;            // meshSource() of what it was made from
+    float boxMin[3], boxMax[3]; // bounds, as in BufferSet
+    float center[3], radius;
+} MeshFileHeader;
+
+///
+// An open (mapped) mesh file
+///
+class MeshFile {
+
+public:
+
+    ///
+    // Constructor and destructor
+    ///
+    MeshFile( void );
+    ~MeshFile( void );
+
+    ///
+    // open() - map a mesh file, and check it
+    //
+    // @param path   - the file's name
+    // @param source - the meshSource() it must have been written with
+    //
+    // @return true if it can be used
+    ///
+    bool open( const char *path, uint64_t source = 0 );
+
+    ///
+    // close() - unmap the file (anything taken from it is then gone)
+    ///
+    void close( void );
+
+    ///
+    // What is in it
+    ///
+    const MeshFileHeader &header( void ) const;
+    int numVertices( void ) const;
+    int numIndices( void ) const;
+    AttribView positions( void ) const;
+    AttribView colors( void ) const;
+    AttribView normals( void ) const;
+    AttribView uv( void ) const;
+    const GLuint *indices( void ) const;
+    const void *vertexBlock( void ) const;
+
+    ///
+    // size() - the size of the file, in bytes
+    ///
+    size_t size( void ) const;
+
+private:
+
+    const unsigned char *base;
+    size_t length;
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file, mapping;
+#endif
+
+    AttribView views[MESH_ATTRIBUTES];
+
+    bool check( uint64_t source );
+
+    // there is one mapping per MeshFile
+    MeshFile( const MeshFile & );
+    MeshFile &operator=( const MeshFile & );
+};
+
+///
+// writeMeshFile() - write the mesh a Canvas holds to a mesh file
+//
+// The file is written under a temporary name and then renamed, so a
+// reader never maps half of one.
+//
+// @param path   - the file's name
+// @param C      - the Canvas
+// @param source - meshSource() of what the mesh was made from
+//
+// @return true if it was written
+///
+bool writeMeshFile( const char *path, Canvas &C, uint64_t source = 0 );
+
+///
+// meshSource() - a key for what a mesh is made from
+//
+// The key is a hash of the recipe (the generator and its parameters,
+// say) and, if there is a source file, of its path, size and
+// modification time, so editing the file, or naming a different one,
+// gives a different key.
+//
+// @param recipe - how the mesh is made
+// @param file   - the file it is read from, or NULL
+//
+// @return the key
+///
+uint64_t meshSource( const char *recipe, const char *file = NULL );
+
+#endif
@@ -0,0 +1,1355 @@
+///
+//  MeshImport.cpp
+//
+//  Streaming OBJ and binary PLY import.
+///
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cctype>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "MeshImport.h"
+
+using namespace std;
+
+///
+// A window onto a file, refilled as it is consumed
+///
+class ByteStream {
+
+public:
+
+    ByteStream( void ) : f(NULL), begin(0), end(0), eof(false), size(0),
+        consumed(0) {}
+    ~ByteStream( void ) { if( f != NULL ) fclose( f ); }
+
+    bool open( const char *path, size_t &bytes ) {
+        f = fopen( path, "rb" );
+        if( f == NULL ) {
+            return false;
+        }
+        fseek( f, 0, SEEK_END );
+        bytes = size = (size_t) ftell( f );
+        fseek( f, 0, SEEK_SET );
+        return true;
+    }
+
+    // make at least 'want' bytes available, unless the file ends first
+    // (only what is left of the window is kept)
+    size_t fill( size_t want ) {
+        if( end - begin >= want || eof ) {
+            return end - begin;
+        }
+        size_t have = end - begin;
+        if( begin > 0 ) {
+            memmove( buf.data(), buf.data() + begin, have );
+        }
+        begin = 0;
+        end = have;
+        // one spare byte, for a final line end (see endLine())
+        if( buf.size() < want + 1 ) {
+            buf.resize( want + 1 );
+        }
+        size_t n = fread( buf.data() + end, 1, want - have, f );
+        end += n;
+        if( n < want - have ) {
+            eof = true;
+        }
+        return end - begin;
+    }
+
+    // make sure what is left ends with a line end, once the whole
+    // file is in the window
+    void endLine( void ) {
+        if( eof && end > begin && buf[end - 1] != '\n' ) {
+            buf[end++] = '\n';
+        }
+    }
+
+    const char *data( void ) const { return buf.data() + begin; }
+    size_t available( void ) const { return end - begin; }
+    void consume( size_t n ) { begin += n; consumed += n; }
+    bool atEnd( void ) const { return eof && begin == end; }
+    bool failed( void ) const { return f != NULL && ferror( f ) != 0; }
+
+    // bytes of the file not yet consumed
+    size_t remaining( void ) const {
+        return consumed < size ? size - consumed : 0;
+    }
+
+private:
+
+    FILE *f;
+    vector<char> buf;
+    size_t begin, end;
+    bool eof;
+    size_t size, consumed;
+
+    ByteStream( const ByteStream & );
+    ByteStream &operator=( const ByteStream & );
+};
+
+///
+// The parsed mesh, before it goes into the Canvas.  Vertex i has its
+// position at pos[3*posIndex[i]], its normal at nrm[3*nrmIndex[i]] and
+// its (u,v) at uv[2*uvIndex[i]]; an index array that is NULL means
+// index i itself, an index below zero (or a NULL array of attributes)
+// means the vertex has none.
+///
+typedef struct st_importmesh {
+    size_t vertices;
+    const vector<GLuint> *triangles;
+    const float *pos, *nrm, *uv;
+    const int *posIndex, *nrmIndex, *uvIndex;
+} ImportMesh;
+
+///
+// The batch of the file read at a time
+///
+static size_t batchBytes( WorkerPool &workers )
+{
+    return (size_t) workers.size() * IMPORT_CHUNKS * IMPORT_CHUNK;
+}
+
+///
+// addToCanvas() - copy a parsed mesh into a Canvas, finding the
+//     normals it lacks and fitting it to size if asked
+///
+static bool addToCanvas( const char *path, Canvas &C, WorkerPool &workers,
+    const ImportMesh &M, float fit )
+{
+    const vector<GLuint> &tris = *M.triangles;
+    size_t nt = tris.size() / 3;
+    if( M.vertices == 0 || nt == 0 ) {
+        cerr << path << ": no triangles" << endl;
+        return false;
+    }
+    if( M.vertices > INT_MAX || tris.size() > INT_MAX ) {
+        cerr << path << ": too large for a Canvas" << endl;
+        return false;
+    }
+
+    float *p, *n, *t = NULL;
+    GLuint *e;
+    GLuint base = C.addMesh( (int) M.vertices, (int) nt, &p, &n, &e,
+        M.uv != NULL ? &t : NULL );
+
+    vector<unsigned char> missing( M.vertices, 0 );
+    atomic<bool> anyMissing( false );
+
+    workers.run( M.vertices, 4096, [&]( size_t b, size_t end ) {
+        bool none = false;
+        for( size_t i = b; i < end; ++i ) {
+            const float *src = M.pos + 3 * (M.posIndex ? M.posIndex[i] : i);
+            p[4 * i] = src[0];
+            p[4 * i + 1] = src[1];
+            p[4 * i + 2] = src[2];
+            p[4 * i + 3] = 1.0f;
+
+            long k = M.nrm == NULL ? -1 : M.nrmIndex ? M.nrmIndex[i] :
+                (long) i;
+            if( k >= 0 ) {
+                n[3 * i] = M.nrm[3 * k];
+                n[3 * i + 1] = M.nrm[3 * k + 1];
+                n[3 * i + 2] = M.nrm[3 * k + 2];
+            } else {
+                n[3 * i] = n[3 * i + 1] = n[3 * i + 2] = 0.0f;
+                missing[i] = 1;
+                none = true;
+            }
+
+            if( t != NULL ) {
+                k = M.uvIndex ? M.uvIndex[i] : (long) i;
+                t[2 * i] = k >= 0 ? M.uv[2 * k] : 0.0f;
+                t[2 * i + 1] = k >= 0 ? M.uv[2 * k + 1] : 0.0f;
+            }
+        }
+        if( none ) {
+            anyMissing = true;
+        }
+    } );
+
+    workers.run( tris.size(), 65536, [&]( size_t b, size_t end ) {
+        for( size_t i = b; i < end; ++i ) {
+            e[i] = base + tris[i];
+        }
+    } );
+
+    // area-weighted face normals for the vertices without normals
+    if( anyMissing ) {
+        for( size_t i = 0; i < nt; ++i ) {
+            const GLuint *v = &tris[3 * i];
+            const float *a = p + 4 * v[0], *b = p + 4 * v[1],
+                *c = p + 4 * v[2];
+            float u[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+            float w[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+            float f[3] = {
+                u[1] * w[2] - u[2] * w[1],
+                u[2] * w[0] - u[0] * w[2],
+                u[0] * w[1] - u[1] * w[0]
+            };
+            for( int k = 0; k < 3; ++k ) {
+                if( missing[v[k]] ) {
+                    n[3 * v[k]] += f[0];
+                    n[3 * v[k] + 1] += f[1];
+                    n[3 * v[k] + 2] += f[2];
+                }
+            }
+        }
+        workers.run( M.vertices, 4096, [&]( size_t b, size_t end ) {
+            for( size_t i = b; i < end; ++i ) {
+                if( missing[i] ) {
+                    float *v = n + 3 * i;
+                    float len = sqrtf( v[0] * v[0] + v[1] * v[1] +
+                        v[2] * v[2] );
+                    if( len > 0.0f ) {
+                        v[0] /= len;
+                        v[1] /= len;
+                        v[2] /= len;
+                    } else {
+                        v[1] = 1.0f;
+                    }
+                }
+            }
+        } );
+    }
+
+    if( fit > 0.0f ) {
+        float lo[3] = { p[0], p[1], p[2] }, hi[3] = { p[0], p[1], p[2] };
+        for( size_t i = 1; i < M.vertices; ++i ) {
+            for( int k = 0; k < 3; ++k ) {
+                lo[k] = min( lo[k], p[4 * i + k] );
+                hi[k] = max( hi[k], p[4 * i + k] );
+            }
+        }
+        float mid[3], half = 0.0f;
+        for( int k = 0; k < 3; ++k ) {
+            mid[k] = 0.5f * (lo[k] + hi[k]);
+            half += 0.25f * (hi[k] - lo[k]) * (hi[k] - lo[k]);
+        }
+        float scale = half > 0.0f ? fit / sqrtf( half ) : 1.0f;
+        workers.run( M.vertices, 4096, [&]( size_t b, size_t end ) {
+            for( size_t i = b; i < end; ++i ) {
+                for( int k = 0; k < 3; ++k ) {
+                    p[4 * i + k] = (p[4 * i + k] - mid[k]) * scale;
+                }
+            }
+        } );
+    }
+
+    return true;
+}
+
+// ---------------------------------------------------------------------
+// OBJ
+// ---------------------------------------------------------------------
+
+///
+// Powers of ten that a double holds exactly
+///
+static const double exactPowers[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static inline const char *skipBlanks( const char *s )
+{
+    while( *s == ' ' || *s == '\t' ) {
+        ++s;
+    }
+    return s;
+}
+
+static inline bool isBlank( char c )
+{
+    return c == ' ' || c == '\t';
+}
+
+///
+// Longest number handed to strtod()
+///
+#define FLOAT_TOKEN     128
+
+///
+// slowFloat() - read a number with strtod(), which needs a string of
+//     its own:  the batch isn't NUL-terminated, and strtod() would skip
+//     a line end as blank space and read on into the next line (or
+//     past the end of the batch)
+//
+// @return just past the number, or NULL if there is none
+///
+static const char *slowFloat( const char *s, double &out )
+{
+    char token[FLOAT_TOKEN];
+    size_t n = 0;
+    while( n < FLOAT_TOKEN - 1 && s[n] != '\n' && s[n] != '\r' &&
+        !isBlank(s[n]) ) {
+        token[n] = s[n];
+        ++n;
+    }
+    token[n] = '\0';
+
+    char *end;
+    out = strtod( token, &end );
+    return end == token ? NULL : s + (end - token);
+}
+
+///
+// parseFloat() - read a decimal number
+//
+// Up to 19 significant digits are gathered into an integer, which is
+// scaled by an exact power of ten when that gives the correctly rounded
+// result; anything else (long mantissas, large exponents, "nan", "inf")
+// goes to slowFloat().  The text must end with a line end, and nothing
+// past it is read.
+//
+// @return just past the number, or NULL if there is none
+///
+static const char *parseFloat( const char *s, float &out )
+{
+    const char *start = s;
+    bool negative = *s == '-';
+    if( *s == '-' || *s == '+' ) {
+        ++s;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0, exponent = 0;
+    bool any = false;
+
+    for( ; *s >= '0' && *s <= '9'; ++s ) {
+        any = true;
+        if( digits < 19 ) {
+            mantissa = mantissa * 10 + (*s - '0');
+            digits += mantissa != 0;
+        } else {
+            ++exponent;
+        }
+    }
+    if( *s == '.' ) {
+        for( ++s; *s >= '0' && *s <= '9'; ++s ) {
+            any = true;
+            if( digits < 19 ) {
+                mantissa = mantissa * 10 + (*s - '0');
+                digits += mantissa != 0;
+                --exponent;
+            }
+        }
+    }
+    if( !any ) {
+        double v;
+        const char *end = slowFloat( start, v );
+        if( end != NULL ) {
+            out = (float) v;
+        }
+        return end;
+    }
+    if( *s == 'e' || *s == 'E' ) {
+        const char *e = s + 1;
+        bool minus = *e == '-';
+        if( *e == '-' || *e == '+' ) {
+            ++e;
+        }
+        if( *e >= '0' && *e <= '9' ) {
+            int x = 0;
+            for( ; *e >= '0' && *e <= '9'; ++e ) {
+                x = min( x * 10 + (*e - '0'), 100000 );
+            }
+            exponent += minus ? -x : x;
+            s = e;
+        }
+    }
+
+    double v;
+    if( mantissa < (1ULL << 53) && exponent >= -22 && exponent <= 22 ) {
+        v = (double) mantissa;
+        v = exponent < 0 ? v / exactPowers[-exponent] :
+            v * exactPowers[exponent];
+        if( negative ) {
+            v = -v;
+        }
+    } else if( slowFloat(start, v) == NULL ) {
+        return NULL;
+    }
+    out = (float) v;
+    return s;
+}
+
+///
+// parseInt() - read a (possibly negative) decimal integer
+//
+// @return just past it, or NULL if there is none (or it won't fit)
+///
+static const char *parseInt( const char *s, int &out )
+{
+    bool negative = *s == '-';
+    if( *s == '-' || *s == '+' ) {
+        ++s;
+    }
+    if( *s < '0' || *s > '9' ) {
+        return NULL;
+    }
+    long long v = 0;
+    for( ; *s >= '0' && *s <= '9'; ++s ) {
+        v = v * 10 + (*s - '0');
+        if( v > INT_MAX ) {
+            return NULL;
+        }
+    }
+    out = negative ? (int) -v : (int) v;
+    return s;
+}
+
+///
+// A face corner, as indices into the position, (u,v) and normal pools.
+// Negative indices in the file are counted back from the end of the
+// chunk's own pool, and flagged, so that the chunk's place in the whole
+// file can be added when the chunks are merged.
+///
+static const int OBJ_NONE = INT_MIN;
+
+#define OBJ_REL_V   0x1
+#define OBJ_REL_T   0x2
+#define OBJ_REL_N   0x4
+
+typedef struct st_objcorner {
+    int v, t, n;
+} ObjCorner;
+
+///
+// One chunk of an OBJ file, and what was found in it
+///
+typedef struct st_objchunk {
+    const char *begin, *end;
+    vector<float> v, t, n;
+    vector<ObjCorner> corners;      // three per triangle
+    vector<unsigned char> relative; // OBJ_REL_* for each corner
+    long lines;
+    long badLine;                   // within the chunk, or 0
+} ObjChunk;
+
+///
+// objIndex() - turn an index from the file into a pool index
+//
+// @return false if it is 0 (which OBJ doesn't use)
+///
+static inline bool objIndex( int raw, size_t count, int &out,
+    unsigned char &rel, unsigned char flag )
+{
+    if( raw > 0 ) {
+        out = raw - 1;
+    } else if( raw < 0 ) {
+        out = (int) count + raw;
+        rel |= flag;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+///
+// parseObjChunk() - parse the lines of one chunk
+///
+static void parseObjChunk( ObjChunk &c )
+{
+    c.v.clear();
+    c.t.clear();
+    c.n.clear();
+    c.corners.clear();
+    c.relative.clear();
+    c.lines = 0;
+    c.badLine = 0;
+
+    ObjCorner first = { 0, 0, 0 }, prev = { 0, 0, 0 };
+    unsigned char firstRel = 0, prevRel = 0;
+
+    for( const char *s = c.begin; s < c.end; ) {
+        ++c.lines;
+        s = skipBlanks( s );
+        bool ok = true;
+
+        if( s[0] == 'v' && isBlank(s[1]) ) {
+            float x, y, z;
+            const char *q = parseFloat( skipBlanks(s + 2), x );
+            q = q ? parseFloat( skipBlanks(q), y ) : NULL;
+            q = q ? parseFloat( skipBlanks(q), z ) : NULL;
+            if( q != NULL ) {
+                c.v.push_back( x );
+                c.v.push_back( y );
+                c.v.push_back( z );
+            }
+            ok = q != NULL;
+        } else if( s[0] == 'v' && s[1] == 't' && isBlank(s[2]) ) {
+            float u, v = 0.0f;
+            const char *q = parseFloat( skipBlanks(s + 3), u );
+            if( q != NULL ) {
+                parseFloat( skipBlanks(q), v );
+                c.t.push_back( u );
+                c.t.push_back( v );
+            }
+            ok = q != NULL;
+        } else if( s[0] == 'v' && s[1] == 'n' && isBlank(s[2]) ) {
+            float x, y, z;
+            const char *q = parseFloat( skipBlanks(s + 3), x );
+            q = q ? parseFloat( skipBlanks(q), y ) : NULL;
+            q = q ? parseFloat( skipBlanks(q), z ) : NULL;
+            if( q != NULL ) {
+                c.n.push_back( x );
+                c.n.push_back( y );
+                c.n.push_back( z );
+            }
+            ok = q != NULL;
+        } else if( s[0] == 'f' && isBlank(s[1]) ) {
+            int corners = 0;
+            const char *q = skipBlanks( s + 2 );
+            while( ok && *q != '\n' && *q != '\r' ) {
+                ObjCorner k = { OBJ_NONE, OBJ_NONE, OBJ_NONE };
+                unsigned char rel = 0;
+                int raw;
+
+                q = parseInt( q, raw );
+                ok = q != NULL &&
+                    objIndex( raw, c.v.size() / 3, k.v, rel, OBJ_REL_V );
+                if( ok && *q == '/' ) {
+                    ++q;
+                    if( *q != '/' ) {
+                        q = parseInt( q, raw );
+                        ok = q != NULL &&
+                            objIndex( raw, c.t.size() / 2, k.t, rel,
+                                OBJ_REL_T );
+                    }
+                    if( ok && *q == '/' ) {
+                        q = parseInt( q + 1, raw );
+                        ok = q != NULL &&
+                            objIndex( raw, c.n.size() / 3, k.n, rel,
+                                OBJ_REL_N );
+                    }
+                }
+                if( !ok ) {
+                    break;
+                }
+                q = skipBlanks( q );
+
+                // a fan from the first corner
+                if( corners == 0 ) {
+                    first = k;
+                    firstRel = rel;
+                } else if( corners >= 2 ) {
+                    c.corners.push_back( first );
+                    c.corners.push_back( prev );
+                    c.corners.push_back( k );
+                    c.relative.push_back( firstRel );
+                    c.relative.push_back( prevRel );
+                    c.relative.push_back( rel );
+                }
+                prev = k;
+                prevRel = rel;
+                ++corners;
+            }
+            ok = ok && corners >= 3;
+        }
+
+        if( !ok && c.badLine == 0 ) {
+            c.badLine = c.lines;
+        }
+        s = (const char *) memchr( s, '\n', c.end - s ) + 1;
+    }
+}
+
+///
+// The OBJ file as merged so far
+///
+typedef struct st_objmesh {
+    vector<float> v, t, n;          // the pools
+    vector<int> head;               // first Canvas vertex of each position
+    vector<int> vertV, vertT, vertN, next;
+    vector<GLuint> triangles;
+    bool anyUV;
+} ObjMesh;
+
+///
+// mergeObjChunk() - add a parsed chunk to the mesh, giving each new
+//     combination of position, (u,v) and normal a vertex of its own
+///
+static bool mergeObjChunk( const char *path, ObjMesh &M, const ObjChunk &c,
+    long line )
+{
+    if( c.badLine != 0 ) {
+        cerr << path << ":" << line + c.badLine << ": can't read this line"
+            << endl;
+        return false;
+    }
+
+    int vBase = (int) (M.v.size() / 3);
+    int tBase = (int) (M.t.size() / 2);
+    int nBase = (int) (M.n.size() / 3);
+    M.v.insert( M.v.end(), c.v.begin(), c.v.end() );
+    M.t.insert( M.t.end(), c.t.begin(), c.t.end() );
+    M.n.insert( M.n.end(), c.n.begin(), c.n.end() );
+    int nv = (int) (M.v.size() / 3);
+    int nt = (int) (M.t.size() / 2);
+    int nn = (int) (M.n.size() / 3);
+    M.head.resize( nv, -1 );
+
+    for( size_t i = 0; i < c.corners.size(); ++i ) {
+        const ObjCorner &k = c.corners[i];
+        unsigned char rel = c.relative[i];
+        int v = k.v + (rel & OBJ_REL_V ? vBase : 0);
+        int t = k.t == OBJ_NONE ? -1 : k.t + (rel & OBJ_REL_T ? tBase : 0);
+        int n = k.n == OBJ_NONE ? -1 : k.n + (rel & OBJ_REL_N ? nBase : 0);
+        if( v < 0 || v >= nv || (k.t != OBJ_NONE && (t < 0 || t >= nt)) ||
+            (k.n != OBJ_NONE && (n < 0 || n >= nn)) ) {
+            cerr << path << ": a face before line " << line + c.lines <<
+                " uses a vertex that isn't defined before it" << endl;
+            return false;
+        }
+
+        int j = M.head[v];
+        while( j >= 0 && (M.vertT[j] != t || M.vertN[j] != n) ) {
+            j = M.next[j];
+        }
+        if( j < 0 ) {
+            j = (int) M.vertV.size();
+            M.vertV.push_back( v );
+            M.vertT.push_back( t );
+            M.vertN.push_back( n );
+            M.next.push_back( M.head[v] );
+            M.head[v] = j;
+            M.anyUV = M.anyUV || t >= 0;
+        }
+        M.triangles.push_back( (GLuint) j );
+    }
+
+    return true;
+}
+
+///
+// importOBJ() - add the mesh in an OBJ file to a Canvas
+///
+bool importOBJ( const char *path, Canvas &C, WorkerPool &workers,
+    ImportStats *stats, float fit )
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    ByteStream in;
+    size_t bytes = 0;
+    if( !in.open(path, bytes) ) {
+        cerr << "can't open " << path << endl;
+        return false;
+    }
+
+    ObjMesh M;
+    M.anyUV = false;
+    vector<ObjChunk> chunks( workers.size() * IMPORT_CHUNKS + 1 );
+    size_t batch = batchBytes( workers );
+    long line = 0;
+
+    while( !in.atEnd() ) {
+        in.fill( batch );
+        in.endLine();
+        size_t have = in.available();
+        const char *data = in.data();
+        if( have == 0 ) {
+            break;
+        }
+
+        // whole lines only; the rest waits for the next batch
+        size_t used = have;
+        while( used > 0 && data[used - 1] != '\n' ) {
+            --used;
+        }
+        if( used == 0 ) {
+            if( in.failed() ) {
+                cerr << "can't read " << path << endl;
+            } else {
+                cerr << path << ":" << line + 1 << ": line too long" << endl;
+            }
+            return false;
+        }
+
+        // cut the batch into chunks at line ends
+        size_t count = 0;
+        for( size_t b = 0; b < used; ++count ) {
+            size_t e = min( used, b + IMPORT_CHUNK );
+            while( data[e - 1] != '\n' ) {
+                ++e;
+            }
+            chunks[count].begin = data + b;
+            chunks[count].end = data + e;
+            b = e;
+        }
+
+        workers.run( count, 1, [&]( size_t b, size_t e ) {
+            for( size_t i = b; i < e; ++i ) {
+                parseObjChunk( chunks[i] );
+            }
+        } );
+
+        for( size_t i = 0; i < count; ++i ) {
+            if( !mergeObjChunk(path, M, chunks[i], line) ) {
+                return false;
+            }
+            line += chunks[i].lines;
+        }
+
+        in.consume( used );
+    }
+
+    if( in.failed() ) {
+        cerr << "can't read " << path << endl;
+        return false;
+    }
+
+    // the staging memory can go before the Canvas grows
+    vector<ObjChunk>().swap( chunks );
+    vector<int>().swap( M.head );
+    vector<int>().swap( M.next );
+
+    ImportMesh mesh;
+    mesh.vertices = M.vertV.size();
+    mesh.triangles = &M.triangles;
+    mesh.pos = M.v.data();
+    mesh.nrm = M.n.empty() ? NULL : M.n.data();
+    mesh.uv = M.anyUV ? M.t.data() : NULL;
+    mesh.posIndex = M.vertV.data();
+    mesh.nrmIndex = M.vertN.data();
+    mesh.uvIndex = M.vertT.data();
+
+    if( !addToCanvas(path, C, workers, mesh, fit) ) {
+        return false;
+    }
+
+    if( stats != NULL ) {
+        stats->bytes = bytes;
+        stats->vertices = (long) mesh.vertices;
+        stats->triangles = (long) (M.triangles.size() / 3);
+        stats->millis = chrono::duration<double, milli>(
+            chrono::steady_clock::now() - start ).count();
+    }
+
+    return true;
+}
+
+// ---------------------------------------------------------------------
+// PLY
+// ---------------------------------------------------------------------
+
+///
+// PLY scalar types
+///
+enum { PLY_INT8, PLY_UINT8, PLY_INT16, PLY_UINT16, PLY_INT32, PLY_UINT32,
+       PLY_FLOAT32, PLY_FLOAT64, PLY_TYPES };
+
+static const size_t plySizes[PLY_TYPES] = { 1, 1, 2, 2, 4, 4, 4, 8 };
+
+///
+// The largest header read
+///
+#define PLY_HEADER_MAX      65536
+
+typedef struct st_plyproperty {
+    string name;
+    int type;                   // PLY_*, of the items of a list
+    bool list;
+    int countType;              // PLY_*, of the length of a list
+    size_t offset;              // in a fixed-size record
+} PlyProperty;
+
+typedef struct st_plyelement {
+    string name;
+    size_t count;
+    vector<PlyProperty> props;
+    bool fixed;                 // no lists, so every record is 'stride'
+    size_t stride;
+} PlyElement;
+
+///
+// plyType() - the PLY_* for a type name, or -1
+///
+static int plyType( const string &name )
+{
+    static const char *names[][2] = {
+        { "char", "int8" }, { "uchar", "uint8" }, { "short", "int16" },
+        { "ushort", "uint16" }, { "int", "int32" }, { "uint", "uint32" },
+        { "float", "float32" }, { "double", "float64" }
+    };
+    for( int i = 0; i < PLY_TYPES; ++i ) {
+        if( name == names[i][0] || name == names[i][1] ) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+///
+// plyValue() - read one scalar of a record
+///
+static inline double plyValue( const char *p, int type, bool swap )
+{
+    unsigned char b[8];
+    size_t n = plySizes[type];
+    if( swap ) {
+        for( size_t i = 0; i < n; ++i ) {
+            b[i] = (unsigned char) p[n - 1 - i];
+        }
+    } else {
+        memcpy( b, p, n );
+    }
+
+    switch( type ) {
+    case PLY_INT8:    { int8_t v; memcpy( &v, b, 1 ); return v; }
+    case PLY_UINT8:   { uint8_t v; memcpy( &v, b, 1 ); return v; }
+    case PLY_INT16:   { int16_t v; memcpy( &v, b, 2 ); return v; }
+    case PLY_UINT16:  { uint16_t v; memcpy( &v, b, 2 ); return v; }
+    case PLY_INT32:   { int32_t v; memcpy( &v, b, 4 ); return v; }
+    case PLY_UINT32:  { uint32_t v; memcpy( &v, b, 4 ); return v; }
+    case PLY_FLOAT32: { float v; memcpy( &v, b, 4 ); return v; }
+    default:          { double v; memcpy( &v, b, 8 ); return v; }
+    }
+}
+
+///
+// plyRecord() - find the size of a record of an element with lists
+//
+// @param list  - which property's items to return, or -1
+// @param items - receives that list's items
+//
+// @return the size, or 0 if the record isn't all in 'avail' bytes
+///
+static size_t plyRecord( const char *p, size_t avail, const PlyElement &E,
+    bool swap, int list, vector<double> *items )
+{
+    size_t size = 0;
+    for( size_t i = 0; i < E.props.size(); ++i ) {
+        const PlyProperty &P = E.props[i];
+        if( !P.list ) {
+            size += plySizes[P.type];
+            continue;
+        }
+        if( size + plySizes[P.countType] > avail ) {
+            return 0;
+        }
+        double n = plyValue( p + size, P.countType, swap );
+        size += plySizes[P.countType];
+        if( n < 0 || size + (size_t) n * plySizes[P.type] > avail ) {
+            return 0;
+        }
+        if( (int) i == list ) {
+            items->clear();
+            for( size_t k = 0; k < (size_t) n; ++k ) {
+                items->push_back( plyValue(p + size + k * plySizes[P.type],
+                    P.type, swap) );
+            }
+        }
+        size += (size_t) n * plySizes[P.type];
+    }
+    return size <= avail ? size : 0;
+}
+
+///
+// readPlyHeader() - read and check a PLY header
+//
+// @return false (having said why) if it can't be used
+///
+static bool readPlyHeader( const char *path, ByteStream &in,
+    vector<PlyElement> &elements, bool &swap )
+{
+    in.fill( PLY_HEADER_MAX );
+    const char *data = in.data();
+    size_t have = in.available();
+
+    if( have < 4 || memcmp(data, "ply", 3) != 0 ||
+        (data[3] != '\n' && data[3] != '\r') ) {
+        cerr << path << ": not a PLY file" << endl;
+        return false;
+    }
+
+    size_t pos = 0;
+    bool format = false, done = false;
+    while( !done ) {
+        size_t eol = pos;
+        while( eol < have && data[eol] != '\n' ) {
+            ++eol;
+        }
+        if( eol == have ) {
+            cerr << path << ": the PLY header is too long" << endl;
+            return false;
+        }
+
+        // the words of the line
+        vector<string> words;
+        for( size_t i = pos; i < eol; ) {
+            while( i < eol && (isBlank(data[i]) || data[i] == '\r') ) {
+                ++i;
+            }
+            size_t j = i;
+            while( j < eol && !isBlank(data[j]) && data[j] != '\r' ) {
+                ++j;
+            }
+            if( j > i ) {
+                words.push_back( string(data + i, j - i) );
+            }
+            i = j;
+        }
+        pos = eol + 1;
+
+        if( words.empty() || words[0] == "ply" || words[0] == "comment" ||
+            words[0] == "obj_info" ) {
+            continue;
+        }
+
+        if( words[0] == "format" && words.size() == 3 ) {
+            if( words[1] == "ascii" ) {
+                cerr << path << ": ASCII PLY files aren't supported; only "
+                    "binary ones" << endl;
+                return false;
+            }
+            uint16_t one = 1;
+            bool little = *(unsigned char *) &one == 1;
+            if( words[1] == "binary_little_endian" ) {
+                swap = !little;
+            } else if( words[1] == "binary_big_endian" ) {
+                swap = little;
+            } else {
+                break;
+            }
+            format = true;
+        } else if( words[0] == "element" && words.size() == 3 ) {
+            PlyElement E;
+            E.name = words[1];
+            E.count = (size_t) strtoull( words[2].c_str(), NULL, 10 );
+            E.fixed = true;
+            E.stride = 0;
+            elements.push_back( E );
+        } else if( words[0] == "property" && !elements.empty() ) {
+            PlyElement &E = elements.back();
+            PlyProperty P;
+            P.list = words.size() == 5 && words[1] == "list";
+            if( P.list ) {
+                P.countType = plyType( words[2] );
+                P.type = plyType( words[3] );
+                P.name = words[4];
+                if( P.countType < 0 || P.countType >= PLY_FLOAT32 ) {
+                    break;
+                }
+                E.fixed = false;
+            } else if( words.size() == 3 ) {
+                P.countType = -1;
+                P.type = plyType( words[1] );
+                P.name = words[2];
+            } else {
+                break;
+            }
+            if( P.type < 0 ) {
+                break;
+            }
+            P.offset = E.stride;
+            E.stride += plySizes[P.type];
+            E.props.push_back( P );
+        } else if( words[0] == "end_header" ) {
+            done = true;
+        } else {
+            break;
+        }
+    }
+
+    if( !done || !format ) {
+        cerr << path << ": can't read the PLY header" << endl;
+        return false;
+    }
+
+    in.consume( pos );
+    return true;
+}
+
+///
+// findPly() - the index of the first of 'names' an element has, or -1
+///
+static int findPly( const PlyElement &E, const char *a, const char *b = NULL,
+    const char *c = NULL )
+{
+    for( size_t i = 0; i < E.props.size(); ++i ) {
+        const string &n = E.props[i].name;
+        if( !E.props[i].list && (n == a || (b && n == b) || (c && n == c)) ) {
+            return (int) i;
+        }
+    }
+    return -1;
+}
+
+///
+// The PLY file as read so far
+///
+typedef struct st_plymesh {
+    size_t vertices;
+    vector<float> pos, nrm, uv;
+    vector<GLuint> triangles;
+} PlyMesh;
+
+///
+// readPlyVertices() - read the vertex element, in parallel batches
+///
+static bool readPlyVertices( const char *path, ByteStream &in,
+    WorkerPool &workers, const PlyElement &E, bool swap, PlyMesh &M )
+{
+    if( !E.fixed ) {
+        cerr << path << ": PLY vertices with list properties aren't "
+            "supported" << endl;
+        return false;
+    }
+
+    int xyz[3] = { findPly(E, "x"), findPly(E, "y"), findPly(E, "z") };
+    int nxyz[3] = { findPly(E, "nx"), findPly(E, "ny"), findPly(E, "nz") };
+    int uv[2] = { findPly(E, "u", "s", "texture_u"),
+                  findPly(E, "v", "t", "texture_v") };
+    if( xyz[0] < 0 || xyz[1] < 0 || xyz[2] < 0 ) {
+        cerr << path << ": PLY vertices have no x, y and z" << endl;
+        return false;
+    }
+    bool normals = nxyz[0] >= 0 && nxyz[1] >= 0 && nxyz[2] >= 0;
+    bool texCoords = uv[0] >= 0 && uv[1] >= 0;
+
+    // the count is only the header's word, so check it before the
+    // arrays are made that big
+    if( E.count > in.remaining() / E.stride ) {
+        cerr << path << ": the file ends in the vertices" << endl;
+        return false;
+    }
+
+    M.vertices = E.count;
+    M.pos.resize( 3 * E.count );
+    if( normals ) {
+        M.nrm.resize( 3 * E.count );
+    }
+    if( texCoords ) {
+        M.uv.resize( 2 * E.count );
+    }
+
+    size_t perBatch = max( (size_t) 1, batchBytes(workers) / E.stride );
+    for( size_t done = 0; done < E.count; ) {
+        size_t n = min( perBatch, E.count - done );
+        if( in.fill(n * E.stride) < n * E.stride ) {
+            cerr << path << ": the file ends in the vertices" << endl;
+            return false;
+        }
+        const char *data = in.data();
+
+        workers.run( n, 4096, [&]( size_t b, size_t e ) {
+            for( size_t i = b; i < e; ++i ) {
+                const char *r = data + i * E.stride;
+                size_t v = done + i;
+                for( int k = 0; k < 3; ++k ) {
+                    const PlyProperty &P = E.props[xyz[k]];
+                    M.pos[3 * v + k] =
+                        (float) plyValue( r + P.offset, P.type, swap );
+                }
+                if( normals ) {
+                    for( int k = 0; k < 3; ++k ) {
+                        const PlyProperty &P = E.props[nxyz[k]];
+                        M.nrm[3 * v + k] =
+                            (float) plyValue( r + P.offset, P.type, swap );
+                    }
+                }
+                if( texCoords ) {
+                    for( int k = 0; k < 2; ++k ) {
+                        const PlyProperty &P = E.props[uv[k]];
+                        M.uv[2 * v + k] =
+                            (float) plyValue( r + P.offset, P.type, swap );
+                    }
+                }
+            }
+        } );
+
+        in.consume( n * E.stride );
+        done += n;
+    }
+
+    return true;
+}
+
+///
+// readPlyFaces() - read the face element:  in parallel batches up to
+//     the first face that isn't a triangle, and one by one after it
+///
+static bool readPlyFaces( const char *path, ByteStream &in,
+    WorkerPool &workers, const PlyElement &E, bool swap, PlyMesh &M )
+{
+    int list = -1;
+    int lists = 0;
+    for( size_t i = 0; i < E.props.size(); ++i ) {
+        if( E.props[i].list ) {
+            ++lists;
+            if( E.props[i].name == "vertex_indices" ||
+                E.props[i].name == "vertex_index" ) {
+                list = (int) i;
+            }
+        }
+    }
+    if( list < 0 ) {
+        cerr << path << ": PLY faces have no vertex_indices" << endl;
+        return false;
+    }
+
+    // a triangle's record, when its list is the only one
+    const PlyProperty &L = E.props[list];
+    size_t before = 0, tri = 0;
+    for( size_t i = 0; i < E.props.size(); ++i ) {
+        if( (int) i < list ) {
+            before += plySizes[E.props[i].type];
+        }
+        tri += E.props[i].list ? 0 : plySizes[E.props[i].type];
+    }
+    tri += plySizes[L.countType] + 3 * plySizes[L.type];
+    bool parallel = lists == 1;
+
+    // every face takes at least its fixed properties and list lengths,
+    // so a count the file can't hold is found before anything is made
+    // that big
+    size_t least = 0;
+    for( size_t i = 0; i < E.props.size(); ++i ) {
+        const PlyProperty &P = E.props[i];
+        least += plySizes[P.list ? P.countType : P.type];
+    }
+    if( E.count > in.remaining() / least ) {
+        cerr << path << ": the file ends in the faces" << endl;
+        return false;
+    }
+
+    size_t batch = batchBytes( workers );
+    size_t vertices = M.vertices;
+    M.triangles.reserve( 3 * min(E.count, in.remaining() / tri) );
+    vector<double> items;
+
+    for( size_t done = 0; done < E.count; ) {
+        size_t have = in.fill( batch );
+
+        if( parallel ) {
+            size_t n = min( E.count - done, have / tri );
+            if( n == 0 ) {
+                cerr << path << ": the file ends in the faces" << endl;
+                return false;
+            }
+            const char *data = in.data();
+
+            // records only line up up to the first face that isn't a
+            // triangle, so find that before reading any indices
+            size_t m = 0;
+            while( m < n && plyValue(data + m * tri + before, L.countType,
+                swap) == 3 ) {
+                ++m;
+            }
+
+            size_t base = M.triangles.size();
+            M.triangles.resize( base + 3 * m );
+            atomic<bool> bad( false );
+
+            workers.run( m, 4096, [&]( size_t b, size_t e ) {
+                for( size_t i = b; i < e; ++i ) {
+                    const char *r = data + i * tri + before +
+                        plySizes[L.countType];
+                    for( int k = 0; k < 3; ++k ) {
+                        double v = plyValue( r + k * plySizes[L.type],
+                            L.type, swap );
+                        if( v < 0 || v >= (double) vertices ) {
+                            bad = true;
+                        }
+                        M.triangles[base + 3 * i + k] = (GLuint) v;
+                    }
+                }
+            } );
+
+            if( bad ) {
+                cerr << path << ": a face uses a vertex that doesn't exist"
+                    << endl;
+                return false;
+            }
+            in.consume( m * tri );
+            done += m;
+            if( m == n ) {
+                continue;
+            }
+
+            // not all triangles:  the rest one by one
+            have = in.available();
+            parallel = false;
+        }
+
+        size_t used = 0;
+        const char *data = in.data();
+        while( done < E.count ) {
+            size_t size = plyRecord( data + used, have - used, E, swap, list,
+                &items );
+            if( size == 0 ) {
+                break;
+            }
+            for( size_t k = 0; k < items.size(); ++k ) {
+                if( items[k] < 0 || items[k] >= (double) vertices ) {
+                    cerr << path << ": a face uses a vertex that doesn't "
+                        "exist" << endl;
+                    return false;
+                }
+            }
+            for( size_t k = 2; k < items.size(); ++k ) {
+                M.triangles.push_back( (GLuint) items[0] );
+                M.triangles.push_back( (GLuint) items[k - 1] );
+                M.triangles.push_back( (GLuint) items[k] );
+            }
+            used += size;
+            ++done;
+        }
+        if( used == 0 && done < E.count ) {
+            cerr << path << ": the file ends in the faces" << endl;
+            return false;
+        }
+        in.consume( used );
+    }
+
+    return true;
+}
+
+///
+// skipPly() - read past an element we have no use for
+///
+static bool skipPly( const char *path, ByteStream &in, WorkerPool &workers,
+    const PlyElement &E, bool swap )
+{
+    size_t batch = batchBytes( workers );
+    size_t done = 0;
+    while( done < E.count ) {
+        size_t have = in.fill( batch );
+        size_t used = 0;
+        if( E.fixed ) {
+            size_t n = min( E.count - done, have / max((size_t) 1,
+                E.stride) );
+            used = n * E.stride;
+            done += n;
+            if( n == 0 ) {
+                break;
+            }
+        } else {
+            size_t size;
+            while( done < E.count && (size = plyRecord(in.data() + used,
+                have - used, E, swap, -1, NULL)) > 0 ) {
+                used += size;
+                ++done;
+            }
+            if( used == 0 ) {
+                break;
+            }
+        }
+        in.consume( used );
+    }
+
+    if( done < E.count ) {
+        cerr << path << ": the file ends in the " << E.name << " element"
+            << endl;
+        return false;
+    }
+    return true;
+}
+
+///
+// importPLY() - add the mesh in a binary PLY file to a Canvas
+///
+bool importPLY( const char *path, Canvas &C, WorkerPool &workers,
+    ImportStats *stats, float fit )
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    ByteStream in;
+    size_t bytes = 0;
+    if( !in.open(path, bytes) ) {
+        cerr << "can't open " << path << endl;
+        return false;
+    }
+
+    vector<PlyElement> elements;
+    bool swap = false;
+    if( !readPlyHeader(path, in, elements, swap) ) {
+        return false;
+    }
+
+    PlyMesh M;
+    M.vertices = 0;
+    bool vertices = false;
+    for( size_t i = 0; i < elements.size(); ++i ) {
+        const PlyElement &E = elements[i];
+        bool ok;
+        if( E.name == "vertex" && !vertices ) {
+            ok = readPlyVertices( path, in, workers, E, swap, M );
+            vertices = true;
+        } else if( E.name == "face" && vertices ) {
+            ok = readPlyFaces( path, in, workers, E, swap, M );
+        } else if( E.name == "face" ) {
+            cerr << path << ": PLY faces before the vertices aren't "
+                "supported" << endl;
+            ok = false;
+        } else {
+            ok = skipPly( path, in, workers, E, swap );
+        }
+        if( !ok ) {
+            return false;
+        }
+    }
+
+    if( in.failed() ) {
+        cerr << "can't read " << path << endl;
+        return false;
+    }
+
+    ImportMesh mesh;
+    mesh.vertices = M.vertices;
+    mesh.triangles = &M.triangles;
+    mesh.pos = M.pos.data();
+    mesh.nrm = M.nrm.empty() ? NULL : M.nrm.data();
+    mesh.uv = M.uv.empty() ? NULL : M.uv.data();
+    mesh.posIndex = mesh.nrmIndex = mesh.uvIndex = NULL;
+
+    if( !addToCanvas(path, C, workers, mesh, fit) ) {
+        return false;
+    }
+
+    if( stats != NULL ) {
+        stats->bytes = bytes;
+        stats->vertices = (long) M.vertices;
+        stats->triangles = (long) (M.triangles.size() / 3);
+        stats->millis = chrono::duration<double, milli>(
+            chrono::steady_clock::now() - start ).count();
+    }
+
+    return true;
+}
+
+///
+// importMesh() - add the mesh in an OBJ or PLY file to a Canvas
+///
+bool importMesh( const char *path, Canvas &C, WorkerPool &workers,
+    ImportStats *stats, float fit )
+{
+    string name( path );
+    size_t dot = name.rfind( '.' );
+    string ext = dot == string::npos ? "" : name.substr( dot + 1 );
+    for( size_t i = 0; i < ext.size(); ++i ) {
+        ext[i] = (char) tolower( (unsigned char) ext[i] );
+    }
+
+    if( ext == "obj" ) {
+        return importOBJ( path, C, workers, stats, fit );
+    }
+    if( ext == "ply" ) {
+        return importPLY( path, C, workers, stats, fit );
+    }
+
+    cerr << path << ": not an .obj or .ply file" << endl;
+    return false;
+}
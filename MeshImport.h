@@ -0,0 +1,89 @@
+///
+//  MeshImport.h
+//
+//  Streaming import of Wavefront OBJ and binary PLY files into a
+//  Canvas, for meshes too large to write out as C arrays.
+//
+//  The file is read in batches of IMPORT_CHUNKS chunks per thread,
+//  each about IMPORT_CHUNK bytes, so only one batch of it is ever in
+//  memory.  The chunks of a batch are parsed in parallel by a
+//  WorkerPool (OBJ chunks end at line ends; PLY chunks at whole
+//  records), and then merged, in order, into the mesh on this thread.
+//
+//  OBJ:  v, vt, vn and f lines are used, and everything else ignored
+//  (groups, materials, smoothing, lines and points).  Faces of more
+//  than three corners are split into fans.  Negative (relative)
+//  indices are allowed.  Each distinct v/vt/vn combination becomes one
+//  Canvas vertex, since a Canvas vertex has one index for all of its
+//  attributes.
+//
+//  PLY:  binary_little_endian and binary_big_endian, with a "vertex"
+//  element (x, y, z and optionally nx, ny, nz and u, v or s, t, of any
+//  scalar type) and a "face" element with a vertex_indices (or
+//  vertex_index) list.  Other elements and properties are skipped.
+//  Faces are split among the threads up to the first one that isn't a
+//  triangle (found in order, since only triangles' records line up),
+//  and read one by one on this thread from there on.
+//
+//  Vertices without normals get the area-weighted average of the
+//  normals of the triangles around them.  The mesh is added with
+//  Canvas::addMesh(), so it is already indexed:  there is no need to
+//  weld() it.
+///
+
+#ifndef _MESHIMPORT_H_
+#define _MESHIMPORT_H_
+
+#include <cstddef>
+
+#include "Canvas.h"
+#include "WorkerPool.h"
+
+///
+// Size of the pieces each thread parses, in bytes
+///
+#define IMPORT_CHUNK        (1 << 20)
+
+///
+// Chunks per thread in each batch read from the file
+///
+#define IMPORT_CHUNKS       4
+
+///
+// What an import did
+///
+typedef struct st_importstats {
+    size_t bytes;               // size of the file
+    long vertices;              // Canvas vertices added
+    long triangles;             // triangles added
+    double millis;              // time taken, in milliseconds
+} ImportStats;
+
+///
+// importMesh() - add the mesh in an OBJ or PLY file to a Canvas
+//
+// The format is chosen by the file's extension (.obj or .ply).  On
+// failure, the reason is written to cerr and the Canvas is unchanged.
+//
+// @param path    - the file's name
+// @param C       - the Canvas to add it to
+// @param workers - the threads to parse it with
+// @param stats   - receives what was imported, or NULL
+// @param fit     - if above zero, the mesh is centered on the origin
+//                  and scaled so that its bounding box's half-diagonal
+//                  is this long
+//
+// @return true if the mesh was added
+///
+bool importMesh( const char *path, Canvas &C, WorkerPool &workers,
+    ImportStats *stats = NULL, float fit = 0.0f );
+
+///
+// importOBJ(), importPLY() - the same, for a known format
+///
+bool importOBJ( const char *path, Canvas &C, WorkerPool &workers,
+    ImportStats *stats = NULL, float fit = 0.0f );
+bool importPLY( const char *path, Canvas &C, WorkerPool &workers,
+    ImportStats *stats = NULL, float fit = 0.0f );
+
+#endif
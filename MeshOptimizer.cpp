@@ -0,0 +1,394 @@
+///
+//  MeshOptimizer.cpp
+//
+//  Load-time reordering of indexed triangle meshes for the vertex
+//  cache, overdraw, and vertex fetch.
+///
+
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+#include "MeshOptimizer.h"
+
+using namespace std;
+
+///
+// A simulated FIFO cache:  vertex v is in the cache if fewer than
+// VCACHE_FIFO vertices have been added since it was, which 'stamp'
+// records; reset() empties it
+///
+struct FifoCache {
+    vector<unsigned int> stamp;
+    unsigned int time;
+
+    FifoCache( size_t vertices ) : stamp( vertices, 0 ),
+        time( VCACHE_FIFO + 1 ) {
+    }
+
+    void reset( void ) {
+        time += VCACHE_FIFO + 1;
+    }
+
+    // add a vertex, returning 1 if it had to be transformed
+    unsigned int add( GLuint v ) {
+        if( time - stamp[v] > VCACHE_FIFO ) {
+            stamp[v] = time++;
+            return 1;
+        }
+        return 0;
+    }
+
+    // add a triangle's vertices, returning how many were transformed
+    unsigned int add( const GLuint *t ) {
+        return add( t[0] ) + add( t[1] ) + add( t[2] );
+    }
+};
+
+///
+// measureCache() - simulate a FIFO vertex cache of VCACHE_FIFO entries
+//
+// @param indices  - the triangles, three indices each
+// @param count    - the number of indices
+// @param vertices - the number of vertices
+///
+CacheStats measureCache( const GLuint *indices, size_t count,
+    size_t vertices )
+{
+    CacheStats s;
+    FifoCache cache( vertices );
+    vector<unsigned char> used( vertices, 0 );
+    size_t distinct = 0;
+
+    s.transforms = 0;
+    for( size_t i = 0; i < count; ++i ) {
+        s.transforms += cache.add( indices[i] );
+        if( !used[indices[i]] ) {
+            used[indices[i]] = 1;
+            ++distinct;
+        }
+    }
+
+    s.acmr = count > 0 ? (float) s.transforms / (count / 3) : 0.0f;
+    s.atvr = distinct > 0 ? (float) s.transforms / distinct : 0.0f;
+
+    return s;
+}
+
+///
+// Forsyth's scoring:  vertices of the last triangle drawn get a fixed
+// score, other cached vertices one falling off with their position,
+// and vertices with few triangles left get a boost, so that they are
+// finished off rather than left stranded
+///
+static const float LAST_TRIANGLE_SCORE = 0.75f;
+static const float CACHE_DECAY_POWER = 1.5f;
+static const float VALENCE_BOOST_SCALE = 2.0f;
+static const float VALENCE_BOOST_POWER = 0.5f;
+
+static float vertexScore( int position, unsigned int remaining )
+{
+    if( remaining == 0 ) {
+        return -1.0f;
+    }
+
+    float score = 0.0f;
+    if( position >= 0 ) {
+        if( position < 3 ) {
+            score = LAST_TRIANGLE_SCORE;
+        } else {
+            score = powf( 1.0f - (float) (position - 3) /
+                (VCACHE_SIZE - 3), CACHE_DECAY_POWER );
+        }
+    }
+
+    return score + VALENCE_BOOST_SCALE *
+        powf( (float) remaining, -VALENCE_BOOST_POWER );
+}
+
+///
+// optimizeVertexCache() - reorder triangles for the vertex cache
+//
+// @param dst      - receives the new order (not 'indices')
+// @param indices  - the triangles, three indices each
+// @param count    - the number of indices
+// @param vertices - the number of vertices
+///
+void optimizeVertexCache( GLuint *dst, const GLuint *indices, size_t count,
+    size_t vertices )
+{
+    size_t faces = count / 3;
+    if( faces == 0 ) {
+        return;
+    }
+
+    // each vertex's triangles; the first remaining[v] of them are the
+    // ones not yet drawn
+    vector<unsigned int> remaining( vertices, 0 );
+    for( size_t i = 0; i < count; ++i ) {
+        ++remaining[indices[i]];
+    }
+    vector<size_t> first( vertices + 1, 0 );
+    for( size_t v = 0; v < vertices; ++v ) {
+        first[v + 1] = first[v] + remaining[v];
+    }
+    vector<unsigned int> adjacent( count );
+    vector<size_t> fill( first.begin(), first.end() - 1 );
+    for( size_t i = 0; i < count; ++i ) {
+        adjacent[fill[indices[i]]++] = (unsigned int) (i / 3);
+    }
+
+    vector<int> position( vertices, -1 );
+    vector<float> vscore( vertices );
+    for( size_t v = 0; v < vertices; ++v ) {
+        vscore[v] = vertexScore( -1, remaining[v] );
+    }
+
+    vector<float> tscore( faces );
+    long best = 0;
+    for( size_t f = 0; f < faces; ++f ) {
+        tscore[f] = vscore[indices[3 * f]] + vscore[indices[3 * f + 1]] +
+            vscore[indices[3 * f + 2]];
+        if( tscore[f] > tscore[best] ) {
+            best = (long) f;
+        }
+    }
+
+    vector<unsigned char> drawn( faces, 0 );
+    GLuint cache[VCACHE_SIZE + 3], next[VCACHE_SIZE + 3];
+    int cached = 0;
+    size_t cursor = 0;
+
+    for( size_t out = 0; out < faces; ++out ) {
+
+        // at a dead end, carry on with the next triangle not yet drawn
+        if( best < 0 ) {
+            while( drawn[cursor] ) {
+                ++cursor;
+            }
+            best = (long) cursor;
+        }
+
+        const GLuint *t = &indices[3 * best];
+        drawn[best] = 1;
+        dst[3 * out] = t[0];
+        dst[3 * out + 1] = t[1];
+        dst[3 * out + 2] = t[2];
+
+        // it is no longer waiting to be drawn
+        for( int k = 0; k < 3; ++k ) {
+            GLuint v = t[k];
+            unsigned int *list = &adjacent[first[v]];
+            for( unsigned int j = 0; j < remaining[v]; ++j ) {
+                if( list[j] == (unsigned int) best ) {
+                    swap( list[j], list[remaining[v] - 1] );
+                    --remaining[v];
+                    break;
+                }
+            }
+        }
+
+        // its vertices go to the front of the cache
+        int n = 0;
+        for( int k = 0; k < 3; ++k ) {
+            if( find(next, next + n, t[k]) == next + n ) {
+                next[n++] = t[k];
+            }
+        }
+        for( int i = 0; i < cached; ++i ) {
+            if( cache[i] != t[0] && cache[i] != t[1] && cache[i] != t[2] ) {
+                next[n++] = cache[i];
+            }
+        }
+
+        // rescore the vertices that moved (or fell out), and their
+        // triangles
+        for( int i = 0; i < n; ++i ) {
+            GLuint v = next[i];
+            position[v] = i < VCACHE_SIZE ? i : -1;
+            float score = vertexScore( position[v], remaining[v] );
+            float change = score - vscore[v];
+            vscore[v] = score;
+            const unsigned int *list = &adjacent[first[v]];
+            for( unsigned int j = 0; j < remaining[v]; ++j ) {
+                tscore[list[j]] += change;
+            }
+        }
+
+        // the best triangle using a cached vertex is drawn next
+        cached = min( n, VCACHE_SIZE );
+        best = -1;
+        float bestScore = -1.0f;
+        for( int i = 0; i < cached; ++i ) {
+            GLuint v = next[i];
+            cache[i] = v;
+            const unsigned int *list = &adjacent[first[v]];
+            for( unsigned int j = 0; j < remaining[v]; ++j ) {
+                if( tscore[list[j]] > bestScore ) {
+                    bestScore = tscore[list[j]];
+                    best = list[j];
+                }
+            }
+        }
+    }
+}
+
+///
+// optimizeOverdraw() - reorder clusters of triangles, front-most first
+//
+// @param dst       - receives the new order (not 'indices')
+// @param indices   - the triangles, in vertex cache order
+// @param count     - the number of indices
+// @param positions - the vertex locations
+// @param stride    - floats from one location to the next
+// @param vertices  - the number of vertices
+// @param threshold - how much worse each cluster's ACMR may be made
+///
+void optimizeOverdraw( GLuint *dst, const GLuint *indices, size_t count,
+    const float *positions, size_t stride, size_t vertices,
+    float threshold )
+{
+    size_t faces = count / 3;
+    if( faces == 0 ) {
+        return;
+    }
+
+    FifoCache cache( vertices );
+
+    // the order already breaks wherever a triangle shares nothing with
+    // what is in the cache; those are free places to cut
+    vector<size_t> hard;
+    for( size_t f = 0; f < faces; ++f ) {
+        if( cache.add(&indices[3 * f]) == 3 || f == 0 ) {
+            hard.push_back( f );
+        }
+    }
+    hard.push_back( faces );
+
+    // cut each of those pieces further, as soon as the part cut off
+    // has (nearly) the whole piece's ACMR
+    vector<size_t> clusters;
+    for( size_t h = 0; h + 1 < hard.size(); ++h ) {
+        size_t start = hard[h], end = hard[h + 1];
+
+        cache.reset();
+        unsigned int misses = 0;
+        for( size_t f = start; f < end; ++f ) {
+            misses += cache.add( &indices[3 * f] );
+        }
+        float target = threshold * misses / (end - start);
+
+        cache.reset();
+        unsigned int runMisses = 0, runFaces = 0;
+        for( size_t f = start; f < end; ++f ) {
+            runMisses += cache.add( &indices[3 * f] );
+            ++runFaces;
+            if( (float) runMisses / runFaces <= target ) {
+                clusters.push_back( start );
+                start = f + 1;
+                cache.reset();
+                runMisses = runFaces = 0;
+            }
+        }
+        if( start < end ) {
+            clusters.push_back( start );
+        }
+    }
+    size_t nclusters = clusters.size();
+    clusters.push_back( faces );
+
+    // each cluster's (area weighted) center and facing, and the mesh's
+    vector<float> centers( 3 * nclusters ), facing( 3 * nclusters );
+    float mesh[3] = { 0.0f, 0.0f, 0.0f }, meshArea = 0.0f;
+
+    for( size_t c = 0; c < nclusters; ++c ) {
+        float center[3] = { 0.0f, 0.0f, 0.0f }, normal[3] = { 0.0f, 0.0f, 0.0f };
+        float area = 0.0f;
+
+        for( size_t f = clusters[c]; f < clusters[c + 1]; ++f ) {
+            const float *a = positions + stride * indices[3 * f];
+            const float *b = positions + stride * indices[3 * f + 1];
+            const float *d = positions + stride * indices[3 * f + 2];
+            float u[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+            float v[3] = { d[0] - a[0], d[1] - a[1], d[2] - a[2] };
+            float n[3] = { u[1] * v[2] - u[2] * v[1],
+                           u[2] * v[0] - u[0] * v[2],
+                           u[0] * v[1] - u[1] * v[0] };
+            float w = sqrtf( n[0] * n[0] + n[1] * n[1] + n[2] * n[2] );
+            for( int k = 0; k < 3; ++k ) {
+                center[k] += w * (a[k] + b[k] + d[k]) / 3.0f;
+                normal[k] += n[k];
+            }
+            area += w;
+        }
+
+        for( int k = 0; k < 3; ++k ) {
+            mesh[k] += center[k];
+            centers[3 * c + k] = area > 0.0f ? center[k] / area : 0.0f;
+        }
+        meshArea += area;
+
+        float len = sqrtf( normal[0] * normal[0] + normal[1] * normal[1] +
+            normal[2] * normal[2] );
+        for( int k = 0; k < 3; ++k ) {
+            facing[3 * c + k] = len > 0.0f ? normal[k] / len : 0.0f;
+        }
+    }
+    for( int k = 0; k < 3; ++k ) {
+        mesh[k] = meshArea > 0.0f ? mesh[k] / meshArea : 0.0f;
+    }
+
+    // clusters further out along their own facing are more likely to
+    // be in front of the rest, whatever the direction of view
+    vector<float> key( nclusters );
+    vector<size_t> order( nclusters );
+    for( size_t c = 0; c < nclusters; ++c ) {
+        key[c] = 0.0f;
+        for( int k = 0; k < 3; ++k ) {
+            key[c] += (centers[3 * c + k] - mesh[k]) * facing[3 * c + k];
+        }
+        order[c] = c;
+    }
+    stable_sort( order.begin(), order.end(),
+        [&key]( size_t a, size_t b ) { return key[a] > key[b]; } );
+
+    size_t out = 0;
+    for( size_t i = 0; i < nclusters; ++i ) {
+        size_t c = order[i];
+        for( size_t f = clusters[c]; f < clusters[c + 1]; ++f ) {
+            dst[out++] = indices[3 * f];
+            dst[out++] = indices[3 * f + 1];
+            dst[out++] = indices[3 * f + 2];
+        }
+    }
+}
+
+///
+// optimizeVertexFetch() - number the vertices in order of first use
+//
+// @param remap    - receives the new number of each old vertex
+// @param indices  - the triangles, renumbered in place
+// @param count    - the number of indices
+// @param vertices - the number of vertices (unused ones go last)
+///
+void optimizeVertexFetch( GLuint *remap, GLuint *indices, size_t count,
+    size_t vertices )
+{
+    GLuint next = 0;
+
+    for( size_t v = 0; v < vertices; ++v ) {
+        remap[v] = ~0u;
+    }
+    for( size_t i = 0; i < count; ++i ) {
+        GLuint &r = remap[indices[i]];
+        if( r == ~0u ) {
+            r = next++;
+        }
+        indices[i] = r;
+    }
+    for( size_t v = 0; v < vertices; ++v ) {
+        if( remap[v] == ~0u ) {
+            remap[v] = next++;
+        }
+    }
+}
@@ -0,0 +1,121 @@
+///
+//  MeshOptimizer.h
+//
+//  Load-time reordering of indexed triangle meshes, in three passes:
+//
+//    optimizeVertexCache() - reorder the triangles so that each one
+//        reuses vertices the GPU has just transformed (Tom Forsyth's
+//        "Linear-Speed Vertex Cache Optimisation")
+//
+//    optimizeOverdraw() - cut that order into clusters which keep most
+//        of the reuse, and put the clusters facing outwards from the
+//        middle of the mesh first, so that more of what is hidden
+//        fails the depth test before it is shaded
+//
+//    optimizeVertexFetch() - renumber the vertices in the order they
+//        are first used, so that vertex data is read in sequence
+//
+//  measureCache() reports how well an order uses the cache:  the
+//  average cache miss ratio (ACMR, vertices transformed per triangle;
+//  0.5 is the best a large mesh can do, 3 the worst) and the average
+//  transform to vertex ratio (ATVR, vertices transformed per distinct
+//  vertex; 1 is perfect).  Canvas::optimize() runs all three passes on
+//  whatever mesh a Canvas holds.
+///
+
+#ifndef _MESHOPTIMIZER_H_
+#define _MESHOPTIMIZER_H_
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
+#ifndef __APPLE__
+#include <GL/glew.h>
+#endif
+
+#include <GLFW/glfw3.h>
+#endif
+
+#include <cstddef>
+
+///
+// Size of the least-recently-used cache optimizeVertexCache() plans
+// for (larger than any real one, as Forsyth suggests, so that the
+// order suits whatever the hardware has)
+///
+#define VCACHE_SIZE         32
+
+///
+// Size of the first-in, first-out cache measureCache() and
+// optimizeOverdraw() simulate, like that of most GPUs
+///
+#define VCACHE_FIFO         16
+
+///
+// How much worse than the vertex cache order a cluster's ACMR may be
+// made by optimizeOverdraw()
+///
+#define OVERDRAW_THRESHOLD  1.05f
+
+///
+// How well an order uses the vertex cache
+///
+typedef struct st_cachestats {
+    long transforms;            // vertices transformed
+    float acmr;                 // transforms per triangle
+    float atvr;                 // transforms per distinct vertex
+} CacheStats;
+
+///
+// measureCache() - simulate a FIFO vertex cache of VCACHE_FIFO entries
+//
+// @param indices  - the triangles, three indices each
+// @param count    - the number of indices
+// @param vertices - the number of vertices
+///
+CacheStats measureCache( const GLuint *indices, size_t count,
+    size_t vertices );
+
+///
+// optimizeVertexCache() - reorder triangles for the vertex cache
+//
+// @param dst      - receives the new order (not 'indices')
+// @param indices  - the triangles, three indices each
+// @param count    - the number of indices
+// @param vertices - the number of vertices
+///
+void optimizeVertexCache( GLuint *dst, const GLuint *indices, size_t count,
+    size_t vertices );
+
+///
+// optimizeOverdraw() - reorder clusters of triangles, front-most first
+//
+// @param dst       - receives the new order (not 'indices')
+// @param indices   - the triangles, in vertex cache order
+// @param count     - the number of indices
+// @param positions - the vertex locations
+// @param stride    - floats from one location to the next
+// @param vertices  - the number of vertices
+// @param threshold - how much worse each cluster's ACMR may be made
+///
+void optimizeOverdraw( GLuint *dst, const GLuint *indices, size_t count,
+    const float *positions, size_t stride, size_t vertices,
+    float threshold );
+
+///
+// optimizeVertexFetch() - number the vertices in order of first use
+//
+// @param remap    - receives the new number of each old vertex
+// @param indices  - the triangles, renumbered in place
+// @param count    - the number of indices
+// @param vertices - the number of vertices (unused ones go last)
+///
+void optimizeVertexFetch( GLuint *remap, GLuint *indices, size_t count,
+    size_t vertices );
+
+#endif
@@ -0,0 +1,430 @@
+///
+//  RenderQueue.cpp
+//
+//  A queue of draw packets, sorted by state before drawing.
+///
+
+#include <algorithm>
+#include <cstring>
+
+#include "RenderQueue.h"
+#include "Shapes.h"
+#include "Viewing.h"
+#include "Lighting.h"
+#include "Textures.h"
+#include "GLState.h"
+
+// packets per range handed to a worker by prepare()
+#define PREPARE_GRAIN   256
+
+///
+// packetKey() - the sort key for a packet:  by program, then mesh,
+//     then material
+//
+// GL names are small integers handed out in order, so 20 bits is
+// plenty for the program and for the mesh's element buffer (which
+// stands in for the mesh, or for all the meshes in an arena, which
+// can be drawn one after another without rebinding anything).
+// Records carry their own materials, so those don't need sorting on.
+///
+static unsigned long long packetKey( const DrawPacket &p )
+{
+    int material = p.record ? -1 : p.material;
+
+    return ((unsigned long long) (p.program & 0xfffff) << 44) |
+        ((unsigned long long) (p.mesh->elementBuffer() & 0xfffff) << 24) |
+        (unsigned long long) ((material + 1) & 0xffffff);
+}
+
+///
+// Packet ordering:  by key, and in order of submission for equal keys
+///
+struct PacketLess {
+    const vector<DrawPacket> &packets;
+
+    PacketLess( const vector<DrawPacket> &p ) : packets(p) { }
+
+    bool operator()( size_t a, size_t b ) const {
+        if( packets[a].key != packets[b].key ) {
+            return packets[a].key < packets[b].key;
+        }
+        return a < b;
+    }
+};
+
+///
+// Constructor
+///
+RenderQueue::RenderQueue( void ) :
+    culling(true), pool(NULL), ring(NULL), commands(NULL),
+    recordSource(0), recordOffset(0), recordBuffer(0) {
+    stats.draws = stats.commands = stats.programSwitches = 0;
+    stats.bufferBinds = stats.materialChanges = 0;
+    stats.culled = 0;
+}
+
+///
+// submit() - queue a draw of one object
+//
+// @param program  - shader program to draw it with
+// @param mesh     - the object's BufferSet
+// @param material - material id (OBJ_QUAD for the texture mapped table)
+// @param scale, rotate, xlate - the object's transformations
+///
+void RenderQueue::submit( GLuint program, BufferSet *mesh, int material,
+    Tuple scale, Tuple rotate, Tuple xlate ) {
+
+    DrawPacket p;
+
+    p.program = program;
+    p.mesh = mesh;
+    p.material = material;
+    p.instances = NULL;
+    p.record = false;
+    p.scale = scale;
+    p.rotate = rotate;
+    p.xlate = xlate;
+
+    packets.push_back( p );
+}
+
+///
+// submitInstances() - queue an instanced draw of all the instances
+//     of a mesh (nothing is queued if there are none)
+//
+// @param program - instanced shader program to draw them with
+// @param inst    - the mesh and its instances
+///
+void RenderQueue::submitInstances( GLuint program, InstanceSet *inst ) {
+
+    if( inst->instances.empty() ) {
+        return;
+    }
+
+    DrawPacket p;
+    Tuple zero = { 0.0f, 0.0f, 0.0f };
+
+    p.program = program;
+    p.mesh = inst->buffers;
+    p.material = -1;        // each instance has its own
+    p.instances = inst;
+    p.record = false;
+    p.scale = p.rotate = p.xlate = zero;
+
+    packets.push_back( p );
+}
+
+///
+// submitRecord() - queue a draw of one object, with a shader which
+//     reads its transformations and material from a record
+//
+// @param program  - shader program to draw it with (one which takes
+//                   iModel, iNormal and iMaterial per instance)
+// @param mesh     - the object's BufferSet
+// @param material - material id
+// @param scale, rotate, xlate - the object's transformations
+///
+void RenderQueue::submitRecord( GLuint program, BufferSet *mesh,
+    int material, Tuple scale, Tuple rotate, Tuple xlate ) {
+
+    submit( program, mesh, material, scale, rotate, xlate );
+    packets.back().record = true;
+}
+
+///
+// prepareRange() - prepare packets begin..end-1
+///
+void RenderQueue::prepareRange( size_t begin, size_t end ) {
+
+    for( size_t i = begin; i < end; ++i ) {
+        DrawPacket &p = packets[i];
+
+        p.key = packetKey( p );
+        p.culled = 0;
+
+        // instanced packets cull their own instances
+        if( p.instances != NULL ) {
+            if( culling ) {
+                p.culled = p.instances->cull( frustum );
+            }
+            continue;
+        }
+
+        if( p.record ) {
+            modelMatrix( p.scale, p.rotate, p.xlate, p.model );
+            normalMatrix( p.model, p.normal );
+        } else {
+            modelViewMatrices( view, p.scale, p.rotate, p.xlate,
+                p.model, p.modelView, p.normal );
+            p.mesh->positionTransform( p.modelView );
+        }
+        p.mesh->positionTransform( p.model );
+        spheres.set( i, p.mesh, p.model );
+    }
+
+    if( culling ) {
+        spheres.cull( frustum, begin, end, visible.data() );
+    } else {
+        for( size_t i = begin; i < end; ++i ) {
+            visible[i] = 1;
+        }
+    }
+
+    for( size_t i = begin; i < end; ++i ) {
+        if( packets[i].instances != NULL ) {
+            visible[i] = !packets[i].instances->instances.empty();
+        }
+    }
+}
+
+///
+// prepare() - compute the matrices, sort keys and visibility of all
+//     the queued packets, and cull the instances of instanced ones
+//
+// @param eye, lookat, up - the camera for this frame
+///
+void RenderQueue::prepare( Tuple eye, Tuple lookat, Tuple up ) {
+
+    GLfloat vp[16];
+
+    viewMatrix( eye, lookat, up, view );
+    viewProjMatrix( eye, lookat, up, vp );
+    frustumFromMatrix( vp, frustum );
+
+    spheres.resize( packets.size() );
+    visible.resize( packets.size() );
+
+    if( pool != NULL ) {
+        pool->run( packets.size(), PREPARE_GRAIN,
+            [this]( size_t begin, size_t end ) {
+                prepareRange( begin, end );
+            } );
+    } else {
+        prepareRange( 0, packets.size() );
+    }
+}
+
+///
+// writeRecords() - write the records and instances of the packets
+//     about to be drawn
+///
+void RenderQueue::writeRecords( void ) {
+
+    size_t records = 0;
+    GLsizeiptr size = 0;
+
+    if( commands != NULL ) {
+        commands->clear();
+    }
+
+    for( size_t k = 0; k < order.size(); ++k ) {
+        DrawPacket &p = packets[order[k]];
+
+        // these go into the command list, with their data
+        p.command = -1;
+        if( commands != NULL && p.mesh->handle >= 0 ) {
+            if( p.record ) {
+                InstanceData rec;
+                memcpy( rec.model, p.model, sizeof(rec.model) );
+                memcpy( rec.normal, p.normal, sizeof(rec.normal) );
+                rec.material = p.material;
+                p.command = commands->add( p.mesh, &rec, 1 );
+                continue;
+            }
+            if( p.instances != NULL ) {
+                vector<InstanceData> &inst = p.instances->instances;
+                p.command = commands->add( p.mesh, inst.data(),
+                    (GLuint) inst.size() );
+                continue;
+            }
+        }
+
+        if( p.record ) {
+            p.baseInstance = (GLuint) records++;
+        } else if( p.instances != NULL ) {
+            size += RingBuffer::space(
+                p.instances->instances.size() * sizeof(InstanceData) );
+        }
+    }
+    GLsizeiptr recordSize = records * sizeof(InstanceData);
+
+    InstanceData *dst = NULL;
+    vector<InstanceData> staging;
+
+    // a ring which couldn't be regrown is no use any more:  upload as
+    // if there had never been one, from this frame on
+    if( ring != NULL && !ring->begin(size + RingBuffer::space(recordSize)) ) {
+        ring = NULL;
+    }
+
+    if( ring != NULL ) {
+        if( records > 0 ) {
+            dst = (InstanceData *) ring->alloc( recordSize, &recordOffset );
+            recordSource = ring->buffer;
+        }
+    } else if( records > 0 ) {
+        staging.resize( records );
+        dst = staging.data();
+    }
+
+    for( size_t k = 0; k < order.size(); ++k ) {
+        DrawPacket &p = packets[order[k]];
+        if( p.command >= 0 ) {
+            continue;
+        }
+        if( p.record ) {
+            InstanceData &rec = dst[p.baseInstance];
+            memcpy( rec.model, p.model, sizeof(rec.model) );
+            memcpy( rec.normal, p.normal, sizeof(rec.normal) );
+            rec.material = p.material;
+        } else if( p.instances != NULL && ring != NULL ) {
+            p.instances->upload( ring );
+        }
+    }
+
+    // without a ring buffer, the records go up all at once
+    if( !staging.empty() ) {
+        if( recordBuffer == 0 ) {
+            glGenBuffers( 1, &recordBuffer );
+        }
+        stBindBuffer( GL_ARRAY_BUFFER, recordBuffer );
+        glBufferData( GL_ARRAY_BUFFER, recordSize, staging.data(),
+            GL_STREAM_DRAW );
+        recordSource = recordBuffer;
+        recordOffset = 0;
+    }
+
+    if( commands != NULL ) {
+        commands->upload();
+    }
+}
+
+///
+// flush() - prepare, sort and draw all the queued packets, then
+//     empty the queue
+//
+// @param eye, lookat, up - the camera for this frame
+///
+void RenderQueue::flush( Tuple eye, Tuple lookat, Tuple up ) {
+
+    stats.draws = stats.commands = stats.programSwitches = 0;
+    stats.bufferBinds = stats.materialChanges = 0;
+    stats.culled = 0;
+
+    prepare( eye, lookat, up );
+
+    order.clear();
+    for( size_t i = 0; i < packets.size(); ++i ) {
+        if( visible[i] ) {
+            order.push_back( i );
+        } else if( packets[i].instances == NULL ) {
+            ++stats.culled;
+        }
+        stats.culled += packets[i].culled;
+    }
+
+    sort( order.begin(), order.end(), PacketLess(packets) );
+
+    writeRecords();
+
+    GLuint program = 0;
+    BufferSet *mesh = NULL;
+    int material = -1;
+    bool recordsSelected = false;
+
+    for( size_t k = 0; k < order.size(); ++k ) {
+        DrawPacket &p = packets[order[k]];
+
+        // uniforms and vertex arrays both belong to the program, so a
+        // new program means everything must be set up again
+        if( p.program != program ) {
+            program = p.program;
+            mesh = NULL;
+            material = -1;
+            recordsSelected = false;
+            stUseProgram( program );
+            setUpProjection( program );
+            setUpCamera( program, eye, lookat, up );
+            ++stats.programSwitches;
+        }
+
+        // meshes in the same arena share their vertex arrays, so
+        // moving between them needs no binding
+        if( p.mesh != mesh ) {
+            bool shared = mesh != NULL && mesh->handle >= 0 &&
+                p.mesh->handle >= 0 && p.mesh->arena == mesh->arena;
+            mesh = p.mesh;
+            if( !shared ) {
+                mesh->selectBuffers( program, "vPosition", NULL, "vNormal",
+                    p.material == OBJ_QUAD ? "vTexCoord" : NULL );
+                recordsSelected = false;
+                ++stats.bufferBinds;
+            }
+        }
+
+        if( p.command >= 0 ) {
+            // the run of commands which follow on from this one (same
+            // program and arena, so nothing needs changing between them)
+            size_t last = k;
+            while( last + 1 < order.size() ) {
+                const DrawPacket &q = packets[order[last + 1]];
+                if( q.command != p.command + (int) (last + 1 - k) ||
+                    q.program != program ||
+                    q.mesh->elementBuffer() != mesh->elementBuffer() ) {
+                    break;
+                }
+                ++last;
+            }
+            setUpLight();
+            selectRecords( program, commands->recordBuffer, 0,
+                "iModel", "iNormal", "iMaterial" );
+            recordsSelected = false;
+            commands->draw( p.command, (int) (last - k + 1) );
+            stats.commands += (int) (last - k + 1);
+            mesh = packets[order[last]].mesh;
+            k = last;
+        } else if( p.instances != NULL ) {
+            setUpLight();
+            if( ring == NULL ) {
+                p.instances->upload();
+            }
+            p.instances->select( program, "iModel", "iNormal", "iMaterial" );
+            glDrawElementsInstancedBaseVertex( GL_TRIANGLES,
+                mesh->numElements, GL_UNSIGNED_INT, mesh->indexOffset(),
+                p.instances->uploaded, mesh->baseVertex() );
+            // that moved the per-instance attributes
+            recordsSelected = false;
+        } else if( p.record ) {
+            if( !recordsSelected ) {
+                setUpLight();
+                selectRecords( program, recordSource, recordOffset,
+                    "iModel", "iNormal", "iMaterial" );
+                recordsSelected = true;
+            }
+            glDrawElementsInstancedBaseVertexBaseInstance( GL_TRIANGLES,
+                mesh->numElements, GL_UNSIGNED_INT, mesh->indexOffset(), 1,
+                mesh->baseVertex(), p.baseInstance );
+        } else {
+            if( p.material != material ) {
+                material = p.material;
+                if( material == OBJ_QUAD ) {
+                    setUpTextures( program, material );
+                } else {
+                    setUpPhong( program, material );
+                }
+                ++stats.materialChanges;
+            }
+            setUpModelView( program, p.scale, p.rotate, p.xlate,
+                p.modelView, p.normal );
+            glDrawElementsBaseVertex( GL_TRIANGLES, mesh->numElements,
+                GL_UNSIGNED_INT, mesh->indexOffset(), mesh->baseVertex() );
+        }
+        ++stats.draws;
+    }
+
+    if( ring != NULL ) {
+        ring->end();
+    }
+
+    packets.clear();
+}
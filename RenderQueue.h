@@ -0,0 +1,216 @@
+///
+//  RenderQueue.h
+//
+//  A queue of draw packets, sorted by state before drawing.
+//
+//  Instead of drawing objects immediately, display() submits a packet
+//  for each one.  flush() sorts the packets by (program, mesh,
+//  material) and then draws them in order, making each state change
+//  only when it differs from the previous packet's:  the program
+//  (along with the per-frame projection and camera setup), the vertex
+//  array, and the material.  Only the transformations are set up for
+//  every packet.
+//
+//  Before sorting, prepare() computes each packet's matrices, sort key
+//  and visibility, dropping the packets (and the instances) whose
+//  bounding spheres are outside the view frustum unless culling has
+//  been turned off.  None of this needs GL, so if the queue is given
+//  a WorkerPool the packets are split among its threads; the GL
+//  thread only sorts and draws what they produce.
+//
+//  Packets submitted with submitRecord() are drawn with a shader which
+//  reads the transformations and material from a per-draw record
+//  (an InstanceData, as for instanced drawing) instead of uniforms.
+//  All of a frame's records are written into the ring buffer, if the
+//  queue has one, before anything is drawn; each draw then finds its
+//  record through its base instance, so no uniforms are set per object.
+//
+//  Given a CommandBuffer, the queue goes one step further for records
+//  and instanced packets whose meshes are in a GeometryArena:  their
+//  draws are written as indirect commands (with the records and
+//  instances alongside), and each run of them sharing a program and an
+//  arena is drawn with one glMultiDrawElementsIndirect() call.
+///
+
+#ifndef _RENDERQUEUE_H_
+#define _RENDERQUEUE_H_
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
+#ifndef __APPLE__
+#include <GL/glew.h>
+#endif
+
+#include <GLFW/glfw3.h>
+#endif
+
+#include <vector>
+
+#include "Buffers.h"
+#include "CommandBuffer.h"
+#include "Culling.h"
+#include "Instances.h"
+#include "RingBuffer.h"
+#include "Tuple.h"
+#include "WorkerPool.h"
+
+using namespace std;
+
+///
+// One queued draw
+///
+typedef struct st_packet {
+    GLuint program;             // shader program
+    BufferSet *mesh;            // what to draw
+    int material;               // material id (OBJ_QUAD is texture mapped)
+    InstanceSet *instances;     // instances to draw, or NULL
+    bool record;                // take transformations from a record?
+    Tuple scale;                // transformations (if not instanced)
+    Tuple rotate;
+    Tuple xlate;
+
+    // filled in by prepare()
+    GLfloat model[16];          // model matrix (if not instanced)
+    GLfloat modelView[16];      // model-view matrix (if not a record);
+                                // both include the mesh's
+                                // positionTransform()
+    GLfloat normal[9];          // normal matrix, for the model-view
+                                // matrix or (for a record) the model
+    GLuint baseInstance;        // which record (set by flush())
+    int command;                // which indirect command draws it, or
+                                // -1 (set by flush())
+    unsigned long long key;     // sort key
+    int culled;                 // number of instances culled
+} DrawPacket;
+
+///
+// What one flush() did
+///
+typedef struct st_qstats {
+    int draws;                  // draw calls
+    int commands;               // draws made by indirect commands
+    int programSwitches;
+    int bufferBinds;
+    int materialChanges;
+    int culled;                 // objects (packets or instances) culled
+} QueueStats;
+
+///
+// The queue itself
+///
+class RenderQueue {
+
+public:
+
+    // packets submitted since the last flush()
+    vector<DrawPacket> packets;
+
+    // counts for the most recent flush()
+    QueueStats stats;
+
+    // should flush() cull against the view frustum?
+    bool culling;
+
+    // threads to prepare the packets with (NULL to use this one)
+    WorkerPool *pool;
+
+    // where to put each frame's records and instances (NULL to upload
+    // them with glBufferData() instead)
+    RingBuffer *ring;
+
+    // where to write the draws of records and instances of arena meshes
+    // as indirect commands (NULL to draw them one call at a time)
+    CommandBuffer *commands;
+
+    ///
+    // Constructor
+    ///
+    RenderQueue( void );
+
+    ///
+    // submit() - queue a draw of one object
+    //
+    // @param program  - shader program to draw it with
+    // @param mesh     - the object's BufferSet
+    // @param material - material id (OBJ_QUAD for the texture mapped table)
+    // @param scale, rotate, xlate - the object's transformations
+    ///
+    void submit( GLuint program, BufferSet *mesh, int material,
+        Tuple scale, Tuple rotate, Tuple xlate );
+
+    ///
+    // submitInstances() - queue an instanced draw of all the instances
+    //     of a mesh (nothing is queued if there are none)
+    //
+    // @param program - instanced shader program to draw them with
+    // @param inst    - the mesh and its instances
+    ///
+    void submitInstances( GLuint program, InstanceSet *inst );
+
+    ///
+    // submitRecord() - queue a draw of one object, with a shader which
+    //     reads its transformations and material from a record
+    //
+    // @param program  - shader program to draw it with (one which takes
+    //                   iModel, iNormal and iMaterial per instance)
+    // @param mesh     - the object's BufferSet
+    // @param material - material id
+    // @param scale, rotate, xlate - the object's transformations
+    ///
+    void submitRecord( GLuint program, BufferSet *mesh, int material,
+        Tuple scale, Tuple rotate, Tuple xlate );
+
+    ///
+    // prepare() - compute the matrices, sort keys and visibility of all
+    //     the queued packets, and cull the instances of instanced ones
+    //     (flush() does this itself; it makes no GL calls)
+    //
+    // @param eye, lookat, up - the camera for this frame
+    ///
+    void prepare( Tuple eye, Tuple lookat, Tuple up );
+
+    ///
+    // flush() - prepare, sort and draw all the queued packets, then
+    //     empty the queue
+    //
+    // @param eye, lookat, up - the camera for this frame
+    ///
+    void flush( Tuple eye, Tuple lookat, Tuple up );
+
+private:
+
+    // results of prepare():  each packet's bounding sphere and whether
+    // it is to be drawn, and the order in which to draw them
+    SphereSet spheres;
+    vector<unsigned char> visible;
+    vector<size_t> order;
+
+    // the frustum and view matrix prepare() is working with
+    Frustum frustum;
+    GLfloat view[16];
+
+    // where flush() put this frame's records, and the buffer it uses
+    // for them when there's no ring buffer
+    GLuint recordSource;
+    GLintptr recordOffset;
+    GLuint recordBuffer;
+
+    ///
+    // prepareRange() - prepare packets begin..end-1
+    ///
+    void prepareRange( size_t begin, size_t end );
+
+    ///
+    // writeRecords() - write the records and instances of the packets
+    //     about to be drawn
+    ///
+    void writeRecords( void );
+};
+
+#endif
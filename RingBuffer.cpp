@@ -0,0 +1,221 @@
+///
+//  RingBuffer.cpp
+//
+//  A persistently mapped buffer for data which is written fresh every
+//  frame.
+///
+
+#include <cstdio>
+#include <cstring>
+
+#include "RingBuffer.h"
+#include "GLState.h"
+
+// the storage and the mapping are both persistent and coherent, so
+// writes need no explicit flush
+#define RING_FLAGS      (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | \
+                         GL_MAP_COHERENT_BIT)
+
+// how long to wait for a fence each time round (nanoseconds)
+#define RING_TIMEOUT    1000000000
+
+///
+// Constructor
+///
+RingBuffer::RingBuffer( void ) :
+    buffer(0), mapped(NULL), sectionSize(0), section(0), used(0),
+    waits(0) {
+    for( int i = 0; i < RING_SECTIONS; ++i ) {
+        fences[i] = 0;
+    }
+}
+
+///
+// supported() - can the current GL context do persistent mapping,
+//     and draw with a base instance (to find records in the ring)?
+///
+bool RingBuffer::supported( void ) {
+
+    const char *version = (const char *) glGetString( GL_VERSION );
+    int major = 0, minor = 0;
+
+    if( version != NULL &&
+        sscanf(version, "%d.%d", &major, &minor) == 2 &&
+        (major > 4 || (major == 4 && minor >= 4)) ) {
+        return true;
+    }
+
+    bool storage = false, baseInstance = false;
+    GLint n = 0;
+    glGetIntegerv( GL_NUM_EXTENSIONS, &n );
+    for( GLint i = 0; i < n; ++i ) {
+        const char *ext = (const char *) glGetStringi( GL_EXTENSIONS, i );
+        if( ext == NULL ) {
+            continue;
+        }
+        if( !strcmp(ext, "GL_ARB_buffer_storage") ) {
+            storage = true;
+        } else if( !strcmp(ext, "GL_ARB_base_instance") ) {
+            baseInstance = true;
+        }
+    }
+
+    return storage && (baseInstance || major > 4 ||
+        (major == 4 && minor >= 2));
+}
+
+///
+// space() - how much of a section an allocation of 'size' bytes uses
+///
+GLsizeiptr RingBuffer::space( GLsizeiptr size ) {
+    return (size + RING_ALIGN - 1) / RING_ALIGN * RING_ALIGN;
+}
+
+///
+// init() - create and map the buffer
+//
+// @param size - bytes per section
+//
+// @return false if the GL context can't do this
+///
+bool RingBuffer::init( GLsizeiptr size ) {
+
+    if( !supported() ) {
+        return false;
+    }
+
+    create( size );
+    return mapped != NULL;
+}
+
+///
+// create() - make a new buffer with sections of the given size
+///
+void RingBuffer::create( GLsizeiptr size ) {
+
+    // round up, so that every section starts on a boundary
+    sectionSize = space( size );
+
+    glGenBuffers( 1, &buffer );
+    stBindBuffer( GL_ARRAY_BUFFER, buffer );
+    glBufferStorage( GL_ARRAY_BUFFER, sectionSize * RING_SECTIONS, NULL,
+        RING_FLAGS );
+    mapped = (unsigned char *) glMapBufferRange( GL_ARRAY_BUFFER, 0,
+        sectionSize * RING_SECTIONS, RING_FLAGS );
+
+    // out of memory, probably; there's nothing to keep
+    if( mapped == NULL ) {
+        stDeleteBuffers( 1, &buffer );
+        buffer = 0;
+        sectionSize = 0;
+    }
+
+    section = 0;
+    used = 0;
+}
+
+///
+// release() - wait for the GPU to finish with the whole buffer, then
+//     delete it
+///
+void RingBuffer::release( void ) {
+
+    for( int i = 0; i < RING_SECTIONS; ++i ) {
+        if( fences[i] != 0 ) {
+            wait( fences[i] );
+            glDeleteSync( fences[i] );
+            fences[i] = 0;
+        }
+    }
+
+    stBindBuffer( GL_ARRAY_BUFFER, buffer );
+    glUnmapBuffer( GL_ARRAY_BUFFER );
+    stDeleteBuffers( 1, &buffer );
+    buffer = 0;
+    mapped = NULL;
+}
+
+///
+// wait() - wait for a fence to be signaled
+///
+void RingBuffer::wait( GLsync fence ) {
+
+    GLenum status = glClientWaitSync( fence, 0, 0 );
+    if( status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED ) {
+        return;
+    }
+
+    ++waits;
+    do {
+        status = glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+            RING_TIMEOUT );
+    } while( status == GL_TIMEOUT_EXPIRED );
+}
+
+///
+// begin() - start writing a frame's data into the next section,
+//     waiting for the GPU to finish with it if need be
+//
+// @param size - how many bytes the frame will need, as the sum of
+//               space() for each allocation (if more than a
+//               section, the buffer is made larger)
+//
+// @return false if making it larger failed
+///
+bool RingBuffer::begin( GLsizeiptr size ) {
+
+    if( mapped == NULL ) {
+        return false;
+    }
+
+    if( size > sectionSize ) {
+        GLsizeiptr bigger = sectionSize * 2;
+        if( bigger < size ) {
+            bigger = size;
+        }
+        release();
+        create( bigger );
+        return mapped != NULL;
+    }
+
+    if( fences[section] != 0 ) {
+        wait( fences[section] );
+        glDeleteSync( fences[section] );
+        fences[section] = 0;
+    }
+    used = 0;
+
+    return true;
+}
+
+///
+// alloc() - take space for some data from the current section
+//
+// @param size   - bytes needed
+// @param offset - set to the data's offset within the buffer
+//
+// @return where to write the data, or NULL if the section is full
+///
+void *RingBuffer::alloc( GLsizeiptr size, GLintptr *offset ) {
+
+    if( mapped == NULL || used + size > sectionSize ) {
+        return NULL;
+    }
+
+    *offset = section * sectionSize + used;
+    used += space( size );
+
+    return mapped + *offset;
+}
+
+///
+// end() - finish the frame:  fence the commands which use this
+//     section, and move on to the next one
+///
+void RingBuffer::end( void ) {
+    if( mapped == NULL ) {
+        return;
+    }
+    fences[section] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+    section = (section + 1) % RING_SECTIONS;
+}
@@ -0,0 +1,137 @@
+///
+//  RingBuffer.h
+//
+//  A persistently mapped buffer for data which is written fresh every
+//  frame (transforms, materials, instance records).
+//
+//  The buffer is created once with glBufferStorage() and stays mapped,
+//  so writing per-frame data is just a memory write; there is no
+//  glBufferData() or glBufferSubData() call per object, or even per
+//  frame.  It is split into RING_SECTIONS sections, used in turn:  the
+//  CPU fills one while the GPU may still be reading the previous ones,
+//  and a fence at the end of each frame says when its section may be
+//  written again.
+//
+//  This needs GL 4.4 (or ARB_buffer_storage, plus base instances for
+//  finding records in the ring); init() says whether the context has
+//  them.  Nothing is released at exit; the buffer goes away with the
+//  context.
+///
+
+#ifndef _RINGBUFFER_H_
+#define _RINGBUFFER_H_
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
+#ifndef __APPLE__
+#include <GL/glew.h>
+#endif
+
+#include <GLFW/glfw3.h>
+#endif
+
+///
+// Sections in the ring (one being written, the others possibly still
+// being read by the GPU)
+///
+#define RING_SECTIONS   3
+
+///
+// Allocations within a section are aligned to this many bytes
+///
+#define RING_ALIGN      256
+
+///
+// The ring buffer
+///
+class RingBuffer {
+
+public:
+
+    // the buffer, and where it is mapped
+    GLuint buffer;
+    unsigned char *mapped;
+
+    // size of each section, in bytes
+    GLsizeiptr sectionSize;
+
+    // the section being written, and how much of it has been used
+    int section;
+    GLsizeiptr used;
+
+    // fences for the sections' most recent frames (0 if none)
+    GLsync fences[RING_SECTIONS];
+
+    // number of times begin() had to wait for the GPU
+    long waits;
+
+    ///
+    // Constructor
+    ///
+    RingBuffer( void );
+
+    ///
+    // supported() - can the current GL context do persistent mapping,
+    //     and draw with a base instance (to find records in the ring)?
+    ///
+    static bool supported( void );
+
+    ///
+    // space() - how much of a section an allocation of 'size' bytes
+    //     uses (for working out what to pass to begin())
+    ///
+    static GLsizeiptr space( GLsizeiptr size );
+
+    ///
+    // init() - create and map the buffer
+    //
+    // @param size - bytes per section
+    //
+    // @return false if the GL context can't do this
+    ///
+    bool init( GLsizeiptr size );
+
+    ///
+    // begin() - start writing a frame's data into the next section,
+    //     waiting for the GPU to finish with it if need be
+    //
+    // @param size - how many bytes the frame will need, as the sum of
+    //               space() for each allocation (if more than a
+    //               section, the buffer is made larger)
+    //
+    // @return false if making it larger failed; the ring is then
+    //         unusable, and the data must be uploaded some other way
+    ///
+    bool begin( GLsizeiptr size );
+
+    ///
+    // alloc() - take space for some data from the current section
+    //
+    // @param size   - bytes needed
+    // @param offset - set to the data's offset within the buffer
+    //
+    // @return where to write the data, or NULL if the section is full
+    //         (or the buffer isn't mapped)
+    ///
+    void *alloc( GLsizeiptr size, GLintptr *offset );
+
+    ///
+    // end() - finish the frame:  fence the commands which use this
+    //     section, and move on to the next one
+    ///
+    void end( void );
+
+private:
+
+    void release( void );
+    void create( GLsizeiptr size );
+    void wait( GLsync fence );
+};
+
+#endif
@@ -15,11 +15,16 @@
 // GLEW and GLFW header files also pull in the OpenGL definitions
 ///
 
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
 #ifndef __APPLE__
 #include <GL/glew.h>
 #endif
 
 #include <GLFW/glfw3.h>
+#endif
 
 ///
 // Error codes returned by ShaderSetup()
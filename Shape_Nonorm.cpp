@@ -16,6 +16,8 @@
 
 #include <iostream>
 #include <cmath>
+#include <algorithm>
+#include <vector>
 using namespace std;
 
 #include "Canvas.h"
@@ -23,2377 +25,221 @@ using namespace std;
 #include "Lighting.h"
 #include "Textures.h"
 #include "Viewing.h"
+#include "GLState.h"
+
 /*
-** The sphere
+** The sphere, cone and cylinder
+**
+** Each is generated at whatever tessellation is asked for, as an
+** indexed mesh with shared vertices and exact normals.  All three are
+** centered at the origin, one unit across and one unit high, with
+** their axes along Y; angles are measured around Y from +Z towards +X.
 */
 
+static const float TWO_PI = 6.28318530717958647692f;
+
 //
-// Each group of three values specifies a sphere vertex
-//
-// These values double as surface normals, because the sphere is
-// centered at (0,0,0).
+// angles() - the sine and cosine of each of 'slices' equally spaced
+// angles, starting at 0 (or half a step on, if 'half' is set)
 //
-float sphereVertices[] = {
-  0.000000f,  0.500000f,  0.000000f,  0.124968f,  0.475553f,  0.090733f,
-  0.154433f,  0.475553f,  0.000000f,  0.000000f,  0.500000f,  0.000000f,
-  0.047816f,  0.475553f,  0.146844f,  0.124968f,  0.475553f,  0.090733f,
-  0.000000f,  0.500000f,  0.000000f, -0.047582f,  0.475553f,  0.146920f,
-  0.047816f,  0.475553f,  0.146844f,  0.000000f,  0.500000f,  0.000000f,
- -0.124823f,  0.475553f,  0.090932f, -0.047582f,  0.475553f,  0.146920f,
-  0.000000f,  0.500000f,  0.000000f, -0.154433f,  0.475553f,  0.000246f,
- -0.124823f,  0.475553f,  0.090932f,  0.000000f,  0.500000f,  0.000000f,
- -0.125112f,  0.475553f, -0.090534f, -0.154433f,  0.475553f,  0.000246f,
-  0.000000f,  0.500000f,  0.000000f, -0.048050f,  0.475553f, -0.146768f,
- -0.125112f,  0.475553f, -0.090534f,  0.000000f,  0.500000f,  0.000000f,
-  0.047348f,  0.475553f, -0.146995f, -0.048050f,  0.475553f, -0.146768f,
-  0.000000f,  0.500000f,  0.000000f,  0.124678f,  0.475553f, -0.091131f,
-  0.047348f,  0.475553f, -0.146995f,  0.000000f,  0.500000f,  0.000000f,
-  0.154432f,  0.475553f, -0.000492f,  0.124678f,  0.475553f, -0.091131f,
-  0.154433f,  0.475553f,  0.000000f,  0.124968f,  0.475553f,  0.090733f,
-  0.293764f,  0.404602f,  0.000000f,  0.124968f,  0.475553f,  0.090733f,
-  0.237715f,  0.404602f,  0.172594f,  0.293764f,  0.404602f,  0.000000f,
-  0.124968f,  0.475553f,  0.090733f,  0.047816f,  0.475553f,  0.146844f,
-  0.237715f,  0.404602f,  0.172594f,  0.047816f,  0.475553f,  0.146844f,
-  0.090956f,  0.404602f,  0.279328f,  0.237715f,  0.404602f,  0.172594f,
-  0.047816f,  0.475553f,  0.146844f, -0.047582f,  0.475553f,  0.146920f,
-  0.090956f,  0.404602f,  0.279328f, -0.047582f,  0.475553f,  0.146920f,
- -0.090511f,  0.404602f,  0.279473f,  0.090956f,  0.404602f,  0.279328f,
- -0.047582f,  0.475553f,  0.146920f, -0.124823f,  0.475553f,  0.090932f,
- -0.090511f,  0.404602f,  0.279473f, -0.124823f,  0.475553f,  0.090932f,
- -0.237440f,  0.404602f,  0.172973f, -0.090511f,  0.404602f,  0.279473f,
- -0.124823f,  0.475553f,  0.090932f, -0.154433f,  0.475553f,  0.000246f,
- -0.237440f,  0.404602f,  0.172973f, -0.154433f,  0.475553f,  0.000246f,
- -0.293763f,  0.404602f,  0.000468f, -0.237440f,  0.404602f,  0.172973f,
- -0.154433f,  0.475553f,  0.000246f, -0.125112f,  0.475553f, -0.090534f,
- -0.293763f,  0.404602f,  0.000468f, -0.125112f,  0.475553f, -0.090534f,
- -0.237989f,  0.404602f, -0.172216f, -0.293763f,  0.404602f,  0.000468f,
- -0.125112f,  0.475553f, -0.090534f, -0.048050f,  0.475553f, -0.146768f,
- -0.237989f,  0.404602f, -0.172216f, -0.048050f,  0.475553f, -0.146768f,
- -0.091401f,  0.404602f, -0.279183f, -0.237989f,  0.404602f, -0.172216f,
- -0.048050f,  0.475553f, -0.146768f,  0.047348f,  0.475553f, -0.146995f,
- -0.091401f,  0.404602f, -0.279183f,  0.047348f,  0.475553f, -0.146995f,
-  0.090066f,  0.404602f, -0.279616f, -0.091401f,  0.404602f, -0.279183f,
-  0.047348f,  0.475553f, -0.146995f,  0.124678f,  0.475553f, -0.091131f,
-  0.090066f,  0.404602f, -0.279616f,  0.124678f,  0.475553f, -0.091131f,
-  0.237164f,  0.404602f, -0.173351f,  0.090066f,  0.404602f, -0.279616f,
-  0.124678f,  0.475553f, -0.091131f,  0.154432f,  0.475553f, -0.000492f,
-  0.237164f,  0.404602f, -0.173351f,  0.154432f,  0.475553f, -0.000492f,
-  0.293762f,  0.404602f, -0.000936f,  0.237164f,  0.404602f, -0.173351f,
-  0.293764f,  0.404602f,  0.000000f,  0.237715f,  0.404602f,  0.172594f,
-  0.404368f,  0.294086f,  0.000000f,  0.237715f,  0.404602f,  0.172594f,
-  0.327216f,  0.294086f,  0.237577f,  0.404368f,  0.294086f,  0.000000f,
-  0.237715f,  0.404602f,  0.172594f,  0.090956f,  0.404602f,  0.279328f,
-  0.327216f,  0.294086f,  0.237577f,  0.090956f,  0.404602f,  0.279328f,
-  0.125202f,  0.294086f,  0.384497f,  0.327216f,  0.294086f,  0.237577f,
-  0.090956f,  0.404602f,  0.279328f, -0.090511f,  0.404602f,  0.279473f,
-  0.125202f,  0.294086f,  0.384497f, -0.090511f,  0.404602f,  0.279473f,
- -0.124589f,  0.294086f,  0.384696f,  0.125202f,  0.294086f,  0.384497f,
- -0.090511f,  0.404602f,  0.279473f, -0.237440f,  0.404602f,  0.172973f,
- -0.124589f,  0.294086f,  0.384696f, -0.237440f,  0.404602f,  0.172973f,
- -0.326838f,  0.294086f,  0.238098f, -0.124589f,  0.294086f,  0.384696f,
- -0.237440f,  0.404602f,  0.172973f, -0.293763f,  0.404602f,  0.000468f,
- -0.326838f,  0.294086f,  0.238098f, -0.293763f,  0.404602f,  0.000468f,
- -0.404368f,  0.294086f,  0.000644f, -0.326838f,  0.294086f,  0.238098f,
- -0.293763f,  0.404602f,  0.000468f, -0.237989f,  0.404602f, -0.172216f,
- -0.404368f,  0.294086f,  0.000644f, -0.237989f,  0.404602f, -0.172216f,
- -0.327594f,  0.294086f, -0.237056f, -0.404368f,  0.294086f,  0.000644f,
- -0.237989f,  0.404602f, -0.172216f, -0.091401f,  0.404602f, -0.279183f,
- -0.327594f,  0.294086f, -0.237056f, -0.091401f,  0.404602f, -0.279183f,
- -0.125814f,  0.294086f, -0.384297f, -0.327594f,  0.294086f, -0.237056f,
- -0.091401f,  0.404602f, -0.279183f,  0.090066f,  0.404602f, -0.279616f,
- -0.125814f,  0.294086f, -0.384297f,  0.090066f,  0.404602f, -0.279616f,
-  0.123976f,  0.294086f, -0.384894f, -0.125814f,  0.294086f, -0.384297f,
-  0.090066f,  0.404602f, -0.279616f,  0.237164f,  0.404602f, -0.173351f,
-  0.123976f,  0.294086f, -0.384894f,  0.237164f,  0.404602f, -0.173351f,
-  0.326458f,  0.294086f, -0.238618f,  0.123976f,  0.294086f, -0.384894f,
-  0.237164f,  0.404602f, -0.173351f,  0.293762f,  0.404602f, -0.000936f,
-  0.326458f,  0.294086f, -0.238618f,  0.293762f,  0.404602f, -0.000936f,
-  0.404366f,  0.294086f, -0.001288f,  0.326458f,  0.294086f, -0.238618f,
-  0.404368f,  0.294086f,  0.000000f,  0.327216f,  0.294086f,  0.237577f,
-  0.475430f,  0.154811f,  0.000000f,  0.327216f,  0.294086f,  0.237577f,
-  0.384720f,  0.154811f,  0.279328f,  0.475430f,  0.154811f,  0.000000f,
-  0.327216f,  0.294086f,  0.237577f,  0.125202f,  0.294086f,  0.384497f,
-  0.384720f,  0.154811f,  0.279328f,  0.125202f,  0.294086f,  0.384497f,
-  0.147204f,  0.154811f,  0.452067f,  0.384720f,  0.154811f,  0.279328f,
-  0.125202f,  0.294086f,  0.384497f, -0.124589f,  0.294086f,  0.384696f,
-  0.147204f,  0.154811f,  0.452067f, -0.124589f,  0.294086f,  0.384696f,
- -0.146484f,  0.154811f,  0.452301f,  0.147204f,  0.154811f,  0.452067f,
- -0.124589f,  0.294086f,  0.384696f, -0.326838f,  0.294086f,  0.238098f,
- -0.146484f,  0.154811f,  0.452301f, -0.326838f,  0.294086f,  0.238098f,
- -0.384274f,  0.154811f,  0.279940f, -0.146484f,  0.154811f,  0.452301f,
- -0.326838f,  0.294086f,  0.238098f, -0.404368f,  0.294086f,  0.000644f,
- -0.384274f,  0.154811f,  0.279940f, -0.404368f,  0.294086f,  0.000644f,
- -0.475429f,  0.154811f,  0.000757f, -0.384274f,  0.154811f,  0.279940f,
- -0.404368f,  0.294086f,  0.000644f, -0.327594f,  0.294086f, -0.237056f,
- -0.475429f,  0.154811f,  0.000757f, -0.327594f,  0.294086f, -0.237056f,
- -0.385164f,  0.154811f, -0.278715f, -0.475429f,  0.154811f,  0.000757f,
- -0.327594f,  0.294086f, -0.237056f, -0.125814f,  0.294086f, -0.384297f,
- -0.385164f,  0.154811f, -0.278715f, -0.125814f,  0.294086f, -0.384297f,
- -0.147924f,  0.154811f, -0.451832f, -0.385164f,  0.154811f, -0.278715f,
- -0.125814f,  0.294086f, -0.384297f,  0.123976f,  0.294086f, -0.384894f,
- -0.147924f,  0.154811f, -0.451832f,  0.123976f,  0.294086f, -0.384894f,
-  0.145763f,  0.154811f, -0.452533f, -0.147924f,  0.154811f, -0.451832f,
-  0.123976f,  0.294086f, -0.384894f,  0.326458f,  0.294086f, -0.238618f,
-  0.145763f,  0.154811f, -0.452533f,  0.326458f,  0.294086f, -0.238618f,
-  0.383828f,  0.154811f, -0.280552f,  0.145763f,  0.154811f, -0.452533f,
-  0.326458f,  0.294086f, -0.238618f,  0.404366f,  0.294086f, -0.001288f,
-  0.383828f,  0.154811f, -0.280552f,  0.404366f,  0.294086f, -0.001288f,
-  0.475427f,  0.154811f, -0.001514f,  0.383828f,  0.154811f, -0.280552f,
-  0.475430f,  0.154811f,  0.000000f,  0.384720f,  0.154811f,  0.279328f,
-  0.500000f,  0.000398f,  0.000000f,  0.384720f,  0.154811f,  0.279328f,
-  0.404602f,  0.000398f,  0.293764f,  0.500000f,  0.000398f,  0.000000f,
-  0.384720f,  0.154811f,  0.279328f,  0.147204f,  0.154811f,  0.452067f,
-  0.404602f,  0.000398f,  0.293764f,  0.147204f,  0.154811f,  0.452067f,
-  0.154811f,  0.000398f,  0.475430f,  0.404602f,  0.000398f,  0.293764f,
-  0.147204f,  0.154811f,  0.452067f, -0.146484f,  0.154811f,  0.452301f,
-  0.154811f,  0.000398f,  0.475430f, -0.146484f,  0.154811f,  0.452301f,
- -0.154054f,  0.000398f,  0.475676f,  0.154811f,  0.000398f,  0.475430f,
- -0.146484f,  0.154811f,  0.452301f, -0.384274f,  0.154811f,  0.279940f,
- -0.154054f,  0.000398f,  0.475676f, -0.384274f,  0.154811f,  0.279940f,
- -0.404134f,  0.000398f,  0.294408f, -0.154054f,  0.000398f,  0.475676f,
- -0.384274f,  0.154811f,  0.279940f, -0.475429f,  0.154811f,  0.000757f,
- -0.404134f,  0.000398f,  0.294408f, -0.475429f,  0.154811f,  0.000757f,
- -0.499999f,  0.000398f,  0.000796f, -0.404134f,  0.000398f,  0.294408f,
- -0.475429f,  0.154811f,  0.000757f, -0.385164f,  0.154811f, -0.278715f,
- -0.499999f,  0.000398f,  0.000796f, -0.385164f,  0.154811f, -0.278715f,
- -0.405069f,  0.000398f, -0.293119f, -0.499999f,  0.000398f,  0.000796f,
- -0.385164f,  0.154811f, -0.278715f, -0.147924f,  0.154811f, -0.451832f,
- -0.405069f,  0.000398f, -0.293119f, -0.147924f,  0.154811f, -0.451832f,
- -0.155568f,  0.000398f, -0.475182f, -0.405069f,  0.000398f, -0.293119f,
- -0.147924f,  0.154811f, -0.451832f,  0.145763f,  0.154811f, -0.452533f,
- -0.155568f,  0.000398f, -0.475182f,  0.145763f,  0.154811f, -0.452533f,
-  0.153296f,  0.000398f, -0.475920f, -0.155568f,  0.000398f, -0.475182f,
-  0.145763f,  0.154811f, -0.452533f,  0.383828f,  0.154811f, -0.280552f,
-  0.153296f,  0.000398f, -0.475920f,  0.383828f,  0.154811f, -0.280552f,
-  0.403664f,  0.000398f, -0.295051f,  0.153296f,  0.000398f, -0.475920f,
-  0.383828f,  0.154811f, -0.280552f,  0.475427f,  0.154811f, -0.001514f,
-  0.403664f,  0.000398f, -0.295051f,  0.475427f,  0.154811f, -0.001514f,
-  0.499997f,  0.000398f, -0.001592f,  0.403664f,  0.000398f, -0.295051f,
-  0.500000f,  0.000398f,  0.000000f,  0.404602f,  0.000398f,  0.293764f,
-  0.475676f, -0.154054f,  0.000000f,  0.404602f,  0.000398f,  0.293764f,
-  0.384919f, -0.154054f,  0.279473f,  0.475676f, -0.154054f,  0.000000f,
-  0.404602f,  0.000398f,  0.293764f,  0.154811f,  0.000398f,  0.475430f,
-  0.384919f, -0.154054f,  0.279473f,  0.154811f,  0.000398f,  0.475430f,
-  0.147280f, -0.154054f,  0.452301f,  0.384919f, -0.154054f,  0.279473f,
-  0.154811f,  0.000398f,  0.475430f, -0.154054f,  0.000398f,  0.475676f,
-  0.147280f, -0.154054f,  0.452301f, -0.154054f,  0.000398f,  0.475676f,
- -0.146560f, -0.154054f,  0.452535f,  0.147280f, -0.154054f,  0.452301f,
- -0.154054f,  0.000398f,  0.475676f, -0.404134f,  0.000398f,  0.294408f,
- -0.146560f, -0.154054f,  0.452535f, -0.404134f,  0.000398f,  0.294408f,
- -0.384473f, -0.154054f,  0.280085f, -0.146560f, -0.154054f,  0.452535f,
- -0.404134f,  0.000398f,  0.294408f, -0.499999f,  0.000398f,  0.000796f,
- -0.384473f, -0.154054f,  0.280085f, -0.499999f,  0.000398f,  0.000796f,
- -0.475675f, -0.154054f,  0.000758f, -0.384473f, -0.154054f,  0.280085f,
- -0.499999f,  0.000398f,  0.000796f, -0.405069f,  0.000398f, -0.293119f,
- -0.475675f, -0.154054f,  0.000758f, -0.405069f,  0.000398f, -0.293119f,
- -0.385363f, -0.154054f, -0.278859f, -0.475675f, -0.154054f,  0.000758f,
- -0.405069f,  0.000398f, -0.293119f, -0.155568f,  0.000398f, -0.475182f,
- -0.385363f, -0.154054f, -0.278859f, -0.155568f,  0.000398f, -0.475182f,
- -0.148000f, -0.154054f, -0.452066f, -0.385363f, -0.154054f, -0.278859f,
- -0.155568f,  0.000398f, -0.475182f,  0.153296f,  0.000398f, -0.475920f,
- -0.148000f, -0.154054f, -0.452066f,  0.153296f,  0.000398f, -0.475920f,
-  0.145839f, -0.154054f, -0.452768f, -0.148000f, -0.154054f, -0.452066f,
-  0.153296f,  0.000398f, -0.475920f,  0.403664f,  0.000398f, -0.295051f,
-  0.145839f, -0.154054f, -0.452768f,  0.403664f,  0.000398f, -0.295051f,
-  0.384027f, -0.154054f, -0.280697f,  0.145839f, -0.154054f, -0.452768f,
-  0.403664f,  0.000398f, -0.295051f,  0.499997f,  0.000398f, -0.001592f,
-  0.384027f, -0.154054f, -0.280697f,  0.499997f,  0.000398f, -0.001592f,
-  0.475673f, -0.154054f, -0.001515f,  0.384027f, -0.154054f, -0.280697f,
-  0.475676f, -0.154054f,  0.000000f,  0.384919f, -0.154054f,  0.279473f,
-  0.404836f, -0.293441f,  0.000000f,  0.384919f, -0.154054f,  0.279473f,
-  0.327595f, -0.293441f,  0.237852f,  0.404836f, -0.293441f,  0.000000f,
-  0.384919f, -0.154054f,  0.279473f,  0.147280f, -0.154054f,  0.452301f,
-  0.327595f, -0.293441f,  0.237852f,  0.147280f, -0.154054f,  0.452301f,
-  0.125346f, -0.293441f,  0.384942f,  0.327595f, -0.293441f,  0.237852f,
-  0.147280f, -0.154054f,  0.452301f, -0.146560f, -0.154054f,  0.452535f,
-  0.125346f, -0.293441f,  0.384942f, -0.146560f, -0.154054f,  0.452535f,
- -0.124733f, -0.293441f,  0.385141f,  0.125346f, -0.293441f,  0.384942f,
- -0.146560f, -0.154054f,  0.452535f, -0.384473f, -0.154054f,  0.280085f,
- -0.124733f, -0.293441f,  0.385141f, -0.384473f, -0.154054f,  0.280085f,
- -0.327216f, -0.293441f,  0.238374f, -0.124733f, -0.293441f,  0.385141f,
- -0.384473f, -0.154054f,  0.280085f, -0.475675f, -0.154054f,  0.000758f,
- -0.327216f, -0.293441f,  0.238374f, -0.475675f, -0.154054f,  0.000758f,
- -0.404835f, -0.293441f,  0.000645f, -0.327216f, -0.293441f,  0.238374f,
- -0.475675f, -0.154054f,  0.000758f, -0.385363f, -0.154054f, -0.278859f,
- -0.404835f, -0.293441f,  0.000645f, -0.385363f, -0.154054f, -0.278859f,
- -0.327973f, -0.293441f, -0.237330f, -0.404835f, -0.293441f,  0.000645f,
- -0.385363f, -0.154054f, -0.278859f, -0.148000f, -0.154054f, -0.452066f,
- -0.327973f, -0.293441f, -0.237330f, -0.148000f, -0.154054f, -0.452066f,
- -0.125959f, -0.293441f, -0.384742f, -0.327973f, -0.293441f, -0.237330f,
- -0.148000f, -0.154054f, -0.452066f,  0.145839f, -0.154054f, -0.452768f,
- -0.125959f, -0.293441f, -0.384742f,  0.145839f, -0.154054f, -0.452768f,
-  0.124120f, -0.293441f, -0.385339f, -0.125959f, -0.293441f, -0.384742f,
-  0.145839f, -0.154054f, -0.452768f,  0.384027f, -0.154054f, -0.280697f,
-  0.124120f, -0.293441f, -0.385339f,  0.384027f, -0.154054f, -0.280697f,
-  0.326836f, -0.293441f, -0.238894f,  0.124120f, -0.293441f, -0.385339f,
-  0.384027f, -0.154054f, -0.280697f,  0.475673f, -0.154054f, -0.001515f,
-  0.326836f, -0.293441f, -0.238894f,  0.475673f, -0.154054f, -0.001515f,
-  0.404834f, -0.293441f, -0.001289f,  0.326836f, -0.293441f, -0.238894f,
-  0.404836f, -0.293441f,  0.000000f,  0.327595f, -0.293441f,  0.237852f,
-  0.294408f, -0.404134f,  0.000000f,  0.327595f, -0.293441f,  0.237852f,
-  0.238236f, -0.404134f,  0.172973f,  0.294408f, -0.404134f,  0.000000f,
-  0.327595f, -0.293441f,  0.237852f,  0.125346f, -0.293441f,  0.384942f,
-  0.238236f, -0.404134f,  0.172973f,  0.125346f, -0.293441f,  0.384942f,
-  0.091155f, -0.404134f,  0.279940f,  0.238236f, -0.404134f,  0.172973f,
-  0.125346f, -0.293441f,  0.384942f, -0.124733f, -0.293441f,  0.385141f,
-  0.091155f, -0.404134f,  0.279940f, -0.124733f, -0.293441f,  0.385141f,
- -0.090709f, -0.404134f,  0.280085f,  0.091155f, -0.404134f,  0.279940f,
- -0.124733f, -0.293441f,  0.385141f, -0.327216f, -0.293441f,  0.238374f,
- -0.090709f, -0.404134f,  0.280085f, -0.327216f, -0.293441f,  0.238374f,
- -0.237960f, -0.404134f,  0.173352f, -0.090709f, -0.404134f,  0.280085f,
- -0.327216f, -0.293441f,  0.238374f, -0.404835f, -0.293441f,  0.000645f,
- -0.237960f, -0.404134f,  0.173352f, -0.404835f, -0.293441f,  0.000645f,
- -0.294407f, -0.404134f,  0.000469f, -0.237960f, -0.404134f,  0.173352f,
- -0.404835f, -0.293441f,  0.000645f, -0.327973f, -0.293441f, -0.237330f,
- -0.294407f, -0.404134f,  0.000469f, -0.327973f, -0.293441f, -0.237330f,
- -0.238511f, -0.404134f, -0.172593f, -0.294407f, -0.404134f,  0.000469f,
- -0.327973f, -0.293441f, -0.237330f, -0.125959f, -0.293441f, -0.384742f,
- -0.238511f, -0.404134f, -0.172593f, -0.125959f, -0.293441f, -0.384742f,
- -0.091601f, -0.404134f, -0.279795f, -0.238511f, -0.404134f, -0.172593f,
- -0.125959f, -0.293441f, -0.384742f,  0.124120f, -0.293441f, -0.385339f,
- -0.091601f, -0.404134f, -0.279795f,  0.124120f, -0.293441f, -0.385339f,
-  0.090263f, -0.404134f, -0.280229f, -0.091601f, -0.404134f, -0.279795f,
-  0.124120f, -0.293441f, -0.385339f,  0.326836f, -0.293441f, -0.238894f,
-  0.090263f, -0.404134f, -0.280229f,  0.326836f, -0.293441f, -0.238894f,
-  0.237684f, -0.404134f, -0.173731f,  0.090263f, -0.404134f, -0.280229f,
-  0.326836f, -0.293441f, -0.238894f,  0.404834f, -0.293441f, -0.001289f,
-  0.237684f, -0.404134f, -0.173731f,  0.404834f, -0.293441f, -0.001289f,
-  0.294406f, -0.404134f, -0.000938f,  0.237684f, -0.404134f, -0.173731f,
-  0.294408f, -0.404134f,  0.000000f,  0.238236f, -0.404134f,  0.172973f,
-  0.155190f, -0.475306f,  0.000000f,  0.238236f, -0.404134f,  0.172973f,
-  0.125580f, -0.475306f,  0.091178f,  0.155190f, -0.475306f,  0.000000f,
-  0.238236f, -0.404134f,  0.172973f,  0.091155f, -0.404134f,  0.279940f,
-  0.125580f, -0.475306f,  0.091178f,  0.091155f, -0.404134f,  0.279940f,
-  0.048050f, -0.475306f,  0.147564f,  0.125580f, -0.475306f,  0.091178f,
-  0.091155f, -0.404134f,  0.279940f, -0.090709f, -0.404134f,  0.280085f,
-  0.048050f, -0.475306f,  0.147564f, -0.090709f, -0.404134f,  0.280085f,
- -0.047815f, -0.475306f,  0.147640f,  0.048050f, -0.475306f,  0.147564f,
- -0.090709f, -0.404134f,  0.280085f, -0.237960f, -0.404134f,  0.173352f,
- -0.047815f, -0.475306f,  0.147640f, -0.237960f, -0.404134f,  0.173352f,
- -0.125435f, -0.475306f,  0.091378f, -0.047815f, -0.475306f,  0.147640f,
- -0.237960f, -0.404134f,  0.173352f, -0.294407f, -0.404134f,  0.000469f,
- -0.125435f, -0.475306f,  0.091378f, -0.294407f, -0.404134f,  0.000469f,
- -0.155190f, -0.475306f,  0.000247f, -0.125435f, -0.475306f,  0.091378f,
- -0.294407f, -0.404134f,  0.000469f, -0.238511f, -0.404134f, -0.172593f,
- -0.155190f, -0.475306f,  0.000247f, -0.238511f, -0.404134f, -0.172593f,
- -0.125725f, -0.475306f, -0.090978f, -0.155190f, -0.475306f,  0.000247f,
- -0.238511f, -0.404134f, -0.172593f, -0.091601f, -0.404134f, -0.279795f,
- -0.125725f, -0.475306f, -0.090978f, -0.091601f, -0.404134f, -0.279795f,
- -0.048285f, -0.475306f, -0.147487f, -0.125725f, -0.475306f, -0.090978f,
- -0.091601f, -0.404134f, -0.279795f,  0.090263f, -0.404134f, -0.280229f,
- -0.048285f, -0.475306f, -0.147487f,  0.090263f, -0.404134f, -0.280229f,
-  0.047580f, -0.475306f, -0.147716f, -0.048285f, -0.475306f, -0.147487f,
-  0.090263f, -0.404134f, -0.280229f,  0.237684f, -0.404134f, -0.173731f,
-  0.047580f, -0.475306f, -0.147716f,  0.237684f, -0.404134f, -0.173731f,
-  0.125289f, -0.475306f, -0.091578f,  0.047580f, -0.475306f, -0.147716f,
-  0.237684f, -0.404134f, -0.173731f,  0.294406f, -0.404134f, -0.000938f,
-  0.125289f, -0.475306f, -0.091578f,  0.294406f, -0.404134f, -0.000938f,
-  0.155189f, -0.475306f, -0.000494f,  0.125289f, -0.475306f, -0.091578f,
-  0.155190f, -0.475306f,  0.000000f,  0.125580f, -0.475306f,  0.091178f,
-  0.000796f, -0.499999f,  0.000000f,  0.125580f, -0.475306f,  0.091178f,
-  0.000644f, -0.499999f,  0.000468f,  0.000796f, -0.499999f,  0.000000f,
-  0.125580f, -0.475306f,  0.091178f,  0.048050f, -0.475306f,  0.147564f,
-  0.000644f, -0.499999f,  0.000468f,  0.048050f, -0.475306f,  0.147564f,
-  0.000247f, -0.499999f,  0.000757f,  0.000644f, -0.499999f,  0.000468f,
-  0.048050f, -0.475306f,  0.147564f, -0.047815f, -0.475306f,  0.147640f,
-  0.000247f, -0.499999f,  0.000757f, -0.047815f, -0.475306f,  0.147640f,
- -0.000245f, -0.499999f,  0.000757f,  0.000247f, -0.499999f,  0.000757f,
- -0.047815f, -0.475306f,  0.147640f, -0.125435f, -0.475306f,  0.091378f,
- -0.000245f, -0.499999f,  0.000757f, -0.125435f, -0.475306f,  0.091378f,
- -0.000644f, -0.499999f,  0.000469f, -0.000245f, -0.499999f,  0.000757f,
- -0.125435f, -0.475306f,  0.091378f, -0.155190f, -0.475306f,  0.000247f,
- -0.000644f, -0.499999f,  0.000469f, -0.155190f, -0.475306f,  0.000247f,
- -0.000796f, -0.499999f,  0.000001f, -0.000644f, -0.499999f,  0.000469f,
- -0.155190f, -0.475306f,  0.000247f, -0.125725f, -0.475306f, -0.090978f,
- -0.000796f, -0.499999f,  0.000001f, -0.125725f, -0.475306f, -0.090978f,
- -0.000645f, -0.499999f, -0.000467f, -0.000796f, -0.499999f,  0.000001f,
- -0.125725f, -0.475306f, -0.090978f, -0.048285f, -0.475306f, -0.147487f,
- -0.000645f, -0.499999f, -0.000467f, -0.048285f, -0.475306f, -0.147487f,
- -0.000248f, -0.499999f, -0.000757f, -0.000645f, -0.499999f, -0.000467f,
- -0.048285f, -0.475306f, -0.147487f,  0.047580f, -0.475306f, -0.147716f,
- -0.000248f, -0.499999f, -0.000757f,  0.047580f, -0.475306f, -0.147716f,
-  0.000244f, -0.499999f, -0.000758f, -0.000248f, -0.499999f, -0.000757f,
-  0.047580f, -0.475306f, -0.147716f,  0.125289f, -0.475306f, -0.091578f,
-  0.000244f, -0.499999f, -0.000758f,  0.125289f, -0.475306f, -0.091578f,
-  0.000643f, -0.499999f, -0.000470f,  0.000244f, -0.499999f, -0.000758f,
-  0.125289f, -0.475306f, -0.091578f,  0.155189f, -0.475306f, -0.000494f,
-  0.000643f, -0.499999f, -0.000470f,  0.155189f, -0.475306f, -0.000494f,
-  0.000796f, -0.499999f, -0.000003f,  0.000643f, -0.499999f, -0.000470f,
-  0.000796f, -0.500000f,  0.000000f,  0.000644f, -0.500000f,  0.000468f,
-  0.000000f, -0.500000f,  0.000000f,  0.000644f, -0.500000f,  0.000468f,
-  0.000247f, -0.500000f,  0.000757f,  0.000000f, -0.500000f,  0.000000f,
-  0.000247f, -0.500000f,  0.000757f, -0.000245f, -0.500000f,  0.000757f,
-  0.000000f, -0.500000f,  0.000000f, -0.000245f, -0.500000f,  0.000757f,
- -0.000644f, -0.500000f,  0.000469f,  0.000000f, -0.500000f,  0.000000f,
- -0.000644f, -0.500000f,  0.000469f, -0.000796f, -0.500000f,  0.000001f,
-  0.000000f, -0.500000f,  0.000000f, -0.000796f, -0.500000f,  0.000001f,
- -0.000645f, -0.500000f, -0.000467f,  0.000000f, -0.500000f,  0.000000f,
- -0.000645f, -0.500000f, -0.000467f, -0.000248f, -0.500000f, -0.000757f,
-  0.000000f, -0.500000f,  0.000000f, -0.000248f, -0.500000f, -0.000757f,
-  0.000244f, -0.500000f, -0.000758f,  0.000000f, -0.500000f,  0.000000f,
-  0.000244f, -0.500000f, -0.000758f,  0.000643f, -0.500000f, -0.000470f,
-  0.000000f, -0.500000f,  0.000000f,  0.000643f, -0.500000f, -0.000470f,
-  0.000796f, -0.500000f, -0.000003f,  0.000000f, -0.500000f,  0.000000f
-};
-
-int sphereVerticesLength = sizeof(sphereVertices) / sizeof(float);
+static void angles(int slices, bool half, vector<float> &s, vector<float> &c)
+{
+	s.resize(slices);
+	c.resize(slices);
+	for (int j = 0; j < slices; ++j) {
+		float a = TWO_PI * (j + (half ? 0.5f : 0.0f)) / slices;
+		s[j] = sinf(a);
+		c[j] = cosf(a);
+	}
+}
 
 //
-// Each group of three values specifies a sphere triangle
+// vertex() - write one vertex (XYZW) and its normal
 //
-int sphereElements[] = {
-   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,
-  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
-  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,
-  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,
-  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,
-  75,  76,  77,  78,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,
-  90,  91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103, 104,
- 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
- 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
- 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149,
- 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
- 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
- 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194,
- 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
- 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
- 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
- 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
- 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
- 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284,
- 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299,
- 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314,
- 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329,
- 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
- 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359,
- 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
- 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
- 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
- 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
- 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
- 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
- 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
- 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
- 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
- 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
- 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
- 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
- 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
- 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
- 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
- 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599
-};
-
-int sphereElementsLength = sizeof(sphereElements) / sizeof(int);
-
+static inline void vertex(float *&p, float *&n, float x, float y, float z,
+	float nx, float ny, float nz)
+{
+	*p++ = x;  *p++ = y;  *p++ = z;  *p++ = 1.0f;
+	*n++ = nx; *n++ = ny; *n++ = nz;
+}
 
 //
-// makeSphere() - create a sphere object
+// ring() - write a ring of vertices of radius r at height y, whose
+// normals are nr outwards and ny up
 //
-void makeSphere(Canvas &C)
+static void ring(float *&p, float *&n, const vector<float> &s,
+	const vector<float> &c, float r, float y, float nr, float ny)
 {
-	int i;
-
-	for (i = 0; i < sphereElementsLength - 2; i += 3) {
-
-		// Calculate the base indices of the three vertices
-		int point1 = 3 * sphereElements[i];     // slots 0, 1, 2
-		int point2 = 3 * sphereElements[i + 1]; // slots 3, 4, 5
-		int point3 = 3 * sphereElements[i + 2]; // slots 6, 7, 8
-
-		Vertex p1 = { sphereVertices[point1 + 0],
-					  sphereVertices[point1 + 1],
-					  sphereVertices[point1 + 2] };
-
-		Vertex p2 = { sphereVertices[point2 + 0],
-					  sphereVertices[point2 + 1],
-					  sphereVertices[point2 + 2] };
-
-		Vertex p3 = { sphereVertices[point3 + 0],
-					  sphereVertices[point3 + 1],
-					  sphereVertices[point3 + 2] };
-
-		// Calculate the base indices of the three normals
-		int normal1 = 3 * sphereElements[i];     // slots 0, 1, 2
-		int normal2 = 3 * sphereElements[i + 1]; // slots 3, 4, 5
-		int normal3 = 3 * sphereElements[i + 2]; // slots 6, 7, 8
-
-		Normal n1 = { sphereVertices[normal1 + 0],
-					  sphereVertices[normal1 + 1],
-					  sphereVertices[normal1 + 2] };
-
-		Normal n2 = { sphereVertices[normal2 + 0],
-					  sphereVertices[normal2 + 1],
-					  sphereVertices[normal2 + 2] };
-
-		Normal n3 = { sphereVertices[normal3 + 0],
-					  sphereVertices[normal3 + 1],
-					  sphereVertices[normal3 + 2] };
-
-		// Add triangle and vertex normals
-		C.addTriangleWithNorms(p1, n1, p2, n2, p3, n3);
+	for (size_t j = 0; j < s.size(); ++j) {
+		vertex(p, n, r * s[j], y, r * c[j], nr * s[j], ny, nr * c[j]);
 	}
 }
 
-
-
 //
-// Each group of three values specifies a cone vertex
+// band() - triangles joining two rings of 'slices' vertices, the
+// lower one starting at vertex 'lower' and the upper one at 'upper'
 //
-float coneVertices[] = {
-   0.000000f,  -0.500000f,   0.500000f,  0.000000f,  -0.500000f,   0.000000f,
-   0.154433f,  -0.500000f,   0.475553f,  0.154433f,  -0.500000f,   0.475553f,
-   0.000000f,  -0.500000f,   0.000000f,  0.293764f,  -0.500000f,   0.404602f,
-   0.293764f,  -0.500000f,   0.404602f,  0.000000f,  -0.500000f,   0.000000f,
-   0.404368f,  -0.500000f,   0.294086f,  0.404368f,  -0.500000f,   0.294086f,
-   0.000000f,  -0.500000f,   0.000000f,  0.475430f,  -0.500000f,   0.154811f,
-   0.475430f,  -0.500000f,   0.154811f,  0.000000f,  -0.500000f,   0.000000f,
-   0.500000f,  -0.500000f,   0.000398f,  0.500000f,  -0.500000f,   0.000398f,
-   0.000000f,  -0.500000f,   0.000000f,  0.475676f,  -0.500000f,  -0.154054f,
-   0.475676f,  -0.500000f,  -0.154054f,  0.000000f,  -0.500000f,   0.000000f,
-   0.404836f,  -0.500000f,  -0.293441f,  0.404836f,  -0.500000f,  -0.293441f,
-   0.000000f,  -0.500000f,   0.000000f,  0.294408f,  -0.500000f,  -0.404134f,
-   0.294408f,  -0.500000f,  -0.404134f,  0.000000f,  -0.500000f,   0.000000f,
-   0.155190f,  -0.500000f,  -0.475306f,  0.155190f,  -0.500000f,  -0.475306f,
-   0.000000f,  -0.500000f,   0.000000f,  0.000796f,  -0.500000f,  -0.499999f,
-   0.000796f,  -0.500000f,  -0.499999f,  0.000000f,  -0.500000f,   0.000000f,
-  -0.153675f,  -0.500000f,  -0.475798f, -0.153675f,  -0.500000f,  -0.475798f,
-   0.000000f,  -0.500000f,   0.000000f, -0.293119f,  -0.500000f,  -0.405069f,
-  -0.293119f,  -0.500000f,  -0.405069f,  0.000000f,  -0.500000f,   0.000000f,
-  -0.403899f,  -0.500000f,  -0.294729f, -0.403899f,  -0.500000f,  -0.294729f,
-   0.000000f,  -0.500000f,   0.000000f, -0.475183f,  -0.500000f,  -0.155568f,
-  -0.475183f,  -0.500000f,  -0.155568f,  0.000000f,  -0.500000f,   0.000000f,
-  -0.499999f,  -0.500000f,  -0.001194f, -0.499999f,  -0.500000f,  -0.001194f,
-   0.000000f,  -0.500000f,   0.000000f, -0.475920f,  -0.500000f,   0.153297f,
-  -0.475920f,  -0.500000f,   0.153297f,  0.000000f,  -0.500000f,   0.000000f,
-  -0.405302f,  -0.500000f,   0.292797f, -0.405302f,  -0.500000f,   0.292797f,
-   0.000000f,  -0.500000f,   0.000000f, -0.295051f,  -0.500000f,   0.403665f,
-  -0.295051f,  -0.500000f,   0.403665f,  0.000000f,  -0.500000f,   0.000000f,
-  -0.155946f,  -0.500000f,   0.475059f, -0.155946f,  -0.500000f,   0.475059f,
-   0.000000f,  -0.500000f,   0.000000f, -0.001592f,  -0.500000f,   0.499997f,
-   0.000000f,  -0.500000f,   0.500000f,  0.154433f,  -0.500000f,   0.475553f,
-   0.000000f,  -0.450000f,   0.475000f,  0.154433f,  -0.500000f,   0.475553f,
-   0.146711f,  -0.450000f,   0.451775f,  0.000000f,  -0.450000f,   0.475000f,
-   0.154433f,  -0.500000f,   0.475553f,  0.293764f,  -0.500000f,   0.404602f,
-   0.146711f,  -0.450000f,   0.451775f,  0.293764f,  -0.500000f,   0.404602f,
-   0.279076f,  -0.450000f,   0.384372f,  0.146711f,  -0.450000f,   0.451775f,
-   0.293764f,  -0.500000f,   0.404602f,  0.404368f,  -0.500000f,   0.294086f,
-   0.279076f,  -0.450000f,   0.384372f,  0.404368f,  -0.500000f,   0.294086f,
-   0.384150f,  -0.450000f,   0.279382f,  0.279076f,  -0.450000f,   0.384372f,
-   0.404368f,  -0.500000f,   0.294086f,  0.475430f,  -0.500000f,   0.154811f,
-   0.384150f,  -0.450000f,   0.279382f,  0.475430f,  -0.500000f,   0.154811f,
-   0.451658f,  -0.450000f,   0.147071f,  0.384150f,  -0.450000f,   0.279382f,
-   0.475430f,  -0.500000f,   0.154811f,  0.500000f,  -0.500000f,   0.000398f,
-   0.451658f,  -0.450000f,   0.147071f,  0.500000f,  -0.500000f,   0.000398f,
-   0.475000f,  -0.450000f,   0.000378f,  0.451658f,  -0.450000f,   0.147071f,
-   0.500000f,  -0.500000f,   0.000398f,  0.475676f,  -0.500000f,  -0.154054f,
-   0.475000f,  -0.450000f,   0.000378f,  0.475676f,  -0.500000f,  -0.154054f,
-   0.451892f,  -0.450000f,  -0.146351f,  0.475000f,  -0.450000f,   0.000378f,
-   0.475676f,  -0.500000f,  -0.154054f,  0.404836f,  -0.500000f,  -0.293441f,
-   0.451892f,  -0.450000f,  -0.146351f,  0.404836f,  -0.500000f,  -0.293441f,
-   0.384594f,  -0.450000f,  -0.278769f,  0.451892f,  -0.450000f,  -0.146351f,
-   0.404836f,  -0.500000f,  -0.293441f,  0.294408f,  -0.500000f,  -0.404134f,
-   0.384594f,  -0.450000f,  -0.278769f,  0.294408f,  -0.500000f,  -0.404134f,
-   0.279687f,  -0.450000f,  -0.383927f,  0.384594f,  -0.450000f,  -0.278769f,
-   0.294408f,  -0.500000f,  -0.404134f,  0.155190f,  -0.500000f,  -0.475306f,
-   0.279687f,  -0.450000f,  -0.383927f,  0.155190f,  -0.500000f,  -0.475306f,
-   0.147430f,  -0.450000f,  -0.451541f,  0.279687f,  -0.450000f,  -0.383927f,
-   0.155190f,  -0.500000f,  -0.475306f,  0.000796f,  -0.500000f,  -0.499999f,
-   0.147430f,  -0.450000f,  -0.451541f,  0.000796f,  -0.500000f,  -0.499999f,
-   0.000756f,  -0.450000f,  -0.474999f,  0.147430f,  -0.450000f,  -0.451541f,
-   0.000796f,  -0.500000f,  -0.499999f, -0.153675f,  -0.500000f,  -0.475798f,
-   0.000756f,  -0.450000f,  -0.474999f, -0.153675f,  -0.500000f,  -0.475798f,
-  -0.145992f,  -0.450000f,  -0.452008f,  0.000756f,  -0.450000f,  -0.474999f,
-  -0.153675f,  -0.500000f,  -0.475798f, -0.293119f,  -0.500000f,  -0.405069f,
-  -0.145992f,  -0.450000f,  -0.452008f, -0.293119f,  -0.500000f,  -0.405069f,
-  -0.278463f,  -0.450000f,  -0.384816f, -0.145992f,  -0.450000f,  -0.452008f,
-  -0.293119f,  -0.500000f,  -0.405069f, -0.403899f,  -0.500000f,  -0.294729f,
-  -0.278463f,  -0.450000f,  -0.384816f, -0.403899f,  -0.500000f,  -0.294729f,
-  -0.383704f,  -0.450000f,  -0.279993f, -0.278463f,  -0.450000f,  -0.384816f,
-  -0.403899f,  -0.500000f,  -0.294729f, -0.475183f,  -0.500000f,  -0.155568f,
-  -0.383704f,  -0.450000f,  -0.279993f, -0.475183f,  -0.500000f,  -0.155568f,
-  -0.451424f,  -0.450000f,  -0.147790f, -0.383704f,  -0.450000f,  -0.279993f,
-  -0.475183f,  -0.500000f,  -0.155568f, -0.499999f,  -0.500000f,  -0.001194f,
-  -0.451424f,  -0.450000f,  -0.147790f, -0.499999f,  -0.500000f,  -0.001194f,
-  -0.474999f,  -0.450000f,  -0.001134f, -0.451424f,  -0.450000f,  -0.147790f,
-  -0.499999f,  -0.500000f,  -0.001194f, -0.475920f,  -0.500000f,   0.153297f,
-  -0.474999f,  -0.450000f,  -0.001134f, -0.475920f,  -0.500000f,   0.153297f,
-  -0.452124f,  -0.450000f,   0.145632f, -0.474999f,  -0.450000f,  -0.001134f,
-  -0.475920f,  -0.500000f,   0.153297f, -0.405302f,  -0.500000f,   0.292797f,
-  -0.452124f,  -0.450000f,   0.145632f, -0.405302f,  -0.500000f,   0.292797f,
-  -0.385037f,  -0.450000f,   0.278157f, -0.452124f,  -0.450000f,   0.145632f,
-  -0.405302f,  -0.500000f,   0.292797f, -0.295051f,  -0.500000f,   0.403665f,
-  -0.385037f,  -0.450000f,   0.278157f, -0.295051f,  -0.500000f,   0.403665f,
-  -0.280298f,  -0.450000f,   0.383481f, -0.385037f,  -0.450000f,   0.278157f,
-  -0.295051f,  -0.500000f,   0.403665f, -0.155946f,  -0.500000f,   0.475059f,
-  -0.280298f,  -0.450000f,   0.383481f, -0.155946f,  -0.500000f,   0.475059f,
-  -0.148149f,  -0.450000f,   0.451306f, -0.280298f,  -0.450000f,   0.383481f,
-  -0.155946f,  -0.500000f,   0.475059f, -0.001592f,  -0.500000f,   0.499997f,
-  -0.148149f,  -0.450000f,   0.451306f, -0.001592f,  -0.500000f,   0.499997f,
-  -0.001512f,  -0.450000f,   0.474998f, -0.148149f,  -0.450000f,   0.451306f,
-  -0.001512f,  -0.450000f,   0.474998f,  0.145272f,  -0.450000f,   0.452240f,
-  -0.001433f,  -0.400000f,   0.449998f,  0.145272f,  -0.450000f,   0.452240f,
-   0.137626f,  -0.400000f,   0.428438f, -0.001433f,  -0.400000f,   0.449998f,
-   0.145272f,  -0.450000f,   0.452240f,  0.277851f,  -0.450000f,   0.385258f,
-   0.137626f,  -0.400000f,   0.428438f,  0.277851f,  -0.450000f,   0.385258f,
-   0.263227f,  -0.400000f,   0.364982f,  0.137626f,  -0.400000f,   0.428438f,
-   0.277851f,  -0.450000f,   0.385258f,  0.383258f,  -0.450000f,   0.280603f,
-   0.263227f,  -0.400000f,   0.364982f,  0.383258f,  -0.450000f,   0.280603f,
-   0.363087f,  -0.400000f,   0.265834f,  0.263227f,  -0.400000f,   0.364982f,
-   0.383258f,  -0.450000f,   0.280603f,  0.451188f,  -0.450000f,   0.148508f,
-   0.363087f,  -0.400000f,   0.265834f,  0.451188f,  -0.450000f,   0.148508f,
-   0.427441f,  -0.400000f,   0.140692f,  0.363087f,  -0.400000f,   0.265834f,
-   0.451188f,  -0.450000f,   0.148508f,  0.474996f,  -0.450000f,   0.001890f,
-   0.427441f,  -0.400000f,   0.140692f,  0.474996f,  -0.450000f,   0.001890f,
-   0.449996f,  -0.400000f,   0.001791f,  0.427441f,  -0.400000f,   0.140692f,
-   0.474996f,  -0.450000f,   0.001890f,  0.452355f,  -0.450000f,  -0.144912f,
-   0.449996f,  -0.400000f,   0.001791f,  0.452355f,  -0.450000f,  -0.144912f,
-   0.428547f,  -0.400000f,  -0.137285f,  0.449996f,  -0.400000f,   0.001791f,
-   0.452355f,  -0.450000f,  -0.144912f,  0.385479f,  -0.450000f,  -0.277544f,
-   0.428547f,  -0.400000f,  -0.137285f,  0.385479f,  -0.450000f,  -0.277544f,
-   0.365191f,  -0.400000f,  -0.262936f,  0.428547f,  -0.400000f,  -0.137285f,
-   0.385479f,  -0.450000f,  -0.277544f,  0.280908f,  -0.450000f,  -0.383035f,
-   0.365191f,  -0.400000f,  -0.262936f,  0.280908f,  -0.450000f,  -0.383035f,
-   0.266123f,  -0.400000f,  -0.362875f,  0.365191f,  -0.400000f,  -0.262936f,
-   0.280908f,  -0.450000f,  -0.383035f,  0.148867f,  -0.450000f,  -0.451070f,
-   0.266123f,  -0.400000f,  -0.362875f,  0.148867f,  -0.450000f,  -0.451070f,
-   0.141032f,  -0.400000f,  -0.427329f,  0.266123f,  -0.400000f,  -0.362875f,
-   0.148867f,  -0.450000f,  -0.451070f,  0.002268f,  -0.450000f,  -0.474995f,
-   0.141032f,  -0.400000f,  -0.427329f,  0.002268f,  -0.450000f,  -0.474995f,
-   0.002149f,  -0.400000f,  -0.449995f,  0.141032f,  -0.400000f,  -0.427329f,
-   0.002268f,  -0.450000f,  -0.474995f, -0.144552f,  -0.450000f,  -0.452471f,
-   0.002149f,  -0.400000f,  -0.449995f, -0.144552f,  -0.450000f,  -0.452471f,
-  -0.136944f,  -0.400000f,  -0.428656f,  0.002149f,  -0.400000f,  -0.449995f,
-  -0.144552f,  -0.450000f,  -0.452471f, -0.277237f,  -0.450000f,  -0.385700f,
-  -0.136944f,  -0.400000f,  -0.428656f, -0.277237f,  -0.450000f,  -0.385700f,
-  -0.262646f,  -0.400000f,  -0.365400f, -0.136944f,  -0.400000f,  -0.428656f,
-  -0.277237f,  -0.450000f,  -0.385700f, -0.382811f,  -0.450000f,  -0.281213f,
-  -0.262646f,  -0.400000f,  -0.365400f, -0.382811f,  -0.450000f,  -0.281213f,
-  -0.362663f,  -0.400000f,  -0.266412f, -0.262646f,  -0.400000f,  -0.365400f,
-  -0.382811f,  -0.450000f,  -0.281213f, -0.450951f,  -0.450000f,  -0.149226f,
-  -0.362663f,  -0.400000f,  -0.266412f, -0.450951f,  -0.450000f,  -0.149226f,
-  -0.427217f,  -0.400000f,  -0.141372f, -0.362663f,  -0.400000f,  -0.266412f,
-  -0.450951f,  -0.450000f,  -0.149226f, -0.474993f,  -0.450000f,  -0.002646f,
-  -0.427217f,  -0.400000f,  -0.141372f, -0.474993f,  -0.450000f,  -0.002646f,
-  -0.449993f,  -0.400000f,  -0.002507f, -0.427217f,  -0.400000f,  -0.141372f,
-  -0.474993f,  -0.450000f,  -0.002646f, -0.452585f,  -0.450000f,   0.144192f,
-  -0.449993f,  -0.400000f,  -0.002507f, -0.452585f,  -0.450000f,   0.144192f,
-  -0.428765f,  -0.400000f,   0.136603f, -0.449993f,  -0.400000f,  -0.002507f,
-  -0.452585f,  -0.450000f,   0.144192f, -0.385921f,  -0.450000f,   0.276930f,
-  -0.428765f,  -0.400000f,   0.136603f, -0.385921f,  -0.450000f,   0.276930f,
-  -0.365609f,  -0.400000f,   0.262355f, -0.428765f,  -0.400000f,   0.136603f,
-  -0.385921f,  -0.450000f,   0.276930f, -0.281517f,  -0.450000f,   0.382587f,
-  -0.365609f,  -0.400000f,   0.262355f, -0.281517f,  -0.450000f,   0.382587f,
-  -0.266700f,  -0.400000f,   0.362451f, -0.365609f,  -0.400000f,   0.262355f,
-  -0.281517f,  -0.450000f,   0.382587f, -0.149584f,  -0.450000f,   0.450832f,
-  -0.266700f,  -0.400000f,   0.362451f, -0.149584f,  -0.450000f,   0.450832f,
-  -0.141711f,  -0.400000f,   0.427104f, -0.266700f,  -0.400000f,   0.362451f,
-  -0.149584f,  -0.450000f,   0.450832f, -0.003024f,  -0.450000f,   0.474990f,
-  -0.141711f,  -0.400000f,   0.427104f, -0.003024f,  -0.450000f,   0.474990f,
-  -0.002865f,  -0.400000f,   0.449991f, -0.141711f,  -0.400000f,   0.427104f,
-  -0.002865f,  -0.400000f,   0.449991f,  0.136262f,  -0.400000f,   0.428874f,
-  -0.002706f,  -0.350000f,   0.424991f,  0.136262f,  -0.400000f,   0.428874f,
-   0.128692f,  -0.350000f,   0.405047f, -0.002706f,  -0.350000f,   0.424991f,
-   0.136262f,  -0.400000f,   0.428874f,  0.262064f,  -0.400000f,   0.365818f,
-   0.128692f,  -0.350000f,   0.405047f,  0.262064f,  -0.400000f,   0.365818f,
-   0.247505f,  -0.350000f,   0.345494f,  0.128692f,  -0.350000f,   0.405047f,
-   0.262064f,  -0.400000f,   0.365818f,  0.362239f,  -0.400000f,   0.266989f,
-   0.247505f,  -0.350000f,   0.345494f,  0.362239f,  -0.400000f,   0.266989f,
-   0.342115f,  -0.350000f,   0.252156f,  0.247505f,  -0.350000f,   0.345494f,
-   0.362239f,  -0.400000f,   0.266989f,  0.426991f,  -0.400000f,   0.142051f,
-   0.342115f,  -0.350000f,   0.252156f,  0.426991f,  -0.400000f,   0.142051f,
-   0.403269f,  -0.350000f,   0.134160f,  0.342115f,  -0.350000f,   0.252156f,
-   0.426991f,  -0.400000f,   0.142051f,  0.449988f,  -0.400000f,   0.003223f,
-   0.403269f,  -0.350000f,   0.134160f,  0.449988f,  -0.400000f,   0.003223f,
-   0.424989f,  -0.350000f,   0.003044f,  0.403269f,  -0.350000f,   0.134160f,
-   0.449988f,  -0.400000f,   0.003223f,  0.428982f,  -0.400000f,  -0.135921f,
-   0.424989f,  -0.350000f,   0.003044f,  0.428982f,  -0.400000f,  -0.135921f,
-   0.405150f,  -0.350000f,  -0.128370f,  0.424989f,  -0.350000f,   0.003044f,
-   0.428982f,  -0.400000f,  -0.135921f,  0.366026f,  -0.400000f,  -0.261773f,
-   0.405150f,  -0.350000f,  -0.128370f,  0.366026f,  -0.400000f,  -0.261773f,
-   0.345691f,  -0.350000f,  -0.247230f,  0.405150f,  -0.350000f,  -0.128370f,
-   0.366026f,  -0.400000f,  -0.261773f,  0.267277f,  -0.400000f,  -0.362026f,
-   0.345691f,  -0.350000f,  -0.247230f,  0.267277f,  -0.400000f,  -0.362026f,
-   0.252428f,  -0.350000f,  -0.341914f,  0.345691f,  -0.350000f,  -0.247230f,
-   0.267277f,  -0.400000f,  -0.362026f,  0.142391f,  -0.400000f,  -0.426878f,
-   0.252428f,  -0.350000f,  -0.341914f,  0.142391f,  -0.400000f,  -0.426878f,
-   0.134480f,  -0.350000f,  -0.403163f,  0.252428f,  -0.350000f,  -0.341914f,
-   0.142391f,  -0.400000f,  -0.426878f,  0.003581f,  -0.400000f,  -0.449986f,
-   0.134480f,  -0.350000f,  -0.403163f,  0.003581f,  -0.400000f,  -0.449986f,
-   0.003382f,  -0.350000f,  -0.424987f,  0.134480f,  -0.350000f,  -0.403163f,
-   0.003581f,  -0.400000f,  -0.449986f, -0.135579f,  -0.400000f,  -0.429090f,
-   0.003382f,  -0.350000f,  -0.424987f, -0.135579f,  -0.400000f,  -0.429090f,
-  -0.128047f,  -0.350000f,  -0.405252f,  0.003382f,  -0.350000f,  -0.424987f,
-  -0.135579f,  -0.400000f,  -0.429090f, -0.261481f,  -0.400000f,  -0.366234f,
-  -0.128047f,  -0.350000f,  -0.405252f, -0.261481f,  -0.400000f,  -0.366234f,
-  -0.246954f,  -0.350000f,  -0.345888f, -0.128047f,  -0.350000f,  -0.405252f,
-  -0.261481f,  -0.400000f,  -0.366234f, -0.361813f,  -0.400000f,  -0.267565f,
-  -0.246954f,  -0.350000f,  -0.345888f, -0.361813f,  -0.400000f,  -0.267565f,
-  -0.341712f,  -0.350000f,  -0.252701f, -0.246954f,  -0.350000f,  -0.345888f,
-  -0.361813f,  -0.400000f,  -0.267565f, -0.426764f,  -0.400000f,  -0.142732f,
-  -0.341712f,  -0.350000f,  -0.252701f, -0.426764f,  -0.400000f,  -0.142732f,
-  -0.403055f,  -0.350000f,  -0.134802f, -0.341712f,  -0.350000f,  -0.252701f,
-  -0.426764f,  -0.400000f,  -0.142732f, -0.449983f,  -0.400000f,  -0.003941f,
-  -0.403055f,  -0.350000f,  -0.134802f, -0.449983f,  -0.400000f,  -0.003941f,
-  -0.424984f,  -0.350000f,  -0.003722f, -0.403055f,  -0.350000f,  -0.134802f,
-  -0.449983f,  -0.400000f,  -0.003941f, -0.429198f,  -0.400000f,   0.135236f,
-  -0.424984f,  -0.350000f,  -0.003722f, -0.429198f,  -0.400000f,   0.135236f,
-  -0.405354f,  -0.350000f,   0.127723f, -0.424984f,  -0.350000f,  -0.003722f,
-  -0.429198f,  -0.400000f,   0.135236f, -0.366444f,  -0.400000f,   0.261188f,
-  -0.405354f,  -0.350000f,   0.127723f, -0.366444f,  -0.400000f,   0.261188f,
-  -0.346086f,  -0.350000f,   0.246677f, -0.405354f,  -0.350000f,   0.127723f,
-  -0.366444f,  -0.400000f,   0.261188f, -0.267855f,  -0.400000f,   0.361599f,
-  -0.346086f,  -0.350000f,   0.246677f, -0.267855f,  -0.400000f,   0.361599f,
-  -0.252974f,  -0.350000f,   0.341510f, -0.346086f,  -0.350000f,   0.246677f,
-  -0.267855f,  -0.400000f,   0.361599f, -0.143073f,  -0.400000f,   0.426650f,
-  -0.252974f,  -0.350000f,   0.341510f, -0.143073f,  -0.400000f,   0.426650f,
-  -0.135125f,  -0.350000f,   0.402947f, -0.252974f,  -0.350000f,   0.341510f,
-  -0.143073f,  -0.400000f,   0.426650f, -0.004301f,  -0.400000f,   0.449979f,
-  -0.135125f,  -0.350000f,   0.402947f, -0.004301f,  -0.400000f,   0.449979f,
-  -0.004062f,  -0.350000f,   0.424981f, -0.135125f,  -0.350000f,   0.402947f,
-  -0.004062f,  -0.350000f,   0.424981f,  0.127398f,  -0.350000f,   0.405456f,
-  -0.003823f,  -0.300000f,   0.399982f,  0.127398f,  -0.350000f,   0.405456f,
-   0.119904f,  -0.300000f,   0.381606f, -0.003823f,  -0.300000f,   0.399982f,
-   0.127398f,  -0.350000f,   0.405456f,  0.246400f,  -0.350000f,   0.346283f,
-   0.119904f,  -0.300000f,   0.381606f,  0.246400f,  -0.350000f,   0.346283f,
-   0.231906f,  -0.300000f,   0.325913f,  0.119904f,  -0.300000f,   0.381606f,
-   0.246400f,  -0.350000f,   0.346283f,  0.341307f,  -0.350000f,   0.253247f,
-   0.231906f,  -0.300000f,   0.325913f,  0.341307f,  -0.350000f,   0.253247f,
-   0.321230f,  -0.300000f,   0.238351f,  0.231906f,  -0.300000f,   0.325913f,
-   0.341307f,  -0.350000f,   0.253247f,  0.402839f,  -0.350000f,   0.135447f,
-   0.321230f,  -0.300000f,   0.238351f,  0.402839f,  -0.350000f,   0.135447f,
-   0.379142f,  -0.300000f,   0.127480f,  0.321230f,  -0.300000f,   0.238351f,
-   0.402839f,  -0.350000f,   0.135447f,  0.424977f,  -0.350000f,   0.004402f,
-   0.379142f,  -0.300000f,   0.127480f,  0.424977f,  -0.350000f,   0.004402f,
-   0.399979f,  -0.300000f,   0.004143f,  0.379142f,  -0.300000f,   0.127480f,
-   0.424977f,  -0.350000f,   0.004402f,  0.405558f,  -0.350000f,  -0.127074f,
-   0.399979f,  -0.300000f,   0.004143f,  0.405558f,  -0.350000f,  -0.127074f,
-   0.381702f,  -0.300000f,  -0.119599f,  0.399979f,  -0.300000f,   0.004143f,
-   0.405558f,  -0.350000f,  -0.127074f,  0.346480f,  -0.350000f,  -0.246123f,
-   0.381702f,  -0.300000f,  -0.119599f,  0.346480f,  -0.350000f,  -0.246123f,
-   0.326099f,  -0.300000f,  -0.231645f,  0.381702f,  -0.300000f,  -0.119599f,
-   0.346480f,  -0.350000f,  -0.246123f,  0.253521f,  -0.350000f,  -0.341105f,
-   0.326099f,  -0.300000f,  -0.231645f,  0.253521f,  -0.350000f,  -0.341105f,
-   0.238608f,  -0.300000f,  -0.321040f,  0.326099f,  -0.300000f,  -0.231645f,
-   0.253521f,  -0.350000f,  -0.341105f,  0.135770f,  -0.350000f,  -0.402730f,
-   0.238608f,  -0.300000f,  -0.321040f,  0.135770f,  -0.350000f,  -0.402730f,
-   0.127783f,  -0.300000f,  -0.379040f,  0.238608f,  -0.300000f,  -0.321040f,
-   0.135770f,  -0.350000f,  -0.402730f,  0.004742f,  -0.350000f,  -0.424974f,
-   0.127783f,  -0.300000f,  -0.379040f,  0.004742f,  -0.350000f,  -0.424974f,
-   0.004463f,  -0.300000f,  -0.399975f,  0.127783f,  -0.300000f,  -0.379040f,
-   0.004742f,  -0.350000f,  -0.424974f, -0.126749f,  -0.350000f,  -0.405660f,
-   0.004463f,  -0.300000f,  -0.399975f, -0.126749f,  -0.350000f,  -0.405660f,
-  -0.119293f,  -0.300000f,  -0.381797f,  0.004463f,  -0.300000f,  -0.399975f,
-  -0.126749f,  -0.350000f,  -0.405660f, -0.245846f,  -0.350000f,  -0.346677f,
-  -0.119293f,  -0.300000f,  -0.381797f, -0.245846f,  -0.350000f,  -0.346677f,
-  -0.231384f,  -0.300000f,  -0.326284f, -0.119293f,  -0.300000f,  -0.381797f,
-  -0.245846f,  -0.350000f,  -0.346677f, -0.340901f,  -0.350000f,  -0.253794f,
-  -0.231384f,  -0.300000f,  -0.326284f, -0.340901f,  -0.350000f,  -0.253794f,
-  -0.320848f,  -0.300000f,  -0.238864f, -0.231384f,  -0.300000f,  -0.326284f,
-  -0.340901f,  -0.350000f,  -0.253794f, -0.402621f,  -0.350000f,  -0.136092f,
-  -0.320848f,  -0.300000f,  -0.238864f, -0.402621f,  -0.350000f,  -0.136092f,
-  -0.378938f,  -0.300000f,  -0.128087f, -0.320848f,  -0.300000f,  -0.238864f,
-  -0.402621f,  -0.350000f,  -0.136092f, -0.424970f,  -0.350000f,  -0.005082f,
-  -0.378938f,  -0.300000f,  -0.128087f, -0.424970f,  -0.350000f,  -0.005082f,
-  -0.399971f,  -0.300000f,  -0.004783f, -0.378938f,  -0.300000f,  -0.128087f,
-  -0.424970f,  -0.350000f,  -0.005082f, -0.405761f,  -0.350000f,   0.126424f,
-  -0.399971f,  -0.300000f,  -0.004783f, -0.405761f,  -0.350000f,   0.126424f,
-  -0.381893f,  -0.300000f,   0.118987f, -0.399971f,  -0.300000f,  -0.004783f,
-  -0.405761f,  -0.350000f,   0.126424f, -0.346874f,  -0.350000f,   0.245568f,
-  -0.381893f,  -0.300000f,   0.118987f, -0.346874f,  -0.350000f,   0.245568f,
-  -0.326469f,  -0.300000f,   0.231123f, -0.381893f,  -0.300000f,   0.118987f,
-  -0.346874f,  -0.350000f,   0.245568f, -0.254066f,  -0.350000f,   0.340698f,
-  -0.326469f,  -0.300000f,   0.231123f, -0.254066f,  -0.350000f,   0.340698f,
-  -0.239121f,  -0.300000f,   0.320657f, -0.326469f,  -0.300000f,   0.231123f,
-  -0.254066f,  -0.350000f,   0.340698f, -0.136414f,  -0.350000f,   0.402512f,
-  -0.239121f,  -0.300000f,   0.320657f, -0.136414f,  -0.350000f,   0.402512f,
-  -0.128390f,  -0.300000f,   0.378835f, -0.239121f,  -0.300000f,   0.320657f,
-  -0.136414f,  -0.350000f,   0.402512f, -0.005423f,  -0.350000f,   0.424965f,
-  -0.128390f,  -0.300000f,   0.378835f, -0.005423f,  -0.350000f,   0.424965f,
-  -0.005104f,  -0.300000f,   0.399967f, -0.128390f,  -0.300000f,   0.378835f,
-  -0.005104f,  -0.300000f,   0.399967f,  0.118682f,  -0.300000f,   0.381988f,
-  -0.004785f,  -0.250000f,   0.374969f,  0.118682f,  -0.300000f,   0.381988f,
-   0.111264f,  -0.250000f,   0.358113f, -0.004785f,  -0.250000f,   0.374969f,
-   0.118682f,  -0.300000f,   0.381988f,  0.230861f,  -0.300000f,   0.326654f,
-   0.111264f,  -0.250000f,   0.358113f,  0.230861f,  -0.300000f,   0.326654f,
-   0.216433f,  -0.250000f,   0.306238f,  0.111264f,  -0.250000f,   0.358113f,
-   0.230861f,  -0.300000f,   0.326654f,  0.320466f,  -0.300000f,   0.239378f,
-   0.216433f,  -0.250000f,   0.306238f,  0.320466f,  -0.300000f,   0.239378f,
-   0.300437f,  -0.250000f,   0.224417f,  0.216433f,  -0.250000f,   0.306238f,
-   0.320466f,  -0.300000f,   0.239378f,  0.378732f,  -0.300000f,   0.128693f,
-   0.300437f,  -0.250000f,   0.224417f,  0.378732f,  -0.300000f,   0.128693f,
-   0.355061f,  -0.250000f,   0.120650f,  0.300437f,  -0.250000f,   0.224417f,
-   0.378732f,  -0.300000f,   0.128693f,  0.399963f,  -0.300000f,   0.005424f,
-   0.355061f,  -0.250000f,   0.120650f,  0.399963f,  -0.300000f,   0.005424f,
-   0.374966f,  -0.250000f,   0.005085f,  0.355061f,  -0.250000f,   0.120650f,
-   0.399963f,  -0.300000f,   0.005424f,  0.382083f,  -0.300000f,  -0.118376f,
-   0.374966f,  -0.250000f,   0.005085f,  0.382083f,  -0.300000f,  -0.118376f,
-   0.358202f,  -0.250000f,  -0.110977f,  0.374966f,  -0.250000f,   0.005085f,
-   0.382083f,  -0.300000f,  -0.118376f,  0.326839f,  -0.300000f,  -0.230600f,
-   0.358202f,  -0.250000f,  -0.110977f,  0.326839f,  -0.300000f,  -0.230600f,
-   0.306411f,  -0.250000f,  -0.216187f,  0.358202f,  -0.250000f,  -0.110977f,
-   0.326839f,  -0.300000f,  -0.230600f,  0.239634f,  -0.300000f,  -0.320274f,
-   0.306411f,  -0.250000f,  -0.216187f,  0.239634f,  -0.300000f,  -0.320274f,
-   0.224657f,  -0.250000f,  -0.300257f,  0.306411f,  -0.250000f,  -0.216187f,
-   0.239634f,  -0.300000f,  -0.320274f,  0.128996f,  -0.300000f,  -0.378629f,
-   0.224657f,  -0.250000f,  -0.300257f,  0.128996f,  -0.300000f,  -0.378629f,
-   0.120934f,  -0.250000f,  -0.354965f,  0.224657f,  -0.250000f,  -0.300257f,
-   0.128996f,  -0.300000f,  -0.378629f,  0.005744f,  -0.300000f,  -0.399959f,
-   0.120934f,  -0.250000f,  -0.354965f,  0.005744f,  -0.300000f,  -0.399959f,
-   0.005385f,  -0.250000f,  -0.374961f,  0.120934f,  -0.250000f,  -0.354965f,
-   0.005744f,  -0.300000f,  -0.399959f, -0.118070f,  -0.300000f,  -0.382177f,
-   0.005385f,  -0.250000f,  -0.374961f, -0.118070f,  -0.300000f,  -0.382177f,
-  -0.110691f,  -0.250000f,  -0.358291f,  0.005385f,  -0.250000f,  -0.374961f,
-  -0.118070f,  -0.300000f,  -0.382177f, -0.230338f,  -0.300000f,  -0.327023f,
-  -0.110691f,  -0.250000f,  -0.358291f, -0.230338f,  -0.300000f,  -0.327023f,
-  -0.215942f,  -0.250000f,  -0.306584f, -0.110691f,  -0.250000f,  -0.358291f,
-  -0.230338f,  -0.300000f,  -0.327023f, -0.320082f,  -0.300000f,  -0.239891f,
-  -0.215942f,  -0.250000f,  -0.306584f, -0.320082f,  -0.300000f,  -0.239891f,
-  -0.300077f,  -0.250000f,  -0.224897f, -0.215942f,  -0.250000f,  -0.306584f,
-  -0.320082f,  -0.300000f,  -0.239891f, -0.378526f,  -0.300000f,  -0.129299f,
-  -0.300077f,  -0.250000f,  -0.224897f, -0.378526f,  -0.300000f,  -0.129299f,
-  -0.354868f,  -0.250000f,  -0.121218f, -0.300077f,  -0.250000f,  -0.224897f,
-  -0.378526f,  -0.300000f,  -0.129299f, -0.399954f,  -0.300000f,  -0.006064f,
-  -0.354868f,  -0.250000f,  -0.121218f, -0.399954f,  -0.300000f,  -0.006064f,
-  -0.374957f,  -0.250000f,  -0.005685f, -0.354868f,  -0.250000f,  -0.121218f,
-  -0.399954f,  -0.300000f,  -0.006064f, -0.382272f,  -0.300000f,   0.117764f,
-  -0.374957f,  -0.250000f,  -0.005685f, -0.382272f,  -0.300000f,   0.117764f,
-  -0.358380f,  -0.250000f,   0.110404f, -0.374957f,  -0.250000f,  -0.005685f,
-  -0.382272f,  -0.300000f,   0.117764f, -0.327208f,  -0.300000f,   0.230076f,
-  -0.358380f,  -0.250000f,   0.110404f, -0.327208f,  -0.300000f,   0.230076f,
-  -0.306757f,  -0.250000f,   0.215697f, -0.358380f,  -0.250000f,   0.110404f,
-  -0.327208f,  -0.300000f,   0.230076f, -0.240147f,  -0.300000f,   0.319890f,
-  -0.306757f,  -0.250000f,   0.215697f, -0.240147f,  -0.300000f,   0.319890f,
-  -0.225138f,  -0.250000f,   0.299897f, -0.306757f,  -0.250000f,   0.215697f,
-  -0.240147f,  -0.300000f,   0.319890f, -0.129602f,  -0.300000f,   0.378422f,
-  -0.225138f,  -0.250000f,   0.299897f, -0.129602f,  -0.300000f,   0.378422f,
-  -0.121502f,  -0.250000f,   0.354771f, -0.225138f,  -0.250000f,   0.299897f,
-  -0.129602f,  -0.300000f,   0.378422f, -0.006384f,  -0.300000f,   0.399949f,
-  -0.121502f,  -0.250000f,   0.354771f, -0.006384f,  -0.300000f,   0.399949f,
-  -0.005985f,  -0.250000f,   0.374952f, -0.121502f,  -0.250000f,   0.354771f,
-  -0.005985f,  -0.250000f,   0.374952f,  0.110117f,  -0.250000f,   0.358468f,
-  -0.005586f,  -0.200000f,   0.349955f,  0.110117f,  -0.250000f,   0.358468f,
-   0.102776f,  -0.200000f,   0.334570f, -0.005586f,  -0.200000f,   0.349955f,
-   0.110117f,  -0.250000f,   0.358468f,  0.215452f,  -0.250000f,   0.306929f,
-   0.102776f,  -0.200000f,   0.334570f,  0.215452f,  -0.250000f,   0.306929f,
-   0.201088f,  -0.200000f,   0.286467f,  0.102776f,  -0.200000f,   0.334570f,
-   0.215452f,  -0.250000f,   0.306929f,  0.299717f,  -0.250000f,   0.225377f,
-   0.201088f,  -0.200000f,   0.286467f,  0.299717f,  -0.250000f,   0.225377f,
-   0.279736f,  -0.200000f,   0.210352f,  0.201088f,  -0.200000f,   0.286467f,
-   0.299717f,  -0.250000f,   0.225377f,  0.354674f,  -0.250000f,   0.121785f,
-   0.279736f,  -0.200000f,   0.210352f,  0.354674f,  -0.250000f,   0.121785f,
-   0.331029f,  -0.200000f,   0.113666f,  0.279736f,  -0.200000f,   0.210352f,
-   0.354674f,  -0.250000f,   0.121785f,  0.374947f,  -0.250000f,   0.006285f,
-   0.331029f,  -0.200000f,   0.113666f,  0.374947f,  -0.250000f,   0.006285f,
-   0.349951f,  -0.200000f,   0.005866f,  0.331029f,  -0.200000f,   0.113666f,
-   0.374947f,  -0.250000f,   0.006285f,  0.358556f,  -0.250000f,  -0.109831f,
-   0.349951f,  -0.200000f,   0.005866f,  0.358556f,  -0.250000f,  -0.109831f,
-   0.334652f,  -0.200000f,  -0.102509f,  0.349951f,  -0.200000f,   0.005866f,
-   0.358556f,  -0.250000f,  -0.109831f,  0.307102f,  -0.250000f,  -0.215206f,
-   0.334652f,  -0.200000f,  -0.102509f,  0.307102f,  -0.250000f,  -0.215206f,
-   0.286628f,  -0.200000f,  -0.200859f,  0.334652f,  -0.200000f,  -0.102509f,
-   0.307102f,  -0.250000f,  -0.215206f,  0.225617f,  -0.250000f,  -0.299536f,
-   0.286628f,  -0.200000f,  -0.200859f,  0.225617f,  -0.250000f,  -0.299536f,
-   0.210576f,  -0.200000f,  -0.279567f,  0.286628f,  -0.200000f,  -0.200859f,
-   0.225617f,  -0.250000f,  -0.299536f,  0.122069f,  -0.250000f,  -0.354576f,
-   0.210576f,  -0.200000f,  -0.279567f,  0.122069f,  -0.250000f,  -0.354576f,
-   0.113931f,  -0.200000f,  -0.330938f,  0.210576f,  -0.200000f,  -0.279567f,
-   0.122069f,  -0.250000f,  -0.354576f,  0.006585f,  -0.250000f,  -0.374942f,
-   0.113931f,  -0.200000f,  -0.330938f,  0.006585f,  -0.250000f,  -0.374942f,
-   0.006146f,  -0.200000f,  -0.349946f,  0.113931f,  -0.200000f,  -0.330938f,
-   0.006585f,  -0.250000f,  -0.374942f, -0.109544f,  -0.250000f,  -0.358644f,
-   0.006146f,  -0.200000f,  -0.349946f, -0.109544f,  -0.250000f,  -0.358644f,
-  -0.102241f,  -0.200000f,  -0.334734f,  0.006146f,  -0.200000f,  -0.349946f,
-  -0.109544f,  -0.250000f,  -0.358644f, -0.214960f,  -0.250000f,  -0.307274f,
-  -0.102241f,  -0.200000f,  -0.334734f, -0.214960f,  -0.250000f,  -0.307274f,
-  -0.200629f,  -0.200000f,  -0.286789f, -0.102241f,  -0.200000f,  -0.334734f,
-  -0.214960f,  -0.250000f,  -0.307274f, -0.299356f,  -0.250000f,  -0.225856f,
-  -0.200629f,  -0.200000f,  -0.286789f, -0.299356f,  -0.250000f,  -0.225856f,
-  -0.279399f,  -0.200000f,  -0.210799f, -0.200629f,  -0.200000f,  -0.286789f,
-  -0.299356f,  -0.250000f,  -0.225856f, -0.354478f,  -0.250000f,  -0.122353f,
-  -0.279399f,  -0.200000f,  -0.210799f, -0.354478f,  -0.250000f,  -0.122353f,
-  -0.330846f,  -0.200000f,  -0.114196f, -0.279399f,  -0.200000f,  -0.210799f,
-  -0.354478f,  -0.250000f,  -0.122353f, -0.374937f,  -0.250000f,  -0.006885f,
-  -0.330846f,  -0.200000f,  -0.114196f, -0.374937f,  -0.250000f,  -0.006885f,
-  -0.349941f,  -0.200000f,  -0.006426f, -0.330846f,  -0.200000f,  -0.114196f,
-  -0.374937f,  -0.250000f,  -0.006885f, -0.358731f,  -0.250000f,   0.109256f,
-  -0.349941f,  -0.200000f,  -0.006426f, -0.358731f,  -0.250000f,   0.109256f,
-  -0.334816f,  -0.200000f,   0.101973f, -0.349941f,  -0.200000f,  -0.006426f,
-  -0.358731f,  -0.250000f,   0.109256f, -0.307446f,  -0.250000f,   0.214714f,
-  -0.334816f,  -0.200000f,   0.101973f, -0.307446f,  -0.250000f,   0.214714f,
-  -0.286949f,  -0.200000f,   0.200400f, -0.334816f,  -0.200000f,   0.101973f,
-  -0.307446f,  -0.250000f,   0.214714f, -0.226096f,  -0.250000f,   0.299175f,
-  -0.286949f,  -0.200000f,   0.200400f, -0.226096f,  -0.250000f,   0.299175f,
-  -0.211023f,  -0.200000f,   0.279230f, -0.286949f,  -0.200000f,   0.200400f,
-  -0.226096f,  -0.250000f,   0.299175f, -0.122637f,  -0.250000f,   0.354380f,
-  -0.211023f,  -0.200000f,   0.279230f, -0.122637f,  -0.250000f,   0.354380f,
-  -0.114461f,  -0.200000f,   0.330755f, -0.211023f,  -0.200000f,   0.279230f,
-  -0.122637f,  -0.250000f,   0.354380f, -0.007185f,  -0.250000f,   0.374931f,
-  -0.114461f,  -0.200000f,   0.330755f, -0.007185f,  -0.250000f,   0.374931f,
-  -0.006706f,  -0.200000f,   0.349936f, -0.114461f,  -0.200000f,   0.330755f,
-  -0.006706f,  -0.200000f,   0.349936f,  0.101705f,  -0.200000f,   0.334897f,
-  -0.006227f,  -0.150000f,   0.324940f,  0.101705f,  -0.200000f,   0.334897f,
-   0.094440f,  -0.150000f,   0.310976f, -0.006227f,  -0.150000f,   0.324940f,
-   0.101705f,  -0.200000f,   0.334897f,  0.200170f,  -0.200000f,   0.287110f,
-   0.094440f,  -0.150000f,   0.310976f,  0.200170f,  -0.200000f,   0.287110f,
-   0.185872f,  -0.150000f,   0.266602f,  0.094440f,  -0.150000f,   0.310976f,
-   0.200170f,  -0.200000f,   0.287110f,  0.279061f,  -0.200000f,   0.211246f,
-   0.185872f,  -0.150000f,   0.266602f,  0.279061f,  -0.200000f,   0.211246f,
-   0.259128f,  -0.150000f,   0.196157f,  0.185872f,  -0.150000f,   0.266602f,
-   0.279061f,  -0.200000f,   0.211246f,  0.330663f,  -0.200000f,   0.114726f,
-   0.259128f,  -0.150000f,   0.196157f,  0.330663f,  -0.200000f,   0.114726f,
-   0.307044f,  -0.150000f,   0.106531f,  0.259128f,  -0.150000f,   0.196157f,
-   0.330663f,  -0.200000f,   0.114726f,  0.349930f,  -0.200000f,   0.006986f,
-   0.307044f,  -0.150000f,   0.106531f,  0.349930f,  -0.200000f,   0.006986f,
-   0.324935f,  -0.150000f,   0.006487f,  0.307044f,  -0.150000f,   0.106531f,
-   0.349930f,  -0.200000f,   0.006986f,  0.334978f,  -0.200000f,  -0.101437f,
-   0.324935f,  -0.150000f,   0.006487f,  0.334978f,  -0.200000f,  -0.101437f,
-   0.311051f,  -0.150000f,  -0.094191f,  0.324935f,  -0.150000f,   0.006487f,
-   0.334978f,  -0.200000f,  -0.101437f,  0.287270f,  -0.200000f,  -0.199940f,
-   0.311051f,  -0.150000f,  -0.094191f,  0.287270f,  -0.200000f,  -0.199940f,
-   0.266751f,  -0.150000f,  -0.185659f,  0.311051f,  -0.150000f,  -0.094191f,
-   0.287270f,  -0.200000f,  -0.199940f,  0.211470f,  -0.200000f,  -0.278892f,
-   0.266751f,  -0.150000f,  -0.185659f,  0.211470f,  -0.200000f,  -0.278892f,
-   0.196365f,  -0.150000f,  -0.258971f,  0.266751f,  -0.150000f,  -0.185659f,
-   0.211470f,  -0.200000f,  -0.278892f,  0.114990f,  -0.200000f,  -0.330571f,
-   0.196365f,  -0.150000f,  -0.258971f,  0.114990f,  -0.200000f,  -0.330571f,
-   0.106777f,  -0.150000f,  -0.306959f,  0.196365f,  -0.150000f,  -0.258971f,
-   0.114990f,  -0.200000f,  -0.330571f,  0.007266f,  -0.200000f,  -0.349925f,
-   0.106777f,  -0.150000f,  -0.306959f,  0.007266f,  -0.200000f,  -0.349925f,
-   0.006747f,  -0.150000f,  -0.324930f,  0.106777f,  -0.150000f,  -0.306959f,
-   0.007266f,  -0.200000f,  -0.349925f, -0.101168f,  -0.200000f,  -0.335060f,
-   0.006747f,  -0.150000f,  -0.324930f, -0.101168f,  -0.200000f,  -0.335060f,
-  -0.093942f,  -0.150000f,  -0.311127f,  0.006747f,  -0.150000f,  -0.324930f,
-  -0.101168f,  -0.200000f,  -0.335060f, -0.199710f,  -0.200000f,  -0.287430f,
-  -0.093942f,  -0.150000f,  -0.311127f, -0.199710f,  -0.200000f,  -0.287430f,
-  -0.185445f,  -0.150000f,  -0.266899f, -0.093942f,  -0.150000f,  -0.311127f,
-  -0.199710f,  -0.200000f,  -0.287430f, -0.278722f,  -0.200000f,  -0.211693f,
-  -0.185445f,  -0.150000f,  -0.266899f, -0.278722f,  -0.200000f,  -0.211693f,
-  -0.258814f,  -0.150000f,  -0.196572f, -0.185445f,  -0.150000f,  -0.266899f,
-  -0.278722f,  -0.200000f,  -0.211693f, -0.330479f,  -0.200000f,  -0.115255f,
-  -0.258814f,  -0.150000f,  -0.196572f, -0.330479f,  -0.200000f,  -0.115255f,
-  -0.306873f,  -0.150000f,  -0.107022f, -0.258814f,  -0.150000f,  -0.196572f,
-  -0.330479f,  -0.200000f,  -0.115255f, -0.349919f,  -0.200000f,  -0.007546f,
-  -0.306873f,  -0.150000f,  -0.107022f, -0.349919f,  -0.200000f,  -0.007546f,
-  -0.324924f,  -0.150000f,  -0.007007f, -0.306873f,  -0.150000f,  -0.107022f,
-  -0.349919f,  -0.200000f,  -0.007546f, -0.335140f,  -0.200000f,   0.100900f,
-  -0.324924f,  -0.150000f,  -0.007007f, -0.335140f,  -0.200000f,   0.100900f,
-  -0.311202f,  -0.150000f,   0.093693f, -0.324924f,  -0.150000f,  -0.007007f,
-  -0.335140f,  -0.200000f,   0.100900f, -0.287590f,  -0.200000f,   0.199480f,
-  -0.311202f,  -0.150000f,   0.093693f, -0.287590f,  -0.200000f,   0.199480f,
-  -0.267047f,  -0.150000f,   0.185231f, -0.311202f,  -0.150000f,   0.093693f,
-  -0.287590f,  -0.200000f,   0.199480f, -0.211916f,  -0.200000f,   0.278553f,
-  -0.267047f,  -0.150000f,   0.185231f, -0.211916f,  -0.200000f,   0.278553f,
-  -0.196779f,  -0.150000f,   0.258656f, -0.267047f,  -0.150000f,   0.185231f,
-  -0.211916f,  -0.200000f,   0.278553f, -0.115519f,  -0.200000f,   0.330387f,
-  -0.196779f,  -0.150000f,   0.258656f, -0.115519f,  -0.200000f,   0.330387f,
-  -0.107268f,  -0.150000f,   0.306787f, -0.196779f,  -0.150000f,   0.258656f,
-  -0.115519f,  -0.200000f,   0.330387f, -0.007826f,  -0.200000f,   0.349912f,
-  -0.107268f,  -0.150000f,   0.306787f, -0.007826f,  -0.200000f,   0.349912f,
-  -0.007267f,  -0.150000f,   0.324919f, -0.107268f,  -0.150000f,   0.306787f,
-  -0.007267f,  -0.150000f,   0.324919f,  0.093444f,  -0.150000f,   0.311277f,
-  -0.006708f,  -0.100000f,   0.299925f,  0.093444f,  -0.150000f,   0.311277f,
-   0.086256f,  -0.100000f,   0.287332f, -0.006708f,  -0.100000f,   0.299925f,
-   0.093444f,  -0.150000f,   0.311277f,  0.185017f,  -0.150000f,   0.267196f,
-   0.086256f,  -0.100000f,   0.287332f,  0.185017f,  -0.150000f,   0.267196f,
-   0.170785f,  -0.100000f,   0.246642f,  0.086256f,  -0.100000f,   0.287332f,
-   0.185017f,  -0.150000f,   0.267196f,  0.258499f,  -0.150000f,   0.196986f,
-   0.170785f,  -0.100000f,   0.246642f,  0.258499f,  -0.150000f,   0.196986f,
-   0.238614f,  -0.100000f,   0.181833f,  0.170785f,  -0.100000f,   0.246642f,
-   0.258499f,  -0.150000f,   0.196986f,  0.306702f,  -0.150000f,   0.107513f,
-   0.238614f,  -0.100000f,   0.181833f,  0.306702f,  -0.150000f,   0.107513f,
-   0.283109f,  -0.100000f,   0.099243f,  0.238614f,  -0.100000f,   0.181833f,
-   0.306702f,  -0.150000f,   0.107513f,  0.324913f,  -0.150000f,   0.007527f,
-   0.283109f,  -0.100000f,   0.099243f,  0.324913f,  -0.150000f,   0.007527f,
-   0.299919f,  -0.100000f,   0.006948f,  0.283109f,  -0.100000f,   0.099243f,
-   0.324913f,  -0.150000f,   0.007527f,  0.311351f,  -0.150000f,  -0.093195f,
-   0.299919f,  -0.100000f,   0.006948f,  0.311351f,  -0.150000f,  -0.093195f,
-   0.287401f,  -0.100000f,  -0.086026f,  0.299919f,  -0.100000f,   0.006948f,
-   0.311351f,  -0.150000f,  -0.093195f,  0.267344f,  -0.150000f,  -0.184804f,
-   0.287401f,  -0.100000f,  -0.086026f,  0.267344f,  -0.150000f,  -0.184804f,
-   0.246779f,  -0.100000f,  -0.170588f,  0.287401f,  -0.100000f,  -0.086026f,
-   0.267344f,  -0.150000f,  -0.184804f,  0.197193f,  -0.150000f,  -0.258341f,
-   0.246779f,  -0.100000f,  -0.170588f,  0.197193f,  -0.150000f,  -0.258341f,
-   0.182024f,  -0.100000f,  -0.238468f,  0.246779f,  -0.100000f,  -0.170588f,
-   0.197193f,  -0.150000f,  -0.258341f,  0.107759f,  -0.150000f,  -0.306615f,
-   0.182024f,  -0.100000f,  -0.238468f,  0.107759f,  -0.150000f,  -0.306615f,
-   0.099470f,  -0.100000f,  -0.283030f,  0.182024f,  -0.100000f,  -0.238468f,
-   0.107759f,  -0.150000f,  -0.306615f,  0.007787f,  -0.150000f,  -0.324907f,
-   0.099470f,  -0.100000f,  -0.283030f,  0.007787f,  -0.150000f,  -0.324907f,
-   0.007188f,  -0.100000f,  -0.299914f,  0.099470f,  -0.100000f,  -0.283030f,
-   0.007787f,  -0.150000f,  -0.324907f, -0.092945f,  -0.150000f,  -0.311426f,
-   0.007188f,  -0.100000f,  -0.299914f, -0.092945f,  -0.150000f,  -0.311426f,
-  -0.085796f,  -0.100000f,  -0.287470f,  0.007188f,  -0.100000f,  -0.299914f,
-  -0.092945f,  -0.150000f,  -0.311426f, -0.184589f,  -0.150000f,  -0.267491f,
-  -0.085796f,  -0.100000f,  -0.287470f, -0.184589f,  -0.150000f,  -0.267491f,
-  -0.170390f,  -0.100000f,  -0.246915f, -0.085796f,  -0.100000f,  -0.287470f,
-  -0.184589f,  -0.150000f,  -0.267491f, -0.258183f,  -0.150000f,  -0.197400f,
-  -0.170390f,  -0.100000f,  -0.246915f, -0.258183f,  -0.150000f,  -0.197400f,
-  -0.238323f,  -0.100000f,  -0.182215f, -0.170390f,  -0.100000f,  -0.246915f,
-  -0.258183f,  -0.150000f,  -0.197400f, -0.306529f,  -0.150000f,  -0.108004f,
-  -0.238323f,  -0.100000f,  -0.182215f, -0.306529f,  -0.150000f,  -0.108004f,
-  -0.282950f,  -0.100000f,  -0.099696f, -0.238323f,  -0.100000f,  -0.182215f,
-  -0.306529f,  -0.150000f,  -0.108004f, -0.324900f,  -0.150000f,  -0.008048f,
-  -0.282950f,  -0.100000f,  -0.099696f, -0.324900f,  -0.150000f,  -0.008048f,
-  -0.299908f,  -0.100000f,  -0.007429f, -0.282950f,  -0.100000f,  -0.099696f,
-  -0.324900f,  -0.150000f,  -0.008048f, -0.311500f,  -0.150000f,   0.092696f,
-  -0.299908f,  -0.100000f,  -0.007429f, -0.311500f,  -0.150000f,   0.092696f,
-  -0.287539f,  -0.100000f,   0.085566f, -0.299908f,  -0.100000f,  -0.007429f,
-  -0.311500f,  -0.150000f,   0.092696f, -0.267639f,  -0.150000f,   0.184375f,
-  -0.287539f,  -0.100000f,   0.085566f, -0.267639f,  -0.150000f,   0.184375f,
-  -0.247052f,  -0.100000f,   0.170193f, -0.287539f,  -0.100000f,   0.085566f,
-  -0.267639f,  -0.150000f,   0.184375f, -0.197606f,  -0.150000f,   0.258025f,
-  -0.247052f,  -0.100000f,   0.170193f, -0.197606f,  -0.150000f,   0.258025f,
-  -0.182406f,  -0.100000f,   0.238177f, -0.247052f,  -0.100000f,   0.170193f,
-  -0.197606f,  -0.150000f,   0.258025f, -0.108250f,  -0.150000f,   0.306442f,
-  -0.182406f,  -0.100000f,   0.238177f, -0.108250f,  -0.150000f,   0.306442f,
-  -0.099923f,  -0.100000f,   0.282870f, -0.182406f,  -0.100000f,   0.238177f,
-  -0.108250f,  -0.150000f,   0.306442f, -0.008308f,  -0.150000f,   0.324894f,
-  -0.099923f,  -0.100000f,   0.282870f, -0.008308f,  -0.150000f,   0.324894f,
-  -0.007669f,  -0.100000f,   0.299902f, -0.099923f,  -0.100000f,   0.282870f,
-  -0.007669f,  -0.100000f,   0.299902f,  0.085336f,  -0.100000f,   0.287607f,
-  -0.007030f,  -0.050000f,   0.274910f,  0.085336f,  -0.100000f,   0.287607f,
-   0.078224f,  -0.050000f,   0.263640f, -0.007030f,  -0.050000f,   0.274910f,
-   0.085336f,  -0.100000f,   0.287607f,  0.169995f,  -0.100000f,   0.247188f,
-   0.078224f,  -0.050000f,   0.263640f,  0.169995f,  -0.100000f,   0.247188f,
-   0.155829f,  -0.050000f,   0.226589f,  0.078224f,  -0.050000f,   0.263640f,
-   0.169995f,  -0.100000f,   0.247188f,  0.238031f,  -0.100000f,   0.182596f,
-   0.155829f,  -0.050000f,   0.226589f,  0.238031f,  -0.100000f,   0.182596f,
-   0.218195f,  -0.050000f,   0.167380f,  0.155829f,  -0.050000f,   0.226589f,
-   0.238031f,  -0.100000f,   0.182596f,  0.282790f,  -0.100000f,   0.100149f,
-   0.218195f,  -0.050000f,   0.167380f,  0.282790f,  -0.100000f,   0.100149f,
-   0.259224f,  -0.050000f,   0.091803f,  0.218195f,  -0.050000f,   0.167380f,
-   0.282790f,  -0.100000f,   0.100149f,  0.299896f,  -0.100000f,   0.007909f,
-   0.259224f,  -0.050000f,   0.091803f,  0.299896f,  -0.100000f,   0.007909f,
-   0.274904f,  -0.050000f,   0.007250f,  0.259224f,  -0.050000f,   0.091803f,
-   0.299896f,  -0.100000f,   0.007909f,  0.287675f,  -0.100000f,  -0.085105f,
-   0.274904f,  -0.050000f,   0.007250f,  0.287675f,  -0.100000f,  -0.085105f,
-   0.263702f,  -0.050000f,  -0.078013f,  0.274904f,  -0.050000f,   0.007250f,
-   0.287675f,  -0.100000f,  -0.085105f,  0.247324f,  -0.100000f,  -0.169797f,
-   0.263702f,  -0.050000f,  -0.078013f,  0.247324f,  -0.100000f,  -0.169797f,
-   0.226713f,  -0.050000f,  -0.155647f,  0.263702f,  -0.050000f,  -0.078013f,
-   0.247324f,  -0.100000f,  -0.169797f,  0.182787f,  -0.100000f,  -0.237884f,
-   0.226713f,  -0.050000f,  -0.155647f,  0.182787f,  -0.100000f,  -0.237884f,
-   0.167555f,  -0.050000f,  -0.218061f,  0.226713f,  -0.050000f,  -0.155647f,
-   0.182787f,  -0.100000f,  -0.237884f,  0.100375f,  -0.100000f,  -0.282710f,
-   0.167555f,  -0.050000f,  -0.218061f,  0.100375f,  -0.100000f,  -0.282710f,
-   0.092011f,  -0.050000f,  -0.259150f,  0.167555f,  -0.050000f,  -0.218061f,
-   0.100375f,  -0.100000f,  -0.282710f,  0.008149f,  -0.100000f,  -0.299889f,
-   0.092011f,  -0.050000f,  -0.259150f,  0.008149f,  -0.100000f,  -0.299889f,
-   0.007470f,  -0.050000f,  -0.274898f,  0.092011f,  -0.050000f,  -0.259150f,
-   0.008149f,  -0.100000f,  -0.299889f, -0.084875f,  -0.100000f,  -0.287743f,
-   0.007470f,  -0.050000f,  -0.274898f, -0.084875f,  -0.100000f,  -0.287743f,
-  -0.077802f,  -0.050000f,  -0.263765f,  0.007470f,  -0.050000f,  -0.274898f,
-  -0.084875f,  -0.100000f,  -0.287743f, -0.169599f,  -0.100000f,  -0.247459f,
-  -0.077802f,  -0.050000f,  -0.263765f, -0.169599f,  -0.100000f,  -0.247459f,
-  -0.155466f,  -0.050000f,  -0.226838f, -0.077802f,  -0.050000f,  -0.263765f,
-  -0.169599f,  -0.100000f,  -0.247459f, -0.237738f,  -0.100000f,  -0.182977f,
-  -0.155466f,  -0.050000f,  -0.226838f, -0.237738f,  -0.100000f,  -0.182977f,
-  -0.217926f,  -0.050000f,  -0.167729f, -0.155466f,  -0.050000f,  -0.226838f,
-  -0.237738f,  -0.100000f,  -0.182977f, -0.282629f,  -0.100000f,  -0.100602f,
-  -0.217926f,  -0.050000f,  -0.167729f, -0.282629f,  -0.100000f,  -0.100602f,
-  -0.259077f,  -0.050000f,  -0.092218f, -0.217926f,  -0.050000f,  -0.167729f,
-  -0.282629f,  -0.100000f,  -0.100602f, -0.299883f,  -0.100000f,  -0.008389f,
-  -0.259077f,  -0.050000f,  -0.092218f, -0.299883f,  -0.100000f,  -0.008389f,
-  -0.274892f,  -0.050000f,  -0.007690f, -0.259077f,  -0.050000f,  -0.092218f,
-  -0.299883f,  -0.100000f,  -0.008389f, -0.287811f,  -0.100000f,   0.084645f,
-  -0.274892f,  -0.050000f,  -0.007690f, -0.287811f,  -0.100000f,   0.084645f,
-  -0.263827f,  -0.050000f,   0.077591f, -0.274892f,  -0.050000f,  -0.007690f,
-  -0.287811f,  -0.100000f,   0.084645f, -0.247595f,  -0.100000f,   0.169401f,
-  -0.263827f,  -0.050000f,   0.077591f, -0.247595f,  -0.100000f,   0.169401f,
-  -0.226962f,  -0.050000f,   0.155284f, -0.263827f,  -0.050000f,   0.077591f,
-  -0.247595f,  -0.100000f,   0.169401f, -0.183167f,  -0.100000f,   0.237591f,
-  -0.226962f,  -0.050000f,   0.155284f, -0.183167f,  -0.100000f,   0.237591f,
-  -0.167903f,  -0.050000f,   0.217792f, -0.226962f,  -0.050000f,   0.155284f,
-  -0.183167f,  -0.100000f,   0.237591f, -0.100828f,  -0.100000f,   0.282549f,
-  -0.167903f,  -0.050000f,   0.217792f, -0.100828f,  -0.100000f,   0.282549f,
-  -0.092426f,  -0.050000f,   0.259003f, -0.167903f,  -0.050000f,   0.217792f,
-  -0.100828f,  -0.100000f,   0.282549f, -0.008629f,  -0.100000f,   0.299876f,
-  -0.092426f,  -0.050000f,   0.259003f, -0.008629f,  -0.100000f,   0.299876f,
-  -0.007910f,  -0.050000f,   0.274886f, -0.092426f,  -0.050000f,   0.259003f,
-  -0.007910f,  -0.050000f,   0.274886f,  0.077380f,  -0.050000f,   0.263889f,
-  -0.007191f,   0.000000f,   0.249897f,  0.077380f,  -0.050000f,   0.263889f,
-   0.070345f,   0.000000f,   0.239899f, -0.007191f,   0.000000f,   0.249897f,
-   0.077380f,  -0.050000f,   0.263889f,  0.155102f,  -0.050000f,   0.227086f,
-   0.070345f,   0.000000f,   0.239899f,  0.155102f,  -0.050000f,   0.227086f,
-   0.141002f,   0.000000f,   0.206442f,  0.070345f,   0.000000f,   0.239899f,
-   0.155102f,  -0.050000f,   0.227086f,  0.217658f,  -0.050000f,   0.168078f,
-   0.141002f,   0.000000f,   0.206442f,  0.217658f,  -0.050000f,   0.168078f,
-   0.197871f,   0.000000f,   0.152798f,  0.141002f,   0.000000f,   0.206442f,
-   0.217658f,  -0.050000f,   0.168078f,  0.258929f,  -0.050000f,   0.092633f,
-   0.197871f,   0.000000f,   0.152798f,  0.258929f,  -0.050000f,   0.092633f,
-   0.235390f,   0.000000f,   0.084212f,  0.197871f,   0.000000f,   0.152798f,
-   0.258929f,  -0.050000f,   0.092633f,  0.274880f,  -0.050000f,   0.008130f,
-   0.235390f,   0.000000f,   0.084212f,  0.274880f,  -0.050000f,   0.008130f,
-   0.249891f,   0.000000f,   0.007391f,  0.235390f,   0.000000f,   0.084212f,
-   0.274880f,  -0.050000f,   0.008130f,  0.263951f,  -0.050000f,  -0.077168f,
-   0.249891f,   0.000000f,   0.007391f,  0.263951f,  -0.050000f,  -0.077168f,
-   0.239955f,   0.000000f,  -0.070153f,  0.249891f,   0.000000f,   0.007391f,
-   0.263951f,  -0.050000f,  -0.077168f,  0.227211f,  -0.050000f,  -0.154920f,
-   0.239955f,   0.000000f,  -0.070153f,  0.227211f,  -0.050000f,  -0.154920f,
-   0.206555f,   0.000000f,  -0.140837f,  0.239955f,   0.000000f,  -0.070153f,
-   0.227211f,  -0.050000f,  -0.154920f,  0.168252f,  -0.050000f,  -0.217523f,
-   0.206555f,   0.000000f,  -0.140837f,  0.168252f,  -0.050000f,  -0.217523f,
-   0.152956f,   0.000000f,  -0.197748f,  0.206555f,   0.000000f,  -0.140837f,
-   0.168252f,  -0.050000f,  -0.217523f,  0.092840f,  -0.050000f,  -0.258855f,
-   0.152956f,   0.000000f,  -0.197748f,  0.092840f,  -0.050000f,  -0.258855f,
-   0.084400f,   0.000000f,  -0.235322f,  0.152956f,   0.000000f,  -0.197748f,
-   0.092840f,  -0.050000f,  -0.258855f,  0.008350f,  -0.050000f,  -0.274873f,
-   0.084400f,   0.000000f,  -0.235322f,  0.008350f,  -0.050000f,  -0.274873f,
-   0.007591f,   0.000000f,  -0.249885f,  0.084400f,   0.000000f,  -0.235322f,
-   0.008350f,  -0.050000f,  -0.274873f, -0.076957f,  -0.050000f,  -0.264012f,
-   0.007591f,   0.000000f,  -0.249885f, -0.076957f,  -0.050000f,  -0.264012f,
-  -0.069961f,   0.000000f,  -0.240011f,  0.007591f,   0.000000f,  -0.249885f,
-  -0.076957f,  -0.050000f,  -0.264012f, -0.154739f,  -0.050000f,  -0.227334f,
-  -0.069961f,   0.000000f,  -0.240011f, -0.154739f,  -0.050000f,  -0.227334f,
-  -0.140671f,   0.000000f,  -0.206668f, -0.069961f,   0.000000f,  -0.240011f,
-  -0.154739f,  -0.050000f,  -0.227334f, -0.217388f,  -0.050000f,  -0.168426f,
-  -0.140671f,   0.000000f,  -0.206668f, -0.217388f,  -0.050000f,  -0.168426f,
-  -0.197626f,   0.000000f,  -0.153114f, -0.140671f,   0.000000f,  -0.206668f,
-  -0.217388f,  -0.050000f,  -0.168426f, -0.258780f,  -0.050000f,  -0.093047f,
-  -0.197626f,   0.000000f,  -0.153114f, -0.258780f,  -0.050000f,  -0.093047f,
-  -0.235255f,   0.000000f,  -0.084588f, -0.197626f,   0.000000f,  -0.153114f,
-  -0.258780f,  -0.050000f,  -0.093047f, -0.274866f,  -0.050000f,  -0.008570f,
-  -0.235255f,   0.000000f,  -0.084588f, -0.274866f,  -0.050000f,  -0.008570f,
-  -0.249879f,   0.000000f,  -0.007791f, -0.235255f,   0.000000f,  -0.084588f,
-  -0.274866f,  -0.050000f,  -0.008570f, -0.264074f,  -0.050000f,   0.076746f,
-  -0.249879f,   0.000000f,  -0.007791f, -0.264074f,  -0.050000f,   0.076746f,
-  -0.240067f,   0.000000f,   0.069769f, -0.249879f,   0.000000f,  -0.007791f,
-  -0.264074f,  -0.050000f,   0.076746f, -0.227458f,  -0.050000f,   0.154556f,
-  -0.240067f,   0.000000f,   0.069769f, -0.227458f,  -0.050000f,   0.154556f,
-  -0.206780f,   0.000000f,   0.140506f, -0.240067f,   0.000000f,   0.069769f,
-  -0.227458f,  -0.050000f,   0.154556f, -0.168600f,  -0.050000f,   0.217253f,
-  -0.206780f,   0.000000f,   0.140506f, -0.168600f,  -0.050000f,   0.217253f,
-  -0.153273f,   0.000000f,   0.197503f, -0.206780f,   0.000000f,   0.140506f,
-  -0.168600f,  -0.050000f,   0.217253f, -0.093254f,  -0.050000f,   0.258706f,
-  -0.153273f,   0.000000f,   0.197503f, -0.093254f,  -0.050000f,   0.258706f,
-  -0.084777f,   0.000000f,   0.235187f, -0.153273f,   0.000000f,   0.197503f,
-  -0.093254f,  -0.050000f,   0.258706f, -0.008790f,  -0.050000f,   0.274859f,
-  -0.084777f,   0.000000f,   0.235187f, -0.008790f,  -0.050000f,   0.274859f,
-  -0.007991f,   0.000000f,   0.249872f, -0.084777f,   0.000000f,   0.235187f,
-  -0.007991f,   0.000000f,   0.249872f,  0.069577f,   0.000000f,   0.240123f,
-  -0.007192f,   0.050000f,   0.224885f,  0.069577f,   0.000000f,   0.240123f,
-   0.062619f,   0.050000f,   0.216111f, -0.007192f,   0.050000f,   0.224885f,
-   0.069577f,   0.000000f,   0.240123f,  0.140340f,   0.000000f,   0.206893f,
-   0.062619f,   0.050000f,   0.216111f,  0.140340f,   0.000000f,   0.206893f,
-   0.126306f,   0.050000f,   0.186203f,  0.062619f,   0.050000f,   0.216111f,
-   0.140340f,   0.000000f,   0.206893f,  0.197380f,   0.000000f,   0.153431f,
-   0.126306f,   0.050000f,   0.186203f,  0.197380f,   0.000000f,   0.153431f,
-   0.177642f,   0.050000f,   0.138088f,  0.126306f,   0.050000f,   0.186203f,
-   0.197380f,   0.000000f,   0.153431f,  0.235119f,   0.000000f,   0.084964f,
-   0.177642f,   0.050000f,   0.138088f,  0.235119f,   0.000000f,   0.084964f,
-   0.211607f,   0.050000f,   0.076468f,  0.177642f,   0.050000f,   0.138088f,
-   0.235119f,   0.000000f,   0.084964f,  0.249866f,   0.000000f,   0.008189f,
-   0.211607f,   0.050000f,   0.076468f,  0.249866f,   0.000000f,   0.008189f,
-   0.224879f,   0.050000f,   0.007370f,  0.211607f,   0.050000f,   0.076468f,
-   0.249866f,   0.000000f,   0.008189f,  0.240178f,   0.000000f,  -0.069387f,
-   0.224879f,   0.050000f,   0.007370f,  0.240178f,   0.000000f,  -0.069387f,
-   0.216160f,   0.050000f,  -0.062449f,  0.224879f,   0.050000f,   0.007370f,
-   0.240178f,   0.000000f,  -0.069387f,  0.207003f,   0.000000f,  -0.140178f,
-   0.216160f,   0.050000f,  -0.062449f,  0.207003f,   0.000000f,  -0.140178f,
-   0.186302f,   0.050000f,  -0.126160f,  0.216160f,   0.050000f,  -0.062449f,
-   0.207003f,   0.000000f,  -0.140178f,  0.153585f,   0.000000f,  -0.197260f,
-   0.186302f,   0.050000f,  -0.126160f,  0.153585f,   0.000000f,  -0.197260f,
-   0.138226f,   0.050000f,  -0.177534f,  0.186302f,   0.050000f,  -0.126160f,
-   0.153585f,   0.000000f,  -0.197260f,  0.085148f,   0.000000f,  -0.235053f,
-   0.138226f,   0.050000f,  -0.177534f,  0.085148f,   0.000000f,  -0.235053f,
-   0.076633f,   0.050000f,  -0.211548f,  0.138226f,   0.050000f,  -0.177534f,
-   0.085148f,   0.000000f,  -0.235053f,  0.008384f,   0.000000f,  -0.249859f,
-   0.076633f,   0.050000f,  -0.211548f,  0.008384f,   0.000000f,  -0.249859f,
-   0.007546f,   0.050000f,  -0.224873f,  0.076633f,   0.050000f,  -0.211548f,
-   0.008384f,   0.000000f,  -0.249859f, -0.069200f,   0.000000f,  -0.240232f,
-   0.007546f,   0.050000f,  -0.224873f, -0.069200f,   0.000000f,  -0.240232f,
-  -0.062280f,   0.050000f,  -0.216209f,  0.007546f,   0.050000f,  -0.224873f,
-  -0.069200f,   0.000000f,  -0.240232f, -0.140016f,   0.000000f,  -0.207112f,
-  -0.062280f,   0.050000f,  -0.216209f, -0.140016f,   0.000000f,  -0.207112f,
-  -0.126014f,   0.050000f,  -0.186401f, -0.062280f,   0.050000f,  -0.216209f,
-  -0.140016f,   0.000000f,  -0.207112f, -0.197140f,   0.000000f,  -0.153739f,
-  -0.126014f,   0.050000f,  -0.186401f, -0.197140f,   0.000000f,  -0.153739f,
-  -0.177426f,   0.050000f,  -0.138365f, -0.126014f,   0.050000f,  -0.186401f,
-  -0.197140f,   0.000000f,  -0.153739f, -0.234986f,   0.000000f,  -0.085331f,
-  -0.177426f,   0.050000f,  -0.138365f, -0.234986f,   0.000000f,  -0.085331f,
-  -0.211488f,   0.050000f,  -0.076798f, -0.177426f,   0.050000f,  -0.138365f,
-  -0.234986f,   0.000000f,  -0.085331f, -0.249853f,   0.000000f,  -0.008579f,
-  -0.211488f,   0.050000f,  -0.076798f, -0.249853f,   0.000000f,  -0.008579f,
-  -0.224867f,   0.050000f,  -0.007721f, -0.211488f,   0.050000f,  -0.076798f,
-  -0.249853f,   0.000000f,  -0.008579f, -0.240286f,   0.000000f,   0.069012f,
-  -0.224867f,   0.050000f,  -0.007721f, -0.240286f,   0.000000f,   0.069012f,
-  -0.216257f,   0.050000f,   0.062111f, -0.224867f,   0.050000f,  -0.007721f,
-  -0.240286f,   0.000000f,   0.069012f, -0.207222f,   0.000000f,   0.139854f,
-  -0.216257f,   0.050000f,   0.062111f, -0.207222f,   0.000000f,   0.139854f,
-  -0.186499f,   0.050000f,   0.125869f, -0.216257f,   0.050000f,   0.062111f,
-  -0.207222f,   0.000000f,   0.139854f, -0.153893f,   0.000000f,   0.197020f,
-  -0.186499f,   0.050000f,   0.125869f, -0.153893f,   0.000000f,   0.197020f,
-  -0.138504f,   0.050000f,   0.177318f, -0.186499f,   0.050000f,   0.125869f,
-  -0.153893f,   0.000000f,   0.197020f, -0.085515f,   0.000000f,   0.234919f,
-  -0.138504f,   0.050000f,   0.177318f, -0.085515f,   0.000000f,   0.234919f,
-  -0.076963f,   0.050000f,   0.211428f, -0.138504f,   0.050000f,   0.177318f,
-  -0.085515f,   0.000000f,   0.234919f, -0.008774f,   0.000000f,   0.249846f,
-  -0.076963f,   0.050000f,   0.211428f, -0.008774f,   0.000000f,   0.249846f,
-  -0.007897f,   0.050000f,   0.224861f, -0.076963f,   0.050000f,   0.211428f,
-  -0.007897f,   0.050000f,   0.224861f,  0.061942f,   0.050000f,   0.216306f,
-  -0.007020f,   0.100000f,   0.199877f,  0.061942f,   0.050000f,   0.216306f,
-   0.055059f,   0.100000f,   0.192272f, -0.007020f,   0.100000f,   0.199877f,
-   0.061942f,   0.050000f,   0.216306f,  0.125723f,   0.050000f,   0.186598f,
-   0.055059f,   0.100000f,   0.192272f,  0.125723f,   0.050000f,   0.186598f,
-   0.111754f,   0.100000f,   0.165865f,  0.055059f,   0.100000f,   0.192272f,
-   0.125723f,   0.050000f,   0.186598f,  0.177210f,   0.050000f,   0.138642f,
-   0.111754f,   0.100000f,   0.165865f,  0.177210f,   0.050000f,   0.138642f,
-   0.157520f,   0.100000f,   0.123237f,  0.111754f,   0.100000f,   0.165865f,
-   0.177210f,   0.050000f,   0.138642f,  0.211367f,   0.050000f,   0.077129f,
-   0.157520f,   0.100000f,   0.123237f,  0.211367f,   0.050000f,   0.077129f,
-   0.187882f,   0.100000f,   0.068559f,  0.157520f,   0.100000f,   0.123237f,
-   0.211367f,   0.050000f,   0.077129f,  0.224855f,   0.050000f,   0.008073f,
-   0.187882f,   0.100000f,   0.068559f,  0.224855f,   0.050000f,   0.008073f,
-   0.199871f,   0.100000f,   0.007176f,  0.187882f,   0.100000f,   0.068559f,
-   0.224855f,   0.050000f,   0.008073f,  0.216354f,   0.050000f,  -0.061773f,
-   0.199871f,   0.100000f,   0.007176f,  0.216354f,   0.050000f,  -0.061773f,
-   0.192315f,   0.100000f,  -0.054909f,  0.199871f,   0.100000f,   0.007176f,
-   0.216354f,   0.050000f,  -0.061773f,  0.186696f,   0.050000f,  -0.125577f,
-   0.192315f,   0.100000f,  -0.054909f,  0.186696f,   0.050000f,  -0.125577f,
-   0.165952f,   0.100000f,  -0.111624f,  0.192315f,   0.100000f,  -0.054909f,
-   0.186696f,   0.050000f,  -0.125577f,  0.138781f,   0.050000f,  -0.177101f,
-   0.165952f,   0.100000f,  -0.111624f,  0.138781f,   0.050000f,  -0.177101f,
-   0.123360f,   0.100000f,  -0.157424f,  0.165952f,   0.100000f,  -0.111624f,
-   0.138781f,   0.050000f,  -0.177101f,  0.077294f,   0.050000f,  -0.211307f,
-   0.123360f,   0.100000f,  -0.157424f,  0.077294f,   0.050000f,  -0.211307f,
-   0.068706f,   0.100000f,  -0.187828f,  0.123360f,   0.100000f,  -0.157424f,
-   0.077294f,   0.050000f,  -0.211307f,  0.008248f,   0.050000f,  -0.224849f,
-   0.068706f,   0.100000f,  -0.187828f,  0.008248f,   0.050000f,  -0.224849f,
-   0.007332f,   0.100000f,  -0.199865f,  0.068706f,   0.100000f,  -0.187828f,
-   0.008248f,   0.050000f,  -0.224849f, -0.061604f,   0.050000f,  -0.216402f,
-   0.007332f,   0.100000f,  -0.199865f, -0.061604f,   0.050000f,  -0.216402f,
-  -0.054759f,   0.100000f,  -0.192358f,  0.007332f,   0.100000f,  -0.199865f,
-  -0.061604f,   0.050000f,  -0.216402f, -0.125431f,   0.050000f,  -0.186794f,
-  -0.054759f,   0.100000f,  -0.192358f, -0.125431f,   0.050000f,  -0.186794f,
-  -0.111494f,   0.100000f,  -0.166039f, -0.054759f,   0.100000f,  -0.192358f,
-  -0.125431f,   0.050000f,  -0.186794f, -0.176993f,   0.050000f,  -0.138919f,
-  -0.111494f,   0.100000f,  -0.166039f, -0.176993f,   0.050000f,  -0.138919f,
-  -0.157327f,   0.100000f,  -0.123483f, -0.111494f,   0.100000f,  -0.166039f,
-  -0.176993f,   0.050000f,  -0.138919f, -0.211247f,   0.050000f,  -0.077459f,
-  -0.157327f,   0.100000f,  -0.123483f, -0.211247f,   0.050000f,  -0.077459f,
-  -0.187775f,   0.100000f,  -0.068852f, -0.157327f,   0.100000f,  -0.123483f,
-  -0.211247f,   0.050000f,  -0.077459f, -0.224842f,   0.050000f,  -0.008424f,
-  -0.187775f,   0.100000f,  -0.068852f, -0.224842f,   0.050000f,  -0.008424f,
-  -0.199860f,   0.100000f,  -0.007488f, -0.187775f,   0.100000f,  -0.068852f,
-  -0.224842f,   0.050000f,  -0.008424f, -0.216450f,   0.050000f,   0.061434f,
-  -0.199860f,   0.100000f,  -0.007488f, -0.216450f,   0.050000f,   0.061434f,
-  -0.192400f,   0.100000f,   0.054608f, -0.199860f,   0.100000f,  -0.007488f,
-  -0.216450f,   0.050000f,   0.061434f, -0.186892f,   0.050000f,   0.125285f,
-  -0.192400f,   0.100000f,   0.054608f, -0.186892f,   0.050000f,   0.125285f,
-  -0.166126f,   0.100000f,   0.111365f, -0.192400f,   0.100000f,   0.054608f,
-  -0.186892f,   0.050000f,   0.125285f, -0.139057f,   0.050000f,   0.176884f,
-  -0.166126f,   0.100000f,   0.111365f, -0.139057f,   0.050000f,   0.176884f,
-  -0.123606f,   0.100000f,   0.157231f, -0.166126f,   0.100000f,   0.111365f,
-  -0.139057f,   0.050000f,   0.176884f, -0.077624f,   0.050000f,   0.211186f,
-  -0.123606f,   0.100000f,   0.157231f, -0.077624f,   0.050000f,   0.211186f,
-  -0.068999f,   0.100000f,   0.187721f, -0.123606f,   0.100000f,   0.157231f,
-  -0.077624f,   0.050000f,   0.211186f, -0.008600f,   0.050000f,   0.224836f,
-  -0.068999f,   0.100000f,   0.187721f, -0.008600f,   0.050000f,   0.224836f,
-  -0.007644f,   0.100000f,   0.199854f, -0.068999f,   0.100000f,   0.187721f,
-  -0.007644f,   0.100000f,   0.199854f,  0.054458f,   0.100000f,   0.192443f,
-  -0.006689f,   0.150000f,   0.174872f,  0.054458f,   0.100000f,   0.192443f,
-   0.047651f,   0.150000f,   0.168388f, -0.006689f,   0.150000f,   0.174872f,
-   0.054458f,   0.100000f,   0.192443f,  0.111235f,   0.100000f,   0.166213f,
-   0.047651f,   0.150000f,   0.168388f,  0.111235f,   0.100000f,   0.166213f,
-   0.097330f,   0.150000f,   0.145436f,  0.047651f,   0.150000f,   0.168388f,
-   0.111235f,   0.100000f,   0.166213f,  0.157134f,   0.100000f,   0.123729f,
-   0.097330f,   0.150000f,   0.145436f,  0.157134f,   0.100000f,   0.123729f,
-   0.137492f,   0.150000f,   0.108263f,  0.097330f,   0.150000f,   0.145436f,
-   0.157134f,   0.100000f,   0.123729f,  0.187667f,   0.100000f,   0.069146f,
-   0.137492f,   0.150000f,   0.108263f,  0.187667f,   0.100000f,   0.069146f,
-   0.164208f,   0.150000f,   0.060502f,  0.137492f,   0.150000f,   0.108263f,
-   0.187667f,   0.100000f,   0.069146f,  0.199848f,   0.100000f,   0.007800f,
-   0.164208f,   0.150000f,   0.060502f,  0.199848f,   0.100000f,   0.007800f,
-   0.174867f,   0.150000f,   0.006825f,  0.164208f,   0.150000f,   0.060502f,
-   0.199848f,   0.100000f,   0.007800f,  0.192485f,   0.100000f,  -0.054308f,
-   0.174867f,   0.150000f,   0.006825f,  0.192485f,   0.100000f,  -0.054308f,
-   0.168425f,   0.150000f,  -0.047519f,  0.174867f,   0.150000f,   0.006825f,
-   0.192485f,   0.100000f,  -0.054308f,  0.166300f,   0.100000f,  -0.111105f,
-   0.168425f,   0.150000f,  -0.047519f,  0.166300f,   0.100000f,  -0.111105f,
-   0.145512f,   0.150000f,  -0.097217f,  0.168425f,   0.150000f,  -0.047519f,
-   0.166300f,   0.100000f,  -0.111105f,  0.123852f,   0.100000f,  -0.157037f,
-   0.145512f,   0.150000f,  -0.097217f,  0.123852f,   0.100000f,  -0.157037f,
-   0.108370f,   0.150000f,  -0.137408f,  0.145512f,   0.150000f,  -0.097217f,
-   0.123852f,   0.100000f,  -0.157037f,  0.069292f,   0.100000f,  -0.187613f,
-   0.108370f,   0.150000f,  -0.137408f,  0.069292f,   0.100000f,  -0.187613f,
-   0.060631f,   0.150000f,  -0.164161f,  0.108370f,   0.150000f,  -0.137408f,
-   0.069292f,   0.100000f,  -0.187613f,  0.007957f,   0.100000f,  -0.199842f,
-   0.060631f,   0.150000f,  -0.164161f,  0.007957f,   0.100000f,  -0.199842f,
-   0.006962f,   0.150000f,  -0.174861f,  0.060631f,   0.150000f,  -0.164161f,
-   0.007957f,   0.100000f,  -0.199842f, -0.054157f,   0.100000f,  -0.192528f,
-   0.006962f,   0.150000f,  -0.174861f, -0.054157f,   0.100000f,  -0.192528f,
-  -0.047388f,   0.150000f,  -0.168462f,  0.006962f,   0.150000f,  -0.174861f,
-  -0.054157f,   0.100000f,  -0.192528f, -0.110975f,   0.100000f,  -0.166387f,
-  -0.047388f,   0.150000f,  -0.168462f, -0.110975f,   0.100000f,  -0.166387f,
-  -0.097103f,   0.150000f,  -0.145588f, -0.047388f,   0.150000f,  -0.168462f,
-  -0.110975f,   0.100000f,  -0.166387f, -0.156940f,   0.100000f,  -0.123975f,
-  -0.097103f,   0.150000f,  -0.145588f, -0.156940f,   0.100000f,  -0.123975f,
-  -0.137323f,   0.150000f,  -0.108478f, -0.097103f,   0.150000f,  -0.145588f,
-  -0.156940f,   0.100000f,  -0.123975f, -0.187559f,   0.100000f,  -0.069439f,
-  -0.137323f,   0.150000f,  -0.108478f, -0.187559f,   0.100000f,  -0.069439f,
-  -0.164114f,   0.150000f,  -0.060759f, -0.137323f,   0.150000f,  -0.108478f,
-  -0.187559f,   0.100000f,  -0.069439f, -0.199835f,   0.100000f,  -0.008113f,
-  -0.164114f,   0.150000f,  -0.060759f, -0.199835f,   0.100000f,  -0.008113f,
-  -0.174856f,   0.150000f,  -0.007099f, -0.164114f,   0.150000f,  -0.060759f,
-  -0.199835f,   0.100000f,  -0.008113f, -0.192570f,   0.100000f,   0.054007f,
-  -0.174856f,   0.150000f,  -0.007099f, -0.192570f,   0.100000f,   0.054007f,
-  -0.168499f,   0.150000f,   0.047256f, -0.174856f,   0.150000f,  -0.007099f,
-  -0.192570f,   0.100000f,   0.054007f, -0.166473f,   0.100000f,   0.110845f,
-  -0.168499f,   0.150000f,   0.047256f, -0.166473f,   0.100000f,   0.110845f,
-  -0.145664f,   0.150000f,   0.096989f, -0.168499f,   0.150000f,   0.047256f,
-  -0.166473f,   0.100000f,   0.110845f, -0.124097f,   0.100000f,   0.156843f,
-  -0.145664f,   0.150000f,   0.096989f, -0.124097f,   0.100000f,   0.156843f,
-  -0.108585f,   0.150000f,   0.137238f, -0.145664f,   0.150000f,   0.096989f,
-  -0.124097f,   0.100000f,   0.156843f, -0.069585f,   0.100000f,   0.187504f,
-  -0.108585f,   0.150000f,   0.137238f, -0.069585f,   0.100000f,   0.187504f,
-  -0.060887f,   0.150000f,   0.164066f, -0.108585f,   0.150000f,   0.137238f,
-  -0.069585f,   0.100000f,   0.187504f, -0.008269f,   0.100000f,   0.199829f,
-  -0.060887f,   0.150000f,   0.164066f, -0.008269f,   0.100000f,   0.199829f,
-  -0.007235f,   0.150000f,   0.174850f, -0.060887f,   0.150000f,   0.164066f,
-  -0.007235f,   0.150000f,   0.174850f,  0.047124f,   0.150000f,   0.168536f,
-  -0.006202f,   0.200000f,   0.149872f,  0.047124f,   0.150000f,   0.168536f,
-   0.040392f,   0.200000f,   0.144459f, -0.006202f,   0.200000f,   0.149872f,
-   0.047124f,   0.150000f,   0.168536f,  0.096875f,   0.150000f,   0.145740f,
-   0.040392f,   0.200000f,   0.144459f,  0.096875f,   0.150000f,   0.145740f,
-   0.083036f,   0.200000f,   0.124920f,  0.040392f,   0.200000f,   0.144459f,
-   0.096875f,   0.150000f,   0.145740f,  0.137153f,   0.150000f,   0.108692f,
-   0.083036f,   0.200000f,   0.124920f,  0.137153f,   0.150000f,   0.108692f,
-   0.117560f,   0.200000f,   0.093165f,  0.083036f,   0.200000f,   0.124920f,
-   0.137153f,   0.150000f,   0.108692f,  0.164019f,   0.150000f,   0.061015f,
-   0.117560f,   0.200000f,   0.093165f,  0.164019f,   0.150000f,   0.061015f,
-   0.140587f,   0.200000f,   0.052299f,  0.117560f,   0.200000f,   0.093165f,
-   0.164019f,   0.150000f,   0.061015f,  0.174845f,   0.150000f,   0.007372f,
-   0.140587f,   0.200000f,   0.052299f,  0.174845f,   0.150000f,   0.007372f,
-   0.149867f,   0.200000f,   0.006319f,  0.140587f,   0.200000f,   0.052299f,
-   0.174845f,   0.150000f,   0.007372f,  0.168572f,   0.150000f,  -0.046993f,
-   0.149867f,   0.200000f,   0.006319f,  0.168572f,   0.150000f,  -0.046993f,
-   0.144491f,   0.200000f,  -0.040279f,  0.149867f,   0.200000f,   0.006319f,
-   0.168572f,   0.150000f,  -0.046993f,  0.145816f,   0.150000f,  -0.096762f,
-   0.144491f,   0.200000f,  -0.040279f,  0.145816f,   0.150000f,  -0.096762f,
-   0.124985f,   0.200000f,  -0.082938f,  0.144491f,   0.200000f,  -0.040279f,
-   0.145816f,   0.150000f,  -0.096762f,  0.108799f,   0.150000f,  -0.137068f,
-   0.124985f,   0.200000f,  -0.082938f,  0.108799f,   0.150000f,  -0.137068f,
-   0.093257f,   0.200000f,  -0.117487f,  0.124985f,   0.200000f,  -0.082938f,
-   0.108799f,   0.150000f,  -0.137068f,  0.061144f,   0.150000f,  -0.163971f,
-   0.093257f,   0.200000f,  -0.117487f,  0.061144f,   0.150000f,  -0.163971f,
-   0.052409f,   0.200000f,  -0.140546f,  0.093257f,   0.200000f,  -0.117487f,
-   0.061144f,   0.150000f,  -0.163971f,  0.007509f,   0.150000f,  -0.174839f,
-   0.052409f,   0.200000f,  -0.140546f,  0.007509f,   0.150000f,  -0.174839f,
-   0.006436f,   0.200000f,  -0.149862f,  0.052409f,   0.200000f,  -0.140546f,
-   0.007509f,   0.150000f,  -0.174839f, -0.046861f,   0.150000f,  -0.168609f,
-   0.006436f,   0.200000f,  -0.149862f, -0.046861f,   0.150000f,  -0.168609f,
-  -0.040166f,   0.200000f,  -0.144522f,  0.006436f,   0.200000f,  -0.149862f,
-  -0.046861f,   0.150000f,  -0.168609f, -0.096648f,   0.150000f,  -0.145891f,
-  -0.040166f,   0.200000f,  -0.144522f, -0.096648f,   0.150000f,  -0.145891f,
-  -0.082841f,   0.200000f,  -0.125050f, -0.040166f,   0.200000f,  -0.144522f,
-  -0.096648f,   0.150000f,  -0.145891f, -0.136983f,   0.150000f,  -0.108906f,
-  -0.082841f,   0.200000f,  -0.125050f, -0.136983f,   0.150000f,  -0.108906f,
-  -0.117414f,   0.200000f,  -0.093348f, -0.082841f,   0.200000f,  -0.125050f,
-  -0.136983f,   0.150000f,  -0.108906f, -0.163923f,   0.150000f,  -0.061272f,
-  -0.117414f,   0.200000f,  -0.093348f, -0.163923f,   0.150000f,  -0.061272f,
-  -0.140505f,   0.200000f,  -0.052519f, -0.117414f,   0.200000f,  -0.093348f,
-  -0.163923f,   0.150000f,  -0.061272f, -0.174833f,   0.150000f,  -0.007645f,
-  -0.140505f,   0.200000f,  -0.052519f, -0.174833f,   0.150000f,  -0.007645f,
-  -0.149857f,   0.200000f,  -0.006553f, -0.140505f,   0.200000f,  -0.052519f,
-  -0.174833f,   0.150000f,  -0.007645f, -0.168646f,   0.150000f,   0.046729f,
-  -0.149857f,   0.200000f,  -0.006553f, -0.168646f,   0.150000f,   0.046729f,
-  -0.144553f,   0.200000f,   0.040053f, -0.149857f,   0.200000f,  -0.006553f,
-  -0.168646f,   0.150000f,   0.046729f, -0.145967f,   0.150000f,   0.096534f,
-  -0.144553f,   0.200000f,   0.040053f, -0.145967f,   0.150000f,   0.096534f,
-  -0.125114f,   0.200000f,   0.082743f, -0.144553f,   0.200000f,   0.040053f,
-  -0.145967f,   0.150000f,   0.096534f, -0.109013f,   0.150000f,   0.136898f,
-  -0.125114f,   0.200000f,   0.082743f, -0.109013f,   0.150000f,   0.136898f,
-  -0.093440f,   0.200000f,   0.117341f, -0.125114f,   0.200000f,   0.082743f,
-  -0.109013f,   0.150000f,   0.136898f, -0.061400f,   0.150000f,   0.163875f,
-  -0.093440f,   0.200000f,   0.117341f, -0.061400f,   0.150000f,   0.163875f,
-  -0.052628f,   0.200000f,   0.140464f, -0.093440f,   0.200000f,   0.117341f,
-  -0.061400f,   0.150000f,   0.163875f, -0.007782f,   0.150000f,   0.174827f,
-  -0.052628f,   0.200000f,   0.140464f, -0.007782f,   0.150000f,   0.174827f,
-  -0.006670f,   0.200000f,   0.149852f, -0.052628f,   0.200000f,   0.140464f,
-  -0.006670f,   0.200000f,   0.149852f,  0.039940f,   0.200000f,   0.144585f,
-  -0.005558f,   0.250000f,   0.124876f,  0.039940f,   0.200000f,   0.144585f,
-   0.033284f,   0.250000f,   0.120487f, -0.005558f,   0.250000f,   0.124876f,
-   0.039940f,   0.200000f,   0.144585f,  0.082645f,   0.200000f,   0.125179f,
-   0.033284f,   0.250000f,   0.120487f,  0.082645f,   0.200000f,   0.125179f,
-   0.068871f,   0.250000f,   0.104316f,  0.033284f,   0.250000f,   0.120487f,
-   0.082645f,   0.200000f,   0.125179f,  0.117268f,   0.200000f,   0.093532f,
-   0.068871f,   0.250000f,   0.104316f,  0.117268f,   0.200000f,   0.093532f,
-   0.097723f,   0.250000f,   0.077943f,  0.068871f,   0.250000f,   0.104316f,
-   0.117268f,   0.200000f,   0.093532f,  0.140423f,   0.200000f,   0.052738f,
-   0.097723f,   0.250000f,   0.077943f,  0.140423f,   0.200000f,   0.052738f,
-   0.117019f,   0.250000f,   0.043948f,  0.097723f,   0.250000f,   0.077943f,
-   0.140423f,   0.200000f,   0.052738f,  0.149846f,   0.200000f,   0.006787f,
-   0.117019f,   0.250000f,   0.043948f,  0.149846f,   0.200000f,   0.006787f,
-   0.124872f,   0.250000f,   0.005656f,  0.117019f,   0.250000f,   0.043948f,
-   0.149846f,   0.200000f,   0.006787f,  0.144616f,   0.200000f,  -0.039827f,
-   0.124872f,   0.250000f,   0.005656f,  0.144616f,   0.200000f,  -0.039827f,
-   0.120513f,   0.250000f,  -0.033190f,  0.124872f,   0.250000f,   0.005656f,
-   0.144616f,   0.200000f,  -0.039827f,  0.125243f,   0.200000f,  -0.082547f,
-   0.120513f,   0.250000f,  -0.033190f,  0.125243f,   0.200000f,  -0.082547f,
-   0.104369f,   0.250000f,  -0.068789f,  0.120513f,   0.250000f,  -0.033190f,
-   0.125243f,   0.200000f,  -0.082547f,  0.093623f,   0.200000f,  -0.117195f,
-   0.104369f,   0.250000f,  -0.068789f,  0.093623f,   0.200000f,  -0.117195f,
-   0.078019f,   0.250000f,  -0.097662f,  0.104369f,   0.250000f,  -0.068789f,
-   0.093623f,   0.200000f,  -0.117195f,  0.052848f,   0.200000f,  -0.140382f,
-   0.078019f,   0.250000f,  -0.097662f,  0.052848f,   0.200000f,  -0.140382f,
-   0.044040f,   0.250000f,  -0.116985f,  0.078019f,   0.250000f,  -0.097662f,
-   0.052848f,   0.200000f,  -0.140382f,  0.006904f,   0.200000f,  -0.149841f,
-   0.044040f,   0.250000f,  -0.116985f,  0.006904f,   0.200000f,  -0.149841f,
-   0.005754f,   0.250000f,  -0.124867f,  0.044040f,   0.250000f,  -0.116985f,
-   0.006904f,   0.200000f,  -0.149841f, -0.039714f,   0.200000f,  -0.144647f,
-   0.005754f,   0.250000f,  -0.124867f, -0.039714f,   0.200000f,  -0.144647f,
-  -0.033095f,   0.250000f,  -0.120539f,  0.005754f,   0.250000f,  -0.124867f,
-  -0.039714f,   0.200000f,  -0.144647f, -0.082450f,   0.200000f,  -0.125308f,
-  -0.033095f,   0.250000f,  -0.120539f, -0.082450f,   0.200000f,  -0.125308f,
-  -0.068708f,   0.250000f,  -0.104423f, -0.033095f,   0.250000f,  -0.120539f,
-  -0.082450f,   0.200000f,  -0.125308f, -0.117122f,   0.200000f,  -0.093715f,
-  -0.068708f,   0.250000f,  -0.104423f, -0.117122f,   0.200000f,  -0.093715f,
-  -0.097601f,   0.250000f,  -0.078096f, -0.068708f,   0.250000f,  -0.104423f,
-  -0.117122f,   0.200000f,  -0.093715f, -0.140341f,   0.200000f,  -0.052957f,
-  -0.097601f,   0.250000f,  -0.078096f, -0.140341f,   0.200000f,  -0.052957f,
-  -0.116950f,   0.250000f,  -0.044131f, -0.097601f,   0.250000f,  -0.078096f,
-  -0.140341f,   0.200000f,  -0.052957f, -0.149835f,   0.200000f,  -0.007021f,
-  -0.116950f,   0.250000f,  -0.044131f, -0.149835f,   0.200000f,  -0.007021f,
-  -0.124863f,   0.250000f,  -0.005851f, -0.116950f,   0.250000f,  -0.044131f,
-  -0.149835f,   0.200000f,  -0.007021f, -0.144678f,   0.200000f,   0.039601f,
-  -0.124863f,   0.250000f,  -0.005851f, -0.144678f,   0.200000f,   0.039601f,
-  -0.120565f,   0.250000f,   0.033001f, -0.124863f,   0.250000f,  -0.005851f,
-  -0.144678f,   0.200000f,   0.039601f, -0.125372f,   0.200000f,   0.082352f,
-  -0.120565f,   0.250000f,   0.033001f, -0.125372f,   0.200000f,   0.082352f,
-  -0.104477f,   0.250000f,   0.068626f, -0.120565f,   0.250000f,   0.033001f,
-  -0.125372f,   0.200000f,   0.082352f, -0.093806f,   0.200000f,   0.117048f,
-  -0.104477f,   0.250000f,   0.068626f, -0.093806f,   0.200000f,   0.117048f,
-  -0.078172f,   0.250000f,   0.097540f, -0.104477f,   0.250000f,   0.068626f,
-  -0.093806f,   0.200000f,   0.117048f, -0.053067f,   0.200000f,   0.140299f,
-  -0.078172f,   0.250000f,   0.097540f, -0.053067f,   0.200000f,   0.140299f,
-  -0.044223f,   0.250000f,   0.116916f, -0.078172f,   0.250000f,   0.097540f,
-  -0.053067f,   0.200000f,   0.140299f, -0.007138f,   0.200000f,   0.149830f,
-  -0.044223f,   0.250000f,   0.116916f, -0.007138f,   0.200000f,   0.149830f,
-  -0.005949f,   0.250000f,   0.124858f, -0.044223f,   0.250000f,   0.116916f,
-  -0.005949f,   0.250000f,   0.124858f,  0.032907f,   0.250000f,   0.120591f,
-  -0.004759f,   0.300000f,   0.099887f,  0.032907f,   0.250000f,   0.120591f,
-   0.026326f,   0.300000f,   0.096473f, -0.004759f,   0.300000f,   0.099887f,
-   0.032907f,   0.250000f,   0.120591f,  0.068545f,   0.250000f,   0.104530f,
-   0.026326f,   0.300000f,   0.096473f,  0.068545f,   0.250000f,   0.104530f,
-   0.054836f,   0.300000f,   0.083624f,  0.026326f,   0.300000f,   0.096473f,
-   0.068545f,   0.250000f,   0.104530f,  0.097479f,   0.250000f,   0.078248f,
-   0.054836f,   0.300000f,   0.083624f,  0.097479f,   0.250000f,   0.078248f,
-   0.077983f,   0.300000f,   0.062598f,  0.054836f,   0.300000f,   0.083624f,
-   0.097479f,   0.250000f,   0.078248f,  0.116881f,   0.250000f,   0.044314f,
-   0.077983f,   0.300000f,   0.062598f,  0.116881f,   0.250000f,   0.044314f,
-   0.093505f,   0.300000f,   0.035451f,  0.077983f,   0.300000f,   0.062598f,
-   0.116881f,   0.250000f,   0.044314f,  0.124854f,   0.250000f,   0.006046f,
-   0.093505f,   0.300000f,   0.035451f,  0.124854f,   0.250000f,   0.006046f,
-   0.099883f,   0.300000f,   0.004837f,  0.093505f,   0.300000f,   0.035451f,
-   0.124854f,   0.250000f,   0.006046f,  0.120616f,   0.250000f,  -0.032813f,
-   0.099883f,   0.300000f,   0.004837f,  0.120616f,   0.250000f,  -0.032813f,
-   0.096493f,   0.300000f,  -0.026250f,  0.099883f,   0.300000f,   0.004837f,
-   0.120616f,   0.250000f,  -0.032813f,  0.104584f,   0.250000f,  -0.068463f,
-   0.096493f,   0.300000f,  -0.026250f,  0.104584f,   0.250000f,  -0.068463f,
-   0.083667f,   0.300000f,  -0.054770f,  0.096493f,   0.300000f,  -0.026250f,
-   0.104584f,   0.250000f,  -0.068463f,  0.078324f,   0.250000f,  -0.097418f,
-   0.083667f,   0.300000f,  -0.054770f,  0.078324f,   0.250000f,  -0.097418f,
-   0.062659f,   0.300000f,  -0.077934f,  0.083667f,   0.300000f,  -0.054770f,
-   0.078324f,   0.250000f,  -0.097418f,  0.044405f,   0.250000f,  -0.116847f,
-   0.062659f,   0.300000f,  -0.077934f,  0.044405f,   0.250000f,  -0.116847f,
-   0.035524f,   0.300000f,  -0.093477f,  0.062659f,   0.300000f,  -0.077934f,
-   0.044405f,   0.250000f,  -0.116847f,  0.006144f,   0.250000f,  -0.124849f,
-   0.035524f,   0.300000f,  -0.093477f,  0.006144f,   0.250000f,  -0.124849f,
-   0.004915f,   0.300000f,  -0.099879f,  0.035524f,   0.300000f,  -0.093477f,
-   0.006144f,   0.250000f,  -0.124849f, -0.032718f,   0.250000f,  -0.120642f,
-   0.004915f,   0.300000f,  -0.099879f, -0.032718f,   0.250000f,  -0.120642f,
-  -0.026175f,   0.300000f,  -0.096514f,  0.004915f,   0.300000f,  -0.099879f,
-  -0.032718f,   0.250000f,  -0.120642f, -0.068381f,   0.250000f,  -0.104637f,
-  -0.026175f,   0.300000f,  -0.096514f, -0.068381f,   0.250000f,  -0.104637f,
-  -0.054705f,   0.300000f,  -0.083710f, -0.026175f,   0.300000f,  -0.096514f,
-  -0.068381f,   0.250000f,  -0.104637f, -0.097357f,   0.250000f,  -0.078400f,
-  -0.054705f,   0.300000f,  -0.083710f, -0.097357f,   0.250000f,  -0.078400f,
-  -0.077885f,   0.300000f,  -0.062720f, -0.054705f,   0.300000f,  -0.083710f,
-  -0.097357f,   0.250000f,  -0.078400f, -0.116812f,   0.250000f,  -0.044497f,
-  -0.077885f,   0.300000f,  -0.062720f, -0.116812f,   0.250000f,  -0.044497f,
-  -0.093450f,   0.300000f,  -0.035597f, -0.077885f,   0.300000f,  -0.062720f,
-  -0.116812f,   0.250000f,  -0.044497f, -0.124844f,   0.250000f,  -0.006241f,
-  -0.093450f,   0.300000f,  -0.035597f, -0.124844f,   0.250000f,  -0.006241f,
-  -0.099875f,   0.300000f,  -0.004993f, -0.093450f,   0.300000f,  -0.035597f,
-  -0.124844f,   0.250000f,  -0.006241f, -0.120667f,   0.250000f,   0.032624f,
-  -0.099875f,   0.300000f,  -0.004993f, -0.120667f,   0.250000f,   0.032624f,
-  -0.096534f,   0.300000f,   0.026099f, -0.099875f,   0.300000f,  -0.004993f,
-  -0.120667f,   0.250000f,   0.032624f, -0.104691f,   0.250000f,   0.068299f,
-  -0.096534f,   0.300000f,   0.026099f, -0.104691f,   0.250000f,   0.068299f,
-  -0.083753f,   0.300000f,   0.054640f, -0.096534f,   0.300000f,   0.026099f,
-  -0.104691f,   0.250000f,   0.068299f, -0.078476f,   0.250000f,   0.097296f,
-  -0.083753f,   0.300000f,   0.054640f, -0.078476f,   0.250000f,   0.097296f,
-  -0.062781f,   0.300000f,   0.077836f, -0.083753f,   0.300000f,   0.054640f,
-  -0.078476f,   0.250000f,   0.097296f, -0.044588f,   0.250000f,   0.116777f,
-  -0.062781f,   0.300000f,   0.077836f, -0.044588f,   0.250000f,   0.116777f,
-  -0.035670f,   0.300000f,   0.093422f, -0.062781f,   0.300000f,   0.077836f,
-  -0.044588f,   0.250000f,   0.116777f, -0.006339f,   0.250000f,   0.124839f,
-  -0.035670f,   0.300000f,   0.093422f, -0.006339f,   0.250000f,   0.124839f,
-  -0.005071f,   0.300000f,   0.099871f, -0.035670f,   0.300000f,   0.093422f,
-  -0.005071f,   0.300000f,   0.099871f,  0.026024f,   0.300000f,   0.096554f,
-  -0.003803f,   0.350000f,   0.074903f,  0.026024f,   0.300000f,   0.096554f,
-   0.019518f,   0.350000f,   0.072416f, -0.003803f,   0.350000f,   0.074903f,
-   0.026024f,   0.300000f,   0.096554f,  0.054574f,   0.300000f,   0.083795f,
-   0.019518f,   0.350000f,   0.072416f,  0.054574f,   0.300000f,   0.083795f,
-   0.040931f,   0.350000f,   0.062846f,  0.019518f,   0.350000f,   0.072416f,
-   0.054574f,   0.300000f,   0.083795f,  0.077787f,   0.300000f,   0.062842f,
-   0.040931f,   0.350000f,   0.062846f,  0.077787f,   0.300000f,   0.062842f,
-   0.058341f,   0.350000f,   0.047131f,  0.040931f,   0.350000f,   0.062846f,
-   0.077787f,   0.300000f,   0.062842f,  0.093394f,   0.300000f,   0.035743f,
-   0.058341f,   0.350000f,   0.047131f,  0.093394f,   0.300000f,   0.035743f,
-   0.070045f,   0.350000f,   0.026807f,  0.058341f,   0.350000f,   0.047131f,
-   0.093394f,   0.300000f,   0.035743f,  0.099867f,   0.300000f,   0.005149f,
-   0.070045f,   0.350000f,   0.026807f,  0.099867f,   0.300000f,   0.005149f,
-   0.074900f,   0.350000f,   0.003862f,  0.070045f,   0.350000f,   0.026807f,
-   0.099867f,   0.300000f,   0.005149f,  0.096575f,   0.300000f,  -0.025948f,
-   0.074900f,   0.350000f,   0.003862f,  0.096575f,   0.300000f,  -0.025948f,
-   0.072431f,   0.350000f,  -0.019461f,  0.074900f,   0.350000f,   0.003862f,
-   0.096575f,   0.300000f,  -0.025948f,  0.083838f,   0.300000f,  -0.054509f,
-   0.072431f,   0.350000f,  -0.019461f,  0.083838f,   0.300000f,  -0.054509f,
-   0.062878f,   0.350000f,  -0.040881f,  0.072431f,   0.350000f,  -0.019461f,
-   0.083838f,   0.300000f,  -0.054509f,  0.062903f,   0.300000f,  -0.077738f,
-   0.062878f,   0.350000f,  -0.040881f,  0.062903f,   0.300000f,  -0.077738f,
-   0.047177f,   0.350000f,  -0.058304f,  0.062878f,   0.350000f,  -0.040881f,
-   0.062903f,   0.300000f,  -0.077738f,  0.035816f,   0.300000f,  -0.093366f,
-   0.047177f,   0.350000f,  -0.058304f,  0.035816f,   0.300000f,  -0.093366f,
-   0.026862f,   0.350000f,  -0.070024f,  0.047177f,   0.350000f,  -0.058304f,
-   0.035816f,   0.300000f,  -0.093366f,  0.005227f,   0.300000f,  -0.099863f,
-   0.026862f,   0.350000f,  -0.070024f,  0.005227f,   0.300000f,  -0.099863f,
-   0.003920f,   0.350000f,  -0.074897f,  0.026862f,   0.350000f,  -0.070024f,
-   0.005227f,   0.300000f,  -0.099863f, -0.025873f,   0.300000f,  -0.096595f,
-   0.003920f,   0.350000f,  -0.074897f, -0.025873f,   0.300000f,  -0.096595f,
-  -0.019405f,   0.350000f,  -0.072446f,  0.003920f,   0.350000f,  -0.074897f,
-  -0.025873f,   0.300000f,  -0.096595f, -0.054443f,   0.300000f,  -0.083880f,
-  -0.019405f,   0.350000f,  -0.072446f, -0.054443f,   0.300000f,  -0.083880f,
-  -0.040832f,   0.350000f,  -0.062910f, -0.019405f,   0.350000f,  -0.072446f,
-  -0.054443f,   0.300000f,  -0.083880f, -0.077689f,   0.300000f,  -0.062963f,
-  -0.040832f,   0.350000f,  -0.062910f, -0.077689f,   0.300000f,  -0.062963f,
-  -0.058267f,   0.350000f,  -0.047223f, -0.040832f,   0.350000f,  -0.062910f,
-  -0.077689f,   0.300000f,  -0.062963f, -0.093338f,   0.300000f,  -0.035889f,
-  -0.058267f,   0.350000f,  -0.047223f, -0.093338f,   0.300000f,  -0.035889f,
-  -0.070003f,   0.350000f,  -0.026917f, -0.058267f,   0.350000f,  -0.047223f,
-  -0.093338f,   0.300000f,  -0.035889f, -0.099859f,   0.300000f,  -0.005305f,
-  -0.070003f,   0.350000f,  -0.026917f, -0.099859f,   0.300000f,  -0.005305f,
-  -0.074894f,   0.350000f,  -0.003979f, -0.070003f,   0.350000f,  -0.026917f,
-  -0.099859f,   0.300000f,  -0.005305f, -0.096615f,   0.300000f,   0.025798f,
-  -0.074894f,   0.350000f,  -0.003979f, -0.096615f,   0.300000f,   0.025798f,
-  -0.072461f,   0.350000f,   0.019348f, -0.074894f,   0.350000f,  -0.003979f,
-  -0.096615f,   0.300000f,   0.025798f, -0.083923f,   0.300000f,   0.054377f,
-  -0.072461f,   0.350000f,   0.019348f, -0.083923f,   0.300000f,   0.054377f,
-  -0.062942f,   0.350000f,   0.040783f, -0.072461f,   0.350000f,   0.019348f,
-  -0.083923f,   0.300000f,   0.054377f, -0.063024f,   0.300000f,   0.077640f,
-  -0.062942f,   0.350000f,   0.040783f, -0.063024f,   0.300000f,   0.077640f,
-  -0.047268f,   0.350000f,   0.058230f, -0.062942f,   0.350000f,   0.040783f,
-  -0.063024f,   0.300000f,   0.077640f, -0.035962f,   0.300000f,   0.093310f,
-  -0.047268f,   0.350000f,   0.058230f, -0.035962f,   0.300000f,   0.093310f,
-  -0.026972f,   0.350000f,   0.069982f, -0.047268f,   0.350000f,   0.058230f,
-  -0.035962f,   0.300000f,   0.093310f, -0.005383f,   0.300000f,   0.099855f,
-  -0.026972f,   0.350000f,   0.069982f, -0.005383f,   0.300000f,   0.099855f,
-  -0.004037f,   0.350000f,   0.074891f, -0.026972f,   0.350000f,   0.069982f,
-  -0.004037f,   0.350000f,   0.074891f,  0.019292f,   0.350000f,   0.072476f,
-  -0.002692f,   0.400000f,   0.049927f,  0.019292f,   0.350000f,   0.072476f,
-   0.012861f,   0.400000f,   0.048318f, -0.002692f,   0.400000f,   0.049927f,
-   0.019292f,   0.350000f,   0.072476f,  0.040734f,   0.350000f,   0.062974f,
-   0.012861f,   0.400000f,   0.048318f,  0.040734f,   0.350000f,   0.062974f,
-   0.027156f,   0.400000f,   0.041983f,  0.012861f,   0.400000f,   0.048318f,
-   0.040734f,   0.350000f,   0.062974f,  0.058193f,   0.350000f,   0.047314f,
-   0.027156f,   0.400000f,   0.041983f,  0.058193f,   0.350000f,   0.047314f,
-   0.038795f,   0.400000f,   0.031542f,  0.027156f,   0.400000f,   0.041983f,
-   0.058193f,   0.350000f,   0.047314f,  0.069961f,   0.350000f,   0.027026f,
-   0.038795f,   0.400000f,   0.031542f,  0.069961f,   0.350000f,   0.027026f,
-   0.046641f,   0.400000f,   0.018017f,  0.038795f,   0.400000f,   0.031542f,
-   0.069961f,   0.350000f,   0.027026f,  0.074888f,   0.350000f,   0.004096f,
-   0.046641f,   0.400000f,   0.018017f,  0.074888f,   0.350000f,   0.004096f,
-   0.049925f,   0.400000f,   0.002731f,  0.046641f,   0.400000f,   0.018017f,
-   0.074888f,   0.350000f,   0.004096f,  0.072491f,   0.350000f,  -0.019235f,
-   0.049925f,   0.400000f,   0.002731f,  0.072491f,   0.350000f,  -0.019235f,
-   0.048328f,   0.400000f,  -0.012823f,  0.049925f,   0.400000f,   0.002731f,
-   0.072491f,   0.350000f,  -0.019235f,  0.063006f,   0.350000f,  -0.040685f,
-   0.048328f,   0.400000f,  -0.012823f,  0.063006f,   0.350000f,  -0.040685f,
-   0.042004f,   0.400000f,  -0.027123f,  0.048328f,   0.400000f,  -0.012823f,
-   0.063006f,   0.350000f,  -0.040685f,  0.047359f,   0.350000f,  -0.058156f,
-   0.042004f,   0.400000f,  -0.027123f,  0.047359f,   0.350000f,  -0.058156f,
-   0.031573f,   0.400000f,  -0.038771f,  0.042004f,   0.400000f,  -0.027123f,
-   0.047359f,   0.350000f,  -0.058156f,  0.027081f,   0.350000f,  -0.069940f,
-   0.031573f,   0.400000f,  -0.038771f,  0.027081f,   0.350000f,  -0.069940f,
-   0.018054f,   0.400000f,  -0.046627f,  0.031573f,   0.400000f,  -0.038771f,
-   0.027081f,   0.350000f,  -0.069940f,  0.004154f,   0.350000f,  -0.074885f,
-   0.018054f,   0.400000f,  -0.046627f,  0.004154f,   0.350000f,  -0.074885f,
-   0.002770f,   0.400000f,  -0.049923f,  0.018054f,   0.400000f,  -0.046627f,
-   0.004154f,   0.350000f,  -0.074885f, -0.019178f,   0.350000f,  -0.072506f,
-   0.002770f,   0.400000f,  -0.049923f, -0.019178f,   0.350000f,  -0.072506f,
-  -0.012785f,   0.400000f,  -0.048338f,  0.002770f,   0.400000f,  -0.049923f,
-  -0.019178f,   0.350000f,  -0.072506f, -0.040635f,   0.350000f,  -0.063038f,
-  -0.012785f,   0.400000f,  -0.048338f, -0.040635f,   0.350000f,  -0.063038f,
-  -0.027090f,   0.400000f,  -0.042025f, -0.012785f,   0.400000f,  -0.048338f,
-  -0.040635f,   0.350000f,  -0.063038f, -0.058119f,   0.350000f,  -0.047404f,
-  -0.027090f,   0.400000f,  -0.042025f, -0.058119f,   0.350000f,  -0.047404f,
-  -0.038746f,   0.400000f,  -0.031603f, -0.027090f,   0.400000f,  -0.042025f,
-  -0.058119f,   0.350000f,  -0.047404f, -0.069919f,   0.350000f,  -0.027135f,
-  -0.038746f,   0.400000f,  -0.031603f, -0.069919f,   0.350000f,  -0.027135f,
-  -0.046613f,   0.400000f,  -0.018090f, -0.038746f,   0.400000f,  -0.031603f,
-  -0.069919f,   0.350000f,  -0.027135f, -0.074882f,   0.350000f,  -0.004213f,
-  -0.046613f,   0.400000f,  -0.018090f, -0.074882f,   0.350000f,  -0.004213f,
-  -0.049921f,   0.400000f,  -0.002809f, -0.046613f,   0.400000f,  -0.018090f,
-  -0.074882f,   0.350000f,  -0.004213f, -0.072521f,   0.350000f,   0.019122f,
-  -0.049921f,   0.400000f,  -0.002809f, -0.072521f,   0.350000f,   0.019122f,
-  -0.048348f,   0.400000f,   0.012748f, -0.049921f,   0.400000f,  -0.002809f,
-  -0.072521f,   0.350000f,   0.019122f, -0.063069f,   0.350000f,   0.040586f,
-  -0.048348f,   0.400000f,   0.012748f, -0.063069f,   0.350000f,   0.040586f,
-  -0.042046f,   0.400000f,   0.027057f, -0.048348f,   0.400000f,   0.012748f,
-  -0.063069f,   0.350000f,   0.040586f, -0.047450f,   0.350000f,   0.058082f,
-  -0.042046f,   0.400000f,   0.027057f, -0.047450f,   0.350000f,   0.058082f,
-  -0.031633f,   0.400000f,   0.038721f, -0.042046f,   0.400000f,   0.027057f,
-  -0.047450f,   0.350000f,   0.058082f, -0.027190f,   0.350000f,   0.069898f,
-  -0.031633f,   0.400000f,   0.038721f, -0.027190f,   0.350000f,   0.069898f,
-  -0.018127f,   0.400000f,   0.046598f, -0.031633f,   0.400000f,   0.038721f,
-  -0.027190f,   0.350000f,   0.069898f, -0.004271f,   0.350000f,   0.074878f,
-  -0.018127f,   0.400000f,   0.046598f, -0.004271f,   0.350000f,   0.074878f,
-  -0.002848f,   0.400000f,   0.049919f, -0.018127f,   0.400000f,   0.046598f,
-  -0.002848f,   0.400000f,   0.049919f,  0.012710f,   0.400000f,   0.048358f,
-  -0.001424f,   0.450000f,   0.024959f,  0.012710f,   0.400000f,   0.048358f,
-   0.006355f,   0.450000f,   0.024179f, -0.001424f,   0.450000f,   0.024959f,
-   0.012710f,   0.400000f,   0.048358f,  0.027025f,   0.400000f,   0.042067f,
-   0.006355f,   0.450000f,   0.024179f,  0.027025f,   0.400000f,   0.042067f,
-   0.013512f,   0.450000f,   0.021034f,  0.006355f,   0.450000f,   0.024179f,
-   0.027025f,   0.400000f,   0.042067f,  0.038696f,   0.400000f,   0.031663f,
-   0.013512f,   0.450000f,   0.021034f,  0.038696f,   0.400000f,   0.031663f,
-   0.019348f,   0.450000f,   0.015832f,  0.013512f,   0.450000f,   0.021034f,
-   0.038696f,   0.400000f,   0.031663f,  0.046584f,   0.400000f,   0.018163f,
-   0.019348f,   0.450000f,   0.015832f,  0.046584f,   0.400000f,   0.018163f,
-   0.023292f,   0.450000f,   0.009082f,  0.019348f,   0.450000f,   0.015832f,
-   0.046584f,   0.400000f,   0.018163f,  0.049917f,   0.400000f,   0.002887f,
-   0.023292f,   0.450000f,   0.009082f,  0.049917f,   0.400000f,   0.002887f,
-   0.024958f,   0.450000f,   0.001443f,  0.023292f,   0.450000f,   0.009082f,
-   0.049917f,   0.400000f,   0.002887f,  0.048367f,   0.400000f,  -0.012672f,
-   0.024958f,   0.450000f,   0.001443f,  0.048367f,   0.400000f,  -0.012672f,
-   0.024184f,   0.450000f,  -0.006336f,  0.024958f,   0.450000f,   0.001443f,
-   0.048367f,   0.400000f,  -0.012672f,  0.042088f,   0.400000f,  -0.026992f,
-   0.024184f,   0.450000f,  -0.006336f,  0.042088f,   0.400000f,  -0.026992f,
-   0.021044f,   0.450000f,  -0.013496f,  0.024184f,   0.450000f,  -0.006336f,
-   0.042088f,   0.400000f,  -0.026992f,  0.031694f,   0.400000f,  -0.038672f,
-   0.021044f,   0.450000f,  -0.013496f,  0.031694f,   0.400000f,  -0.038672f,
-   0.015847f,   0.450000f,  -0.019336f,  0.021044f,   0.450000f,  -0.013496f,
-   0.031694f,   0.400000f,  -0.038672f,  0.018200f,   0.400000f,  -0.046570f,
-   0.015847f,   0.450000f,  -0.019336f,  0.018200f,   0.400000f,  -0.046570f,
-   0.009100f,   0.450000f,  -0.023285f,  0.015847f,   0.450000f,  -0.019336f,
-   0.018200f,   0.400000f,  -0.046570f,  0.002926f,   0.400000f,  -0.049914f,
-   0.009100f,   0.450000f,  -0.023285f,  0.002926f,   0.400000f,  -0.049914f,
-   0.001463f,   0.450000f,  -0.024957f,  0.009100f,   0.450000f,  -0.023285f,
-   0.002926f,   0.400000f,  -0.049914f, -0.012634f,   0.400000f,  -0.048377f,
-   0.001463f,   0.450000f,  -0.024957f, -0.012634f,   0.400000f,  -0.048377f,
-  -0.006317f,   0.450000f,  -0.024189f,  0.001463f,   0.450000f,  -0.024957f,
-  -0.012634f,   0.400000f,  -0.048377f, -0.026959f,   0.400000f,  -0.042110f,
-  -0.006317f,   0.450000f,  -0.024189f, -0.026959f,   0.400000f,  -0.042110f,
-  -0.013479f,   0.450000f,  -0.021055f, -0.006317f,   0.450000f,  -0.024189f,
-  -0.026959f,   0.400000f,  -0.042110f, -0.038647f,   0.400000f,  -0.031724f,
-  -0.013479f,   0.450000f,  -0.021055f, -0.038647f,   0.400000f,  -0.031724f,
-  -0.019323f,   0.450000f,  -0.015862f, -0.013479f,   0.450000f,  -0.021055f,
-  -0.038647f,   0.400000f,  -0.031724f, -0.046556f,   0.400000f,  -0.018236f,
-  -0.019323f,   0.450000f,  -0.015862f, -0.046556f,   0.400000f,  -0.018236f,
-  -0.023278f,   0.450000f,  -0.009118f, -0.019323f,   0.450000f,  -0.015862f,
-  -0.046556f,   0.400000f,  -0.018236f, -0.049912f,   0.400000f,  -0.002965f,
-  -0.023278f,   0.450000f,  -0.009118f, -0.049912f,   0.400000f,  -0.002965f,
-  -0.024956f,   0.450000f,  -0.001482f, -0.023278f,   0.450000f,  -0.009118f,
-  -0.049912f,   0.400000f,  -0.002965f, -0.048387f,   0.400000f,   0.012597f,
-  -0.024956f,   0.450000f,  -0.001482f, -0.048387f,   0.400000f,   0.012597f,
-  -0.024194f,   0.450000f,   0.006298f, -0.024956f,   0.450000f,  -0.001482f,
-  -0.048387f,   0.400000f,   0.012597f, -0.042131f,   0.400000f,   0.026926f,
-  -0.024194f,   0.450000f,   0.006298f, -0.042131f,   0.400000f,   0.026926f,
-  -0.021065f,   0.450000f,   0.013463f, -0.024194f,   0.450000f,   0.006298f,
-  -0.042131f,   0.400000f,   0.026926f, -0.031754f,   0.400000f,   0.038622f,
-  -0.021065f,   0.450000f,   0.013463f, -0.031754f,   0.400000f,   0.038622f,
-  -0.015877f,   0.450000f,   0.019311f, -0.021065f,   0.450000f,   0.013463f,
-  -0.031754f,   0.400000f,   0.038622f, -0.018272f,   0.400000f,   0.046542f,
-  -0.015877f,   0.450000f,   0.019311f, -0.018272f,   0.400000f,   0.046542f,
-  -0.009136f,   0.450000f,   0.023271f, -0.015877f,   0.450000f,   0.019311f,
-  -0.018272f,   0.400000f,   0.046542f, -0.003004f,   0.400000f,   0.049910f,
-  -0.009136f,   0.450000f,   0.023271f, -0.003004f,   0.400000f,   0.049910f,
-  -0.001502f,   0.450000f,   0.024955f, -0.009136f,   0.450000f,   0.023271f,
-   0.000000f,   0.450000f,   0.025000f,  0.007722f,   0.450000f,   0.023778f,
-   0.000000f,   0.500000f,   0.000000f,  0.007722f,   0.450000f,   0.023778f,
-   0.014688f,   0.450000f,   0.020230f,  0.000000f,   0.500000f,   0.000000f,
-   0.014688f,   0.450000f,   0.020230f,  0.020218f,   0.450000f,   0.014704f,
-   0.000000f,   0.500000f,   0.000000f,  0.020218f,   0.450000f,   0.014704f,
-   0.023771f,   0.450000f,   0.007741f,  0.000000f,   0.500000f,   0.000000f,
-   0.023771f,   0.450000f,   0.007741f,  0.025000f,   0.450000f,   0.000020f,
-   0.000000f,   0.500000f,   0.000000f,  0.025000f,   0.450000f,   0.000020f,
-   0.023784f,   0.450000f,  -0.007703f,  0.000000f,   0.500000f,   0.000000f,
-   0.023784f,   0.450000f,  -0.007703f,  0.020242f,   0.450000f,  -0.014672f,
-   0.000000f,   0.500000f,   0.000000f,  0.020242f,   0.450000f,  -0.014672f,
-   0.014720f,   0.450000f,  -0.020207f,  0.000000f,   0.500000f,   0.000000f,
-   0.014720f,   0.450000f,  -0.020207f,  0.007759f,   0.450000f,  -0.023765f,
-   0.000000f,   0.500000f,   0.000000f,  0.007759f,   0.450000f,  -0.023765f,
-   0.000040f,   0.450000f,  -0.025000f,  0.000000f,   0.500000f,   0.000000f,
-   0.000040f,   0.450000f,  -0.025000f, -0.007684f,   0.450000f,  -0.023790f,
-   0.000000f,   0.500000f,   0.000000f, -0.007684f,   0.450000f,  -0.023790f,
-  -0.014656f,   0.450000f,  -0.020253f,  0.000000f,   0.500000f,   0.000000f,
-  -0.014656f,   0.450000f,  -0.020253f, -0.020195f,   0.450000f,  -0.014736f,
-   0.000000f,   0.500000f,   0.000000f, -0.020195f,   0.450000f,  -0.014736f,
-  -0.023759f,   0.450000f,  -0.007778f,  0.000000f,   0.500000f,   0.000000f,
-  -0.023759f,   0.450000f,  -0.007778f, -0.025000f,   0.450000f,  -0.000060f,
-   0.000000f,   0.500000f,   0.000000f, -0.025000f,   0.450000f,  -0.000060f,
-  -0.023796f,   0.450000f,   0.007665f,  0.000000f,   0.500000f,   0.000000f,
-  -0.023796f,   0.450000f,   0.007665f, -0.020265f,   0.450000f,   0.014640f,
-   0.000000f,   0.500000f,   0.000000f, -0.020265f,   0.450000f,   0.014640f,
-  -0.014752f,   0.450000f,   0.020183f,  0.000000f,   0.500000f,   0.000000f,
-  -0.014752f,   0.450000f,   0.020183f, -0.007797f,   0.450000f,   0.023753f,
-   0.000000f,   0.500000f,   0.000000f, -0.007797f,   0.450000f,   0.023753f,
-  -0.000080f,   0.450000f,   0.025000f,  0.000000f,   0.500000f,   0.000000f
-};
-
-int coneVerticesLength = sizeof(coneVertices) / sizeof(float);
+static void band(GLuint *&e, GLuint lower, GLuint upper, int slices)
+{
+	for (int j = 0; j < slices; ++j) {
+		GLuint k = (j + 1 == slices) ? 0 : j + 1;
+		*e++ = lower + j; *e++ = lower + k; *e++ = upper + j;
+		*e++ = lower + k; *e++ = upper + k; *e++ = upper + j;
+	}
+}
 
 //
-// Each group of three values specifies a cone triangle
+// fan() - triangles joining vertex 'center' to a ring of 'slices'
+// vertices starting at 'first', facing up or down
 //
-int coneElements[] = {
-	 0,     1,     2,     3,     4,     5,     6,     7,     8,     9,
-	10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-	20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-	30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-	40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-	50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-	60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-	70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-	80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-	90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
-   100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
-   110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
-   120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
-   130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
-   140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
-   150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
-   160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
-   170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
-   180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-   190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
-   200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
-   210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
-   220,   221,   222,   223,   224,   225,   226,   227,   228,   229,
-   230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-   240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
-   250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
-   260,   261,   262,   263,   264,   265,   266,   267,   268,   269,
-   270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
-   280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
-   290,   291,   292,   293,   294,   295,   296,   297,   298,   299,
-   300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
-   310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
-   320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
-   330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
-   340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
-   350,   351,   352,   353,   354,   355,   356,   357,   358,   359,
-   360,   361,   362,   363,   364,   365,   366,   367,   368,   369,
-   370,   371,   372,   373,   374,   375,   376,   377,   378,   379,
-   380,   381,   382,   383,   384,   385,   386,   387,   388,   389,
-   390,   391,   392,   393,   394,   395,   396,   397,   398,   399,
-   400,   401,   402,   403,   404,   405,   406,   407,   408,   409,
-   410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
-   420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
-   430,   431,   432,   433,   434,   435,   436,   437,   438,   439,
-   440,   441,   442,   443,   444,   445,   446,   447,   448,   449,
-   450,   451,   452,   453,   454,   455,   456,   457,   458,   459,
-   460,   461,   462,   463,   464,   465,   466,   467,   468,   469,
-   470,   471,   472,   473,   474,   475,   476,   477,   478,   479,
-   480,   481,   482,   483,   484,   485,   486,   487,   488,   489,
-   490,   491,   492,   493,   494,   495,   496,   497,   498,   499,
-   500,   501,   502,   503,   504,   505,   506,   507,   508,   509,
-   510,   511,   512,   513,   514,   515,   516,   517,   518,   519,
-   520,   521,   522,   523,   524,   525,   526,   527,   528,   529,
-   530,   531,   532,   533,   534,   535,   536,   537,   538,   539,
-   540,   541,   542,   543,   544,   545,   546,   547,   548,   549,
-   550,   551,   552,   553,   554,   555,   556,   557,   558,   559,
-   560,   561,   562,   563,   564,   565,   566,   567,   568,   569,
-   570,   571,   572,   573,   574,   575,   576,   577,   578,   579,
-   580,   581,   582,   583,   584,   585,   586,   587,   588,   589,
-   590,   591,   592,   593,   594,   595,   596,   597,   598,   599,
-   600,   601,   602,   603,   604,   605,   606,   607,   608,   609,
-   610,   611,   612,   613,   614,   615,   616,   617,   618,   619,
-   620,   621,   622,   623,   624,   625,   626,   627,   628,   629,
-   630,   631,   632,   633,   634,   635,   636,   637,   638,   639,
-   640,   641,   642,   643,   644,   645,   646,   647,   648,   649,
-   650,   651,   652,   653,   654,   655,   656,   657,   658,   659,
-   660,   661,   662,   663,   664,   665,   666,   667,   668,   669,
-   670,   671,   672,   673,   674,   675,   676,   677,   678,   679,
-   680,   681,   682,   683,   684,   685,   686,   687,   688,   689,
-   690,   691,   692,   693,   694,   695,   696,   697,   698,   699,
-   700,   701,   702,   703,   704,   705,   706,   707,   708,   709,
-   710,   711,   712,   713,   714,   715,   716,   717,   718,   719,
-   720,   721,   722,   723,   724,   725,   726,   727,   728,   729,
-   730,   731,   732,   733,   734,   735,   736,   737,   738,   739,
-   740,   741,   742,   743,   744,   745,   746,   747,   748,   749,
-   750,   751,   752,   753,   754,   755,   756,   757,   758,   759,
-   760,   761,   762,   763,   764,   765,   766,   767,   768,   769,
-   770,   771,   772,   773,   774,   775,   776,   777,   778,   779,
-   780,   781,   782,   783,   784,   785,   786,   787,   788,   789,
-   790,   791,   792,   793,   794,   795,   796,   797,   798,   799,
-   800,   801,   802,   803,   804,   805,   806,   807,   808,   809,
-   810,   811,   812,   813,   814,   815,   816,   817,   818,   819,
-   820,   821,   822,   823,   824,   825,   826,   827,   828,   829,
-   830,   831,   832,   833,   834,   835,   836,   837,   838,   839,
-   840,   841,   842,   843,   844,   845,   846,   847,   848,   849,
-   850,   851,   852,   853,   854,   855,   856,   857,   858,   859,
-   860,   861,   862,   863,   864,   865,   866,   867,   868,   869,
-   870,   871,   872,   873,   874,   875,   876,   877,   878,   879,
-   880,   881,   882,   883,   884,   885,   886,   887,   888,   889,
-   890,   891,   892,   893,   894,   895,   896,   897,   898,   899,
-   900,   901,   902,   903,   904,   905,   906,   907,   908,   909,
-   910,   911,   912,   913,   914,   915,   916,   917,   918,   919,
-   920,   921,   922,   923,   924,   925,   926,   927,   928,   929,
-   930,   931,   932,   933,   934,   935,   936,   937,   938,   939,
-   940,   941,   942,   943,   944,   945,   946,   947,   948,   949,
-   950,   951,   952,   953,   954,   955,   956,   957,   958,   959,
-   960,   961,   962,   963,   964,   965,   966,   967,   968,   969,
-   970,   971,   972,   973,   974,   975,   976,   977,   978,   979,
-   980,   981,   982,   983,   984,   985,   986,   987,   988,   989,
-   990,   991,   992,   993,   994,   995,   996,   997,   998,   999,
-  1000,  1001,  1002,  1003,  1004,  1005,  1006,  1007,  1008,  1009,
-  1010,  1011,  1012,  1013,  1014,  1015,  1016,  1017,  1018,  1019,
-  1020,  1021,  1022,  1023,  1024,  1025,  1026,  1027,  1028,  1029,
-  1030,  1031,  1032,  1033,  1034,  1035,  1036,  1037,  1038,  1039,
-  1040,  1041,  1042,  1043,  1044,  1045,  1046,  1047,  1048,  1049,
-  1050,  1051,  1052,  1053,  1054,  1055,  1056,  1057,  1058,  1059,
-  1060,  1061,  1062,  1063,  1064,  1065,  1066,  1067,  1068,  1069,
-  1070,  1071,  1072,  1073,  1074,  1075,  1076,  1077,  1078,  1079,
-  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,
-  1090,  1091,  1092,  1093,  1094,  1095,  1096,  1097,  1098,  1099,
-  1100,  1101,  1102,  1103,  1104,  1105,  1106,  1107,  1108,  1109,
-  1110,  1111,  1112,  1113,  1114,  1115,  1116,  1117,  1118,  1119,
-  1120,  1121,  1122,  1123,  1124,  1125,  1126,  1127,  1128,  1129,
-  1130,  1131,  1132,  1133,  1134,  1135,  1136,  1137,  1138,  1139,
-  1140,  1141,  1142,  1143,  1144,  1145,  1146,  1147,  1148,  1149,
-  1150,  1151,  1152,  1153,  1154,  1155,  1156,  1157,  1158,  1159,
-  1160,  1161,  1162,  1163,  1164,  1165,  1166,  1167,  1168,  1169,
-  1170,  1171,  1172,  1173,  1174,  1175,  1176,  1177,  1178,  1179,
-  1180,  1181,  1182,  1183,  1184,  1185,  1186,  1187,  1188,  1189,
-  1190,  1191,  1192,  1193,  1194,  1195,  1196,  1197,  1198,  1199,
-  1200,  1201,  1202,  1203,  1204,  1205,  1206,  1207,  1208,  1209,
-  1210,  1211,  1212,  1213,  1214,  1215,  1216,  1217,  1218,  1219,
-  1220,  1221,  1222,  1223,  1224,  1225,  1226,  1227,  1228,  1229,
-  1230,  1231,  1232,  1233,  1234,  1235,  1236,  1237,  1238,  1239,
-  1240,  1241,  1242,  1243,  1244,  1245,  1246,  1247,  1248,  1249,
-  1250,  1251,  1252,  1253,  1254,  1255,  1256,  1257,  1258,  1259,
-  1260,  1261,  1262,  1263,  1264,  1265,  1266,  1267,  1268,  1269,
-  1270,  1271,  1272,  1273,  1274,  1275,  1276,  1277,  1278,  1279,
-  1280,  1281,  1282,  1283,  1284,  1285,  1286,  1287,  1288,  1289,
-  1290,  1291,  1292,  1293,  1294,  1295,  1296,  1297,  1298,  1299,
-  1300,  1301,  1302,  1303,  1304,  1305,  1306,  1307,  1308,  1309,
-  1310,  1311,  1312,  1313,  1314,  1315,  1316,  1317,  1318,  1319,
-  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,  1328,  1329,
-  1330,  1331,  1332,  1333,  1334,  1335,  1336,  1337,  1338,  1339,
-  1340,  1341,  1342,  1343,  1344,  1345,  1346,  1347,  1348,  1349,
-  1350,  1351,  1352,  1353,  1354,  1355,  1356,  1357,  1358,  1359,
-  1360,  1361,  1362,  1363,  1364,  1365,  1366,  1367,  1368,  1369,
-  1370,  1371,  1372,  1373,  1374,  1375,  1376,  1377,  1378,  1379,
-  1380,  1381,  1382,  1383,  1384,  1385,  1386,  1387,  1388,  1389,
-  1390,  1391,  1392,  1393,  1394,  1395,  1396,  1397,  1398,  1399,
-  1400,  1401,  1402,  1403,  1404,  1405,  1406,  1407,  1408,  1409,
-  1410,  1411,  1412,  1413,  1414,  1415,  1416,  1417,  1418,  1419,
-  1420,  1421,  1422,  1423,  1424,  1425,  1426,  1427,  1428,  1429,
-  1430,  1431,  1432,  1433,  1434,  1435,  1436,  1437,  1438,  1439,
-  1440,  1441,  1442,  1443,  1444,  1445,  1446,  1447,  1448,  1449,
-  1450,  1451,  1452,  1453,  1454,  1455,  1456,  1457,  1458,  1459,
-  1460,  1461,  1462,  1463,  1464,  1465,  1466,  1467,  1468,  1469,
-  1470,  1471,  1472,  1473,  1474,  1475,  1476,  1477,  1478,  1479,
-  1480,  1481,  1482,  1483,  1484,  1485,  1486,  1487,  1488,  1489,
-  1490,  1491,  1492,  1493,  1494,  1495,  1496,  1497,  1498,  1499,
-  1500,  1501,  1502,  1503,  1504,  1505,  1506,  1507,  1508,  1509,
-  1510,  1511,  1512,  1513,  1514,  1515,  1516,  1517,  1518,  1519,
-  1520,  1521,  1522,  1523,  1524,  1525,  1526,  1527,  1528,  1529,
-  1530,  1531,  1532,  1533,  1534,  1535,  1536,  1537,  1538,  1539,
-  1540,  1541,  1542,  1543,  1544,  1545,  1546,  1547,  1548,  1549,
-  1550,  1551,  1552,  1553,  1554,  1555,  1556,  1557,  1558,  1559,
-  1560,  1561,  1562,  1563,  1564,  1565,  1566,  1567,  1568,  1569,
-  1570,  1571,  1572,  1573,  1574,  1575,  1576,  1577,  1578,  1579,
-  1580,  1581,  1582,  1583,  1584,  1585,  1586,  1587,  1588,  1589,
-  1590,  1591,  1592,  1593,  1594,  1595,  1596,  1597,  1598,  1599,
-  1600,  1601,  1602,  1603,  1604,  1605,  1606,  1607,  1608,  1609,
-  1610,  1611,  1612,  1613,  1614,  1615,  1616,  1617,  1618,  1619,
-  1620,  1621,  1622,  1623,  1624,  1625,  1626,  1627,  1628,  1629,
-  1630,  1631,  1632,  1633,  1634,  1635,  1636,  1637,  1638,  1639,
-  1640,  1641,  1642,  1643,  1644,  1645,  1646,  1647,  1648,  1649,
-  1650,  1651,  1652,  1653,  1654,  1655,  1656,  1657,  1658,  1659,
-  1660,  1661,  1662,  1663,  1664,  1665,  1666,  1667,  1668,  1669,
-  1670,  1671,  1672,  1673,  1674,  1675,  1676,  1677,  1678,  1679,
-  1680,  1681,  1682,  1683,  1684,  1685,  1686,  1687,  1688,  1689,
-  1690,  1691,  1692,  1693,  1694,  1695,  1696,  1697,  1698,  1699,
-  1700,  1701,  1702,  1703,  1704,  1705,  1706,  1707,  1708,  1709,
-  1710,  1711,  1712,  1713,  1714,  1715,  1716,  1717,  1718,  1719,
-  1720,  1721,  1722,  1723,  1724,  1725,  1726,  1727,  1728,  1729,
-  1730,  1731,  1732,  1733,  1734,  1735,  1736,  1737,  1738,  1739,
-  1740,  1741,  1742,  1743,  1744,  1745,  1746,  1747,  1748,  1749,
-  1750,  1751,  1752,  1753,  1754,  1755,  1756,  1757,  1758,  1759,
-  1760,  1761,  1762,  1763,  1764,  1765,  1766,  1767,  1768,  1769,
-  1770,  1771,  1772,  1773,  1774,  1775,  1776,  1777,  1778,  1779,
-  1780,  1781,  1782,  1783,  1784,  1785,  1786,  1787,  1788,  1789,
-  1790,  1791,  1792,  1793,  1794,  1795,  1796,  1797,  1798,  1799,
-  1800,  1801,  1802,  1803,  1804,  1805,  1806,  1807,  1808,  1809,
-  1810,  1811,  1812,  1813,  1814,  1815,  1816,  1817,  1818,  1819,
-  1820,  1821,  1822,  1823,  1824,  1825,  1826,  1827,  1828,  1829,
-  1830,  1831,  1832,  1833,  1834,  1835,  1836,  1837,  1838,  1839,
-  1840,  1841,  1842,  1843,  1844,  1845,  1846,  1847,  1848,  1849,
-  1850,  1851,  1852,  1853,  1854,  1855,  1856,  1857,  1858,  1859,
-  1860,  1861,  1862,  1863,  1864,  1865,  1866,  1867,  1868,  1869,
-  1870,  1871,  1872,  1873,  1874,  1875,  1876,  1877,  1878,  1879,
-  1880,  1881,  1882,  1883,  1884,  1885,  1886,  1887,  1888,  1889,
-  1890,  1891,  1892,  1893,  1894,  1895,  1896,  1897,  1898,  1899,
-  1900,  1901,  1902,  1903,  1904,  1905,  1906,  1907,  1908,  1909,
-  1910,  1911,  1912,  1913,  1914,  1915,  1916,  1917,  1918,  1919,
-  1920,  1921,  1922,  1923,  1924,  1925,  1926,  1927,  1928,  1929,
-  1930,  1931,  1932,  1933,  1934,  1935,  1936,  1937,  1938,  1939,
-  1940,  1941,  1942,  1943,  1944,  1945,  1946,  1947,  1948,  1949,
-  1950,  1951,  1952,  1953,  1954,  1955,  1956,  1957,  1958,  1959,
-  1960,  1961,  1962,  1963,  1964,  1965,  1966,  1967,  1968,  1969,
-  1970,  1971,  1972,  1973,  1974,  1975,  1976,  1977,  1978,  1979,
-  1980,  1981,  1982,  1983,  1984,  1985,  1986,  1987,  1988,  1989,
-  1990,  1991,  1992,  1993,  1994,  1995,  1996,  1997,  1998,  1999,
-  2000,  2001,  2002,  2003,  2004,  2005,  2006,  2007,  2008,  2009,
-  2010,  2011,  2012,  2013,  2014,  2015,  2016,  2017,  2018,  2019,
-  2020,  2021,  2022,  2023,  2024,  2025,  2026,  2027,  2028,  2029,
-  2030,  2031,  2032,  2033,  2034,  2035,  2036,  2037,  2038,  2039,
-  2040,  2041,  2042,  2043,  2044,  2045,  2046,  2047,  2048,  2049,
-  2050,  2051,  2052,  2053,  2054,  2055,  2056,  2057,  2058,  2059,
-  2060,  2061,  2062,  2063,  2064,  2065,  2066,  2067,  2068,  2069,
-  2070,  2071,  2072,  2073,  2074,  2075,  2076,  2077,  2078,  2079,
-  2080,  2081,  2082,  2083,  2084,  2085,  2086,  2087,  2088,  2089,
-  2090,  2091,  2092,  2093,  2094,  2095,  2096,  2097,  2098,  2099,
-  2100,  2101,  2102,  2103,  2104,  2105,  2106,  2107,  2108,  2109,
-  2110,  2111,  2112,  2113,  2114,  2115,  2116,  2117,  2118,  2119,
-  2120,  2121,  2122,  2123,  2124,  2125,  2126,  2127,  2128,  2129,
-  2130,  2131,  2132,  2133,  2134,  2135,  2136,  2137,  2138,  2139,
-  2140,  2141,  2142,  2143,  2144,  2145,  2146,  2147,  2148,  2149,
-  2150,  2151,  2152,  2153,  2154,  2155,  2156,  2157,  2158,  2159,
-  2160,  2161,  2162,  2163,  2164,  2165,  2166,  2167,  2168,  2169,
-  2170,  2171,  2172,  2173,  2174,  2175,  2176,  2177,  2178,  2179,
-  2180,  2181,  2182,  2183,  2184,  2185,  2186,  2187,  2188,  2189,
-  2190,  2191,  2192,  2193,  2194,  2195,  2196,  2197,  2198,  2199,
-  2200,  2201,  2202,  2203,  2204,  2205,  2206,  2207,  2208,  2209,
-  2210,  2211,  2212,  2213,  2214,  2215,  2216,  2217,  2218,  2219,
-  2220,  2221,  2222,  2223,  2224,  2225,  2226,  2227,  2228,  2229,
-  2230,  2231,  2232,  2233,  2234,  2235,  2236,  2237,  2238,  2239,
-  2240,  2241,  2242,  2243,  2244,  2245,  2246,  2247,  2248,  2249,
-  2250,  2251,  2252,  2253,  2254,  2255,  2256,  2257,  2258,  2259,
-  2260,  2261,  2262,  2263,  2264,  2265,  2266,  2267,  2268,  2269,
-  2270,  2271,  2272,  2273,  2274,  2275,  2276,  2277,  2278,  2279,
-  2280,  2281,  2282,  2283,  2284,  2285,  2286,  2287,  2288,  2289,
-  2290,  2291,  2292,  2293,  2294,  2295,  2296,  2297,  2298,  2299,
-  2300,  2301,  2302,  2303,  2304,  2305,  2306,  2307,  2308,  2309,
-  2310,  2311,  2312,  2313,  2314,  2315,  2316,  2317,  2318,  2319,
-  2320,  2321,  2322,  2323,  2324,  2325,  2326,  2327,  2328,  2329,
-  2330,  2331,  2332,  2333,  2334,  2335,  2336,  2337,  2338,  2339,
-  2340,  2341,  2342,  2343,  2344,  2345,  2346,  2347,  2348,  2349,
-  2350,  2351,  2352,  2353,  2354,  2355,  2356,  2357,  2358,  2359,
-  2360,  2361,  2362,  2363,  2364,  2365,  2366,  2367,  2368,  2369,
-  2370,  2371,  2372,  2373,  2374,  2375,  2376,  2377,  2378,  2379,
-  2380,  2381,  2382,  2383,  2384,  2385,  2386,  2387,  2388,  2389,
-  2390,  2391,  2392,  2393,  2394,  2395,  2396,  2397,  2398,  2399
-};
-
-int coneElementsLength = sizeof(coneElements) / sizeof(int);
+static void fan(GLuint *&e, GLuint center, GLuint first, int slices, bool up)
+{
+	for (int j = 0; j < slices; ++j) {
+		GLuint k = (j + 1 == slices) ? 0 : j + 1;
+		*e++ = center;
+		*e++ = first + (up ? j : k);
+		*e++ = first + (up ? k : j);
+	}
+}
 
 //
-// makeCone() - create a cone object
+// cap() - a flat disk of radius 0.5 at height y, facing up or down,
+// with its own vertices (so that its edge is sharp); 'first' is the
+// number of its first vertex
 //
-
-void makeCone(Canvas &C)
+static void cap(float *&p, float *&n, GLuint *&e, GLuint first,
+	const vector<float> &s, const vector<float> &c, float y, bool up)
 {
-	int i;
-
-	for (i = 0; i < coneElementsLength - 2; i += 3) {
-
-		// Calculate the base indices of the three vertices
-		int point1 = 3 * coneElements[i];     // slots 0, 1, 2
-		int point2 = 3 * coneElements[i + 1]; // slots 3, 4, 5
-		int point3 = 3 * coneElements[i + 2]; // slots 6, 7, 8
-
-		Vertex p1 = { coneVertices[point1 + 0],
-					  coneVertices[point1 + 1],
-					  coneVertices[point1 + 2] };
-
-		Vertex p2 = { coneVertices[point2 + 0],
-					  coneVertices[point2 + 1],
-					  coneVertices[point2 + 2] };
-
-		Vertex p3 = { coneVertices[point3 + 0],
-					  coneVertices[point3 + 1],
-					  coneVertices[point3 + 2] };
-
-		// Calculate the base indices of the three normals
-		int normal1 = 3 * coneElements[i];     // slots 0, 1, 2
-		int normal2 = 3 * coneElements[i + 1]; // slots 3, 4, 5
-		int normal3 = 3 * coneElements[i + 2]; // slots 6, 7, 8
+	float ny = up ? 1.0f : -1.0f;
 
-		Normal n1 = { coneVertices[normal1 + 0],
-					  coneVertices[normal1 + 1],
-					  coneVertices[normal1 + 2] };
-
-		Normal n2 = { coneVertices[normal2 + 0],
-					  coneVertices[normal2 + 1],
-					  coneVertices[normal2 + 2] };
+	vertex(p, n, 0.0f, y, 0.0f, 0.0f, ny, 0.0f);
+	ring(p, n, s, c, 0.5f, y, 0.0f, ny);
+	fan(e, first, first + 1, (int) s.size(), up);
+}
 
-		Normal n3 = { coneVertices[normal3 + 0],
-					  coneVertices[normal3 + 1],
-					  coneVertices[normal3 + 2] };
+//
+// makeSphere() - create a sphere object
+//
+// @param slices - divisions around the axis (at least 3)
+// @param stacks - divisions from pole to pole (at least 2)
+//
+void makeSphere(Canvas &C, int slices, int stacks)
+{
+	slices = max(slices, 3);
+	stacks = max(stacks, 2);
+
+	// a vertex at each pole, and a ring between each pair of stacks
+	int rings = stacks - 1;
+	int nv = 2 + rings * slices;
+	int nt = 2 * slices * rings;
+
+	float *p, *n;
+	GLuint *e;
+	GLuint base = C.addMesh(nv, nt, &p, &n, &e);
+	GLuint bottom = base + nv - 1;
+
+	vector<float> s, c;
+	angles(slices, false, s, c);
+
+	vertex(p, n, 0.0f, 0.5f, 0.0f, 0.0f, 1.0f, 0.0f);
+	for (int i = 1; i <= rings; ++i) {
+		float phi = 0.5f * TWO_PI * i / stacks;
+		float sp = sinf(phi), cp = cosf(phi);
+		ring(p, n, s, c, 0.5f * sp, 0.5f * cp, sp, cp);
+	}
+	vertex(p, n, 0.0f, -0.5f, 0.0f, 0.0f, -1.0f, 0.0f);
 
-		// Add triangle and vertex normals
-		C.addTriangleWithNorms(p1, n1, p2, n2, p3, n3);
+	// ring i (from the top) starts at vertex 1 + (i - 1) * slices
+	fan(e, base, base + 1, slices, true);
+	for (int i = 1; i < rings; ++i) {
+		band(e, base + 1 + i * slices, base + 1 + (i - 1) * slices, slices);
 	}
+	fan(e, bottom, base + 1 + (rings - 1) * slices, slices, false);
 }
 
-
-float cylinderVertices[] = {
-   0.000000f,  -0.500000f,   0.500000f,  0.000000f,  -0.500000f,   0.000000f,
-   0.293764f,  -0.500000f,   0.404602f,  0.293764f,  -0.500000f,   0.404602f,
-   0.000000f,  -0.500000f,   0.000000f,  0.475430f,  -0.500000f,   0.154811f,
-   0.475430f,  -0.500000f,   0.154811f,  0.000000f,  -0.500000f,   0.000000f,
-   0.475676f,  -0.500000f,  -0.154054f,  0.475676f,  -0.500000f,  -0.154054f,
-   0.000000f,  -0.500000f,   0.000000f,  0.294408f,  -0.500000f,  -0.404134f,
-   0.294408f,  -0.500000f,  -0.404134f,  0.000000f,  -0.500000f,   0.000000f,
-   0.000796f,  -0.500000f,  -0.499999f,  0.000796f,  -0.500000f,  -0.499999f,
-   0.000000f,  -0.500000f,   0.000000f, -0.293119f,  -0.500000f,  -0.405069f,
-  -0.293119f,  -0.500000f,  -0.405069f,  0.000000f,  -0.500000f,   0.000000f,
-  -0.475183f,  -0.500000f,  -0.155568f, -0.475183f,  -0.500000f,  -0.155568f,
-   0.000000f,  -0.500000f,   0.000000f, -0.475920f,  -0.500000f,   0.153296f,
-  -0.475920f,  -0.500000f,   0.153296f,  0.000000f,  -0.500000f,   0.000000f,
-  -0.295051f,  -0.500000f,   0.403664f, -0.295051f,  -0.500000f,   0.403664f,
-   0.000000f,  -0.500000f,   0.000000f, -0.001592f,  -0.500000f,   0.499997f,
-   0.000000f,  -0.500000f,   0.500000f,  0.293764f,  -0.500000f,   0.404602f,
-   0.000000f,  -0.400000f,   0.500000f,  0.293764f,  -0.500000f,   0.404602f,
-   0.293764f,  -0.400000f,   0.404602f,  0.000000f,  -0.400000f,   0.500000f,
-   0.293764f,  -0.500000f,   0.404602f,  0.475430f,  -0.500000f,   0.154811f,
-   0.293764f,  -0.400000f,   0.404602f,  0.475430f,  -0.500000f,   0.154811f,
-   0.475430f,  -0.400000f,   0.154811f,  0.293764f,  -0.400000f,   0.404602f,
-   0.475430f,  -0.500000f,   0.154811f,  0.475676f,  -0.500000f,  -0.154054f,
-   0.475430f,  -0.400000f,   0.154811f,  0.475676f,  -0.500000f,  -0.154054f,
-   0.475676f,  -0.400000f,  -0.154054f,  0.475430f,  -0.400000f,   0.154811f,
-   0.475676f,  -0.500000f,  -0.154054f,  0.294408f,  -0.500000f,  -0.404134f,
-   0.475676f,  -0.400000f,  -0.154054f,  0.294408f,  -0.500000f,  -0.404134f,
-   0.294408f,  -0.400000f,  -0.404134f,  0.475676f,  -0.400000f,  -0.154054f,
-   0.294408f,  -0.500000f,  -0.404134f,  0.000796f,  -0.500000f,  -0.499999f,
-   0.294408f,  -0.400000f,  -0.404134f,  0.000796f,  -0.500000f,  -0.499999f,
-   0.000796f,  -0.400000f,  -0.499999f,  0.294408f,  -0.400000f,  -0.404134f,
-   0.000796f,  -0.500000f,  -0.499999f, -0.293119f,  -0.500000f,  -0.405069f,
-   0.000796f,  -0.400000f,  -0.499999f, -0.293119f,  -0.500000f,  -0.405069f,
-  -0.293119f,  -0.400000f,  -0.405069f,  0.000796f,  -0.400000f,  -0.499999f,
-  -0.293119f,  -0.500000f,  -0.405069f, -0.475183f,  -0.500000f,  -0.155568f,
-  -0.293119f,  -0.400000f,  -0.405069f, -0.475183f,  -0.500000f,  -0.155568f,
-  -0.475183f,  -0.400000f,  -0.155568f, -0.293119f,  -0.400000f,  -0.405069f,
-  -0.475183f,  -0.500000f,  -0.155568f, -0.475920f,  -0.500000f,   0.153296f,
-  -0.475183f,  -0.400000f,  -0.155568f, -0.475920f,  -0.500000f,   0.153296f,
-  -0.475920f,  -0.400000f,   0.153296f, -0.475183f,  -0.400000f,  -0.155568f,
-  -0.475920f,  -0.500000f,   0.153296f, -0.295051f,  -0.500000f,   0.403664f,
-  -0.475920f,  -0.400000f,   0.153296f, -0.295051f,  -0.500000f,   0.403664f,
-  -0.295051f,  -0.400000f,   0.403664f, -0.475920f,  -0.400000f,   0.153296f,
-  -0.295051f,  -0.500000f,   0.403664f, -0.001592f,  -0.500000f,   0.499997f,
-  -0.295051f,  -0.400000f,   0.403664f, -0.001592f,  -0.500000f,   0.499997f,
-  -0.001592f,  -0.400000f,   0.499997f, -0.295051f,  -0.400000f,   0.403664f,
-  -0.001592f,  -0.400000f,   0.499997f,  0.292474f,  -0.400000f,   0.405535f,
-  -0.001592f,  -0.300000f,   0.499997f,  0.292474f,  -0.400000f,   0.405535f,
-   0.292474f,  -0.300000f,   0.405535f, -0.001592f,  -0.300000f,   0.499997f,
-   0.292474f,  -0.400000f,   0.405535f,  0.474934f,  -0.400000f,   0.156324f,
-   0.292474f,  -0.300000f,   0.405535f,  0.474934f,  -0.400000f,   0.156324f,
-   0.474934f,  -0.300000f,   0.156324f,  0.292474f,  -0.300000f,   0.405535f,
-   0.474934f,  -0.400000f,   0.156324f,  0.476164f,  -0.400000f,  -0.152539f,
-   0.474934f,  -0.300000f,   0.156324f,  0.476164f,  -0.400000f,  -0.152539f,
-   0.476164f,  -0.300000f,  -0.152539f,  0.474934f,  -0.300000f,   0.156324f,
-   0.476164f,  -0.400000f,  -0.152539f,  0.295693f,  -0.400000f,  -0.403194f,
-   0.476164f,  -0.300000f,  -0.152539f,  0.295693f,  -0.400000f,  -0.403194f,
-   0.295693f,  -0.300000f,  -0.403194f,  0.476164f,  -0.300000f,  -0.152539f,
-   0.295693f,  -0.400000f,  -0.403194f,  0.002388f,  -0.400000f,  -0.499994f,
-   0.295693f,  -0.300000f,  -0.403194f,  0.002388f,  -0.400000f,  -0.499994f,
-   0.002388f,  -0.300000f,  -0.499994f,  0.295693f,  -0.300000f,  -0.403194f,
-   0.002388f,  -0.400000f,  -0.499994f, -0.291828f,  -0.400000f,  -0.406000f,
-   0.002388f,  -0.300000f,  -0.499994f, -0.291828f,  -0.400000f,  -0.406000f,
-  -0.291828f,  -0.300000f,  -0.406000f,  0.002388f,  -0.300000f,  -0.499994f,
-  -0.291828f,  -0.400000f,  -0.406000f, -0.474685f,  -0.400000f,  -0.157080f,
-  -0.291828f,  -0.300000f,  -0.406000f, -0.474685f,  -0.400000f,  -0.157080f,
-  -0.474685f,  -0.300000f,  -0.157080f, -0.291828f,  -0.300000f,  -0.406000f,
-  -0.474685f,  -0.400000f,  -0.157080f, -0.476406f,  -0.400000f,   0.151781f,
-  -0.474685f,  -0.300000f,  -0.157080f, -0.476406f,  -0.400000f,   0.151781f,
-  -0.476406f,  -0.300000f,   0.151781f, -0.474685f,  -0.300000f,  -0.157080f,
-  -0.476406f,  -0.400000f,   0.151781f, -0.296334f,  -0.400000f,   0.402723f,
-  -0.476406f,  -0.300000f,   0.151781f, -0.296334f,  -0.400000f,   0.402723f,
-  -0.296334f,  -0.300000f,   0.402723f, -0.476406f,  -0.300000f,   0.151781f,
-  -0.296334f,  -0.400000f,   0.402723f, -0.003184f,  -0.400000f,   0.499990f,
-  -0.296334f,  -0.300000f,   0.402723f, -0.003184f,  -0.400000f,   0.499990f,
-  -0.003184f,  -0.300000f,   0.499990f, -0.296334f,  -0.300000f,   0.402723f,
-  -0.003184f,  -0.300000f,   0.499990f,  0.291182f,  -0.300000f,   0.406464f,
-  -0.003184f,  -0.200000f,   0.499990f,  0.291182f,  -0.300000f,   0.406464f,
-   0.291182f,  -0.200000f,   0.406464f, -0.003184f,  -0.200000f,   0.499990f,
-   0.291182f,  -0.300000f,   0.406464f,  0.474434f,  -0.300000f,   0.157835f,
-   0.291182f,  -0.200000f,   0.406464f,  0.474434f,  -0.300000f,   0.157835f,
-   0.474434f,  -0.200000f,   0.157835f,  0.291182f,  -0.200000f,   0.406464f,
-   0.474434f,  -0.300000f,   0.157835f,  0.476647f,  -0.300000f,  -0.151022f,
-   0.474434f,  -0.200000f,   0.157835f,  0.476647f,  -0.300000f,  -0.151022f,
-   0.476647f,  -0.200000f,  -0.151022f,  0.474434f,  -0.200000f,   0.157835f,
-   0.476647f,  -0.300000f,  -0.151022f,  0.296975f,  -0.300000f,  -0.402251f,
-   0.476647f,  -0.200000f,  -0.151022f,  0.296975f,  -0.300000f,  -0.402251f,
-   0.296975f,  -0.200000f,  -0.402251f,  0.476647f,  -0.200000f,  -0.151022f,
-   0.296975f,  -0.300000f,  -0.402251f,  0.003979f,  -0.300000f,  -0.499984f,
-   0.296975f,  -0.200000f,  -0.402251f,  0.003979f,  -0.300000f,  -0.499984f,
-   0.003979f,  -0.200000f,  -0.499984f,  0.296975f,  -0.200000f,  -0.402251f,
-   0.003979f,  -0.300000f,  -0.499984f, -0.290534f,  -0.300000f,  -0.406927f,
-   0.003979f,  -0.200000f,  -0.499984f, -0.290534f,  -0.300000f,  -0.406927f,
-  -0.290534f,  -0.200000f,  -0.406927f,  0.003979f,  -0.200000f,  -0.499984f,
-  -0.290534f,  -0.300000f,  -0.406927f, -0.474183f,  -0.300000f,  -0.158590f,
-  -0.290534f,  -0.200000f,  -0.406927f, -0.474183f,  -0.300000f,  -0.158590f,
-  -0.474183f,  -0.200000f,  -0.158590f, -0.290534f,  -0.200000f,  -0.406927f,
-  -0.474183f,  -0.300000f,  -0.158590f, -0.476887f,  -0.300000f,   0.150264f,
-  -0.474183f,  -0.200000f,  -0.158590f, -0.476887f,  -0.300000f,   0.150264f,
-  -0.476887f,  -0.200000f,   0.150264f, -0.474183f,  -0.200000f,  -0.158590f,
-  -0.476887f,  -0.300000f,   0.150264f, -0.297614f,  -0.300000f,   0.401778f,
-  -0.476887f,  -0.200000f,   0.150264f, -0.297614f,  -0.300000f,   0.401778f,
-  -0.297614f,  -0.200000f,   0.401778f, -0.476887f,  -0.200000f,   0.150264f,
-  -0.297614f,  -0.300000f,   0.401778f, -0.004775f,  -0.300000f,   0.499977f,
-  -0.297614f,  -0.200000f,   0.401778f, -0.004775f,  -0.300000f,   0.499977f,
-  -0.004775f,  -0.200000f,   0.499977f, -0.297614f,  -0.200000f,   0.401778f,
-  -0.004775f,  -0.200000f,   0.499977f,  0.289887f,  -0.200000f,   0.407389f,
-  -0.004775f,  -0.100000f,   0.499977f,  0.289887f,  -0.200000f,   0.407389f,
-   0.289887f,  -0.100000f,   0.407389f, -0.004775f,  -0.100000f,   0.499977f,
-   0.289887f,  -0.200000f,   0.407389f,  0.473930f,  -0.200000f,   0.159344f,
-   0.289887f,  -0.100000f,   0.407389f,  0.473930f,  -0.200000f,   0.159344f,
-   0.473930f,  -0.100000f,   0.159344f,  0.289887f,  -0.100000f,   0.407389f,
-   0.473930f,  -0.200000f,   0.159344f,  0.477125f,  -0.200000f,  -0.149505f,
-   0.473930f,  -0.100000f,   0.159344f,  0.477125f,  -0.200000f,  -0.149505f,
-   0.477125f,  -0.100000f,  -0.149505f,  0.473930f,  -0.100000f,   0.159344f,
-   0.477125f,  -0.200000f,  -0.149505f,  0.298253f,  -0.200000f,  -0.401304f,
-   0.477125f,  -0.100000f,  -0.149505f,  0.298253f,  -0.200000f,  -0.401304f,
-   0.298253f,  -0.100000f,  -0.401304f,  0.477125f,  -0.100000f,  -0.149505f,
-   0.298253f,  -0.200000f,  -0.401304f,  0.005571f,  -0.200000f,  -0.499969f,
-   0.298253f,  -0.100000f,  -0.401304f,  0.005571f,  -0.200000f,  -0.499969f,
-   0.005571f,  -0.100000f,  -0.499969f,  0.298253f,  -0.100000f,  -0.401304f,
-   0.005571f,  -0.200000f,  -0.499969f, -0.289238f,  -0.200000f,  -0.407850f,
-   0.005571f,  -0.100000f,  -0.499969f, -0.289238f,  -0.200000f,  -0.407850f,
-  -0.289238f,  -0.100000f,  -0.407850f,  0.005571f,  -0.100000f,  -0.499969f,
-  -0.289238f,  -0.200000f,  -0.407850f, -0.473676f,  -0.200000f,  -0.160098f,
-  -0.289238f,  -0.100000f,  -0.407850f, -0.473676f,  -0.200000f,  -0.160098f,
-  -0.473676f,  -0.100000f,  -0.160098f, -0.289238f,  -0.100000f,  -0.407850f,
-  -0.473676f,  -0.200000f,  -0.160098f, -0.477362f,  -0.200000f,   0.148745f,
-  -0.473676f,  -0.100000f,  -0.160098f, -0.477362f,  -0.200000f,   0.148745f,
-  -0.477362f,  -0.100000f,   0.148745f, -0.473676f,  -0.100000f,  -0.160098f,
-  -0.477362f,  -0.200000f,   0.148745f, -0.298892f,  -0.200000f,   0.400829f,
-  -0.477362f,  -0.100000f,   0.148745f, -0.298892f,  -0.200000f,   0.400829f,
-  -0.298892f,  -0.100000f,   0.400829f, -0.477362f,  -0.100000f,   0.148745f,
-  -0.298892f,  -0.200000f,   0.400829f, -0.006366f,  -0.200000f,   0.499959f,
-  -0.298892f,  -0.100000f,   0.400829f, -0.006366f,  -0.200000f,   0.499959f,
-  -0.006366f,  -0.100000f,   0.499959f, -0.298892f,  -0.100000f,   0.400829f,
-  -0.006366f,  -0.100000f,   0.499959f,  0.288588f,  -0.100000f,   0.408310f,
-  -0.006366f,  -0.000000f,   0.499959f,  0.288588f,  -0.100000f,   0.408310f,
-   0.288588f,  -0.000000f,   0.408310f, -0.006366f,  -0.000000f,   0.499959f,
-   0.288588f,  -0.100000f,   0.408310f,  0.473420f,  -0.100000f,   0.160852f,
-   0.288588f,  -0.000000f,   0.408310f,  0.473420f,  -0.100000f,   0.160852f,
-   0.473420f,  -0.000000f,   0.160852f,  0.288588f,  -0.000000f,   0.408310f,
-   0.473420f,  -0.100000f,   0.160852f,  0.477598f,  -0.100000f,  -0.147985f,
-   0.473420f,  -0.000000f,   0.160852f,  0.477598f,  -0.100000f,  -0.147985f,
-   0.477598f,  -0.000000f,  -0.147985f,  0.473420f,  -0.000000f,   0.160852f,
-   0.477598f,  -0.100000f,  -0.147985f,  0.299529f,  -0.100000f,  -0.400353f,
-   0.477598f,  -0.000000f,  -0.147985f,  0.299529f,  -0.100000f,  -0.400353f,
-   0.299529f,  -0.000000f,  -0.400353f,  0.477598f,  -0.000000f,  -0.147985f,
-   0.299529f,  -0.100000f,  -0.400353f,  0.007162f,  -0.100000f,  -0.499949f,
-   0.299529f,  -0.000000f,  -0.400353f,  0.007162f,  -0.100000f,  -0.499949f,
-   0.007162f,  -0.000000f,  -0.499949f,  0.299529f,  -0.000000f,  -0.400353f,
-   0.007162f,  -0.100000f,  -0.499949f, -0.287938f,  -0.100000f,  -0.408768f,
-   0.007162f,  -0.000000f,  -0.499949f, -0.287938f,  -0.100000f,  -0.408768f,
-  -0.287938f,  -0.000000f,  -0.408768f,  0.007162f,  -0.000000f,  -0.499949f,
-  -0.287938f,  -0.100000f,  -0.408768f, -0.473164f,  -0.100000f,  -0.161605f,
-  -0.287938f,  -0.000000f,  -0.408768f, -0.473164f,  -0.100000f,  -0.161605f,
-  -0.473164f,  -0.000000f,  -0.161605f, -0.287938f,  -0.000000f,  -0.408768f,
-  -0.473164f,  -0.100000f,  -0.161605f, -0.477833f,  -0.100000f,   0.147225f,
-  -0.473164f,  -0.000000f,  -0.161605f, -0.477833f,  -0.100000f,   0.147225f,
-  -0.477833f,  -0.000000f,   0.147225f, -0.473164f,  -0.000000f,  -0.161605f,
-  -0.477833f,  -0.100000f,   0.147225f, -0.300166f,  -0.100000f,   0.399876f,
-  -0.477833f,  -0.000000f,   0.147225f, -0.300166f,  -0.100000f,   0.399876f,
-  -0.300166f,  -0.000000f,   0.399876f, -0.477833f,  -0.000000f,   0.147225f,
-  -0.300166f,  -0.100000f,   0.399876f, -0.007957f,  -0.100000f,   0.499937f,
-  -0.300166f,  -0.000000f,   0.399876f, -0.007957f,  -0.100000f,   0.499937f,
-  -0.007957f,  -0.000000f,   0.499937f, -0.300166f,  -0.000000f,   0.399876f,
-  -0.007957f,  -0.000000f,   0.499937f,  0.287288f,  -0.000000f,   0.409226f,
-  -0.007957f,   0.100000f,   0.499937f,  0.287288f,  -0.000000f,   0.409226f,
-   0.287288f,   0.100000f,   0.409226f, -0.007957f,   0.100000f,   0.499937f,
-   0.287288f,  -0.000000f,   0.409226f,  0.472905f,  -0.000000f,   0.162359f,
-   0.287288f,   0.100000f,   0.409226f,  0.472905f,  -0.000000f,   0.162359f,
-   0.472905f,   0.100000f,   0.162359f,  0.287288f,   0.100000f,   0.409226f,
-   0.472905f,  -0.000000f,   0.162359f,  0.478068f,  -0.000000f,  -0.146463f,
-   0.472905f,   0.100000f,   0.162359f,  0.478068f,  -0.000000f,  -0.146463f,
-   0.478068f,   0.100000f,  -0.146463f,  0.472905f,   0.100000f,   0.162359f,
-   0.478068f,  -0.000000f,  -0.146463f,  0.300804f,  -0.000000f,  -0.399396f,
-   0.478068f,   0.100000f,  -0.146463f,  0.300804f,  -0.000000f,  -0.399396f,
-   0.300804f,   0.100000f,  -0.399396f,  0.478068f,   0.100000f,  -0.146463f,
-   0.300804f,  -0.000000f,  -0.399396f,  0.008757f,  -0.000000f,  -0.499923f,
-   0.300804f,   0.100000f,  -0.399396f,  0.008757f,  -0.000000f,  -0.499923f,
-   0.008757f,   0.100000f,  -0.499923f,  0.300804f,   0.100000f,  -0.399396f,
-   0.008757f,  -0.000000f,  -0.499923f, -0.286632f,  -0.000000f,  -0.409685f,
-   0.008757f,   0.100000f,  -0.499923f, -0.286632f,  -0.000000f,  -0.409685f,
-  -0.286632f,   0.100000f,  -0.409685f,  0.008757f,   0.100000f,  -0.499923f,
-  -0.286632f,  -0.000000f,  -0.409685f, -0.472645f,  -0.000000f,  -0.163116f,
-  -0.286632f,   0.100000f,  -0.409685f, -0.472645f,  -0.000000f,  -0.163116f,
-  -0.472645f,   0.100000f,  -0.163116f, -0.286632f,   0.100000f,  -0.409685f,
-  -0.472645f,  -0.000000f,  -0.163116f, -0.478301f,  -0.000000f,   0.145697f,
-  -0.472645f,   0.100000f,  -0.163116f, -0.478301f,  -0.000000f,   0.145697f,
-  -0.478301f,   0.100000f,   0.145697f, -0.472645f,   0.100000f,  -0.163116f,
-  -0.478301f,  -0.000000f,   0.145697f, -0.301443f,  -0.000000f,   0.398914f,
-  -0.478301f,   0.100000f,   0.145697f, -0.301443f,  -0.000000f,   0.398914f,
-  -0.301443f,   0.100000f,   0.398914f, -0.478301f,   0.100000f,   0.145697f,
-  -0.301443f,  -0.000000f,   0.398914f, -0.009557f,  -0.000000f,   0.499909f,
-  -0.301443f,   0.100000f,   0.398914f, -0.009557f,  -0.000000f,   0.499909f,
-  -0.009557f,   0.100000f,   0.499909f, -0.301443f,   0.100000f,   0.398914f,
-  -0.009557f,   0.100000f,   0.499909f,  0.285976f,   0.100000f,   0.410144f,
-  -0.009557f,   0.200000f,   0.499909f,  0.285976f,   0.100000f,   0.410144f,
-   0.285976f,   0.200000f,   0.410144f, -0.009557f,   0.200000f,   0.499909f,
-   0.285976f,   0.100000f,   0.410144f,  0.472383f,   0.100000f,   0.163872f,
-   0.285976f,   0.200000f,   0.410144f,  0.472383f,   0.100000f,   0.163872f,
-   0.472383f,   0.200000f,   0.163872f,  0.285976f,   0.200000f,   0.410144f,
-   0.472383f,   0.100000f,   0.163872f,  0.478534f,   0.100000f,  -0.144931f,
-   0.472383f,   0.200000f,   0.163872f,  0.478534f,   0.100000f,  -0.144931f,
-   0.478534f,   0.200000f,  -0.144931f,  0.472383f,   0.200000f,   0.163872f,
-   0.478534f,   0.100000f,  -0.144931f,  0.302081f,   0.100000f,  -0.398431f,
-   0.478534f,   0.200000f,  -0.144931f,  0.302081f,   0.100000f,  -0.398431f,
-   0.302081f,   0.200000f,  -0.398431f,  0.478534f,   0.200000f,  -0.144931f,
-   0.302081f,   0.100000f,  -0.398431f,  0.010357f,   0.100000f,  -0.499893f,
-   0.302081f,   0.200000f,  -0.398431f,  0.010357f,   0.100000f,  -0.499893f,
-   0.010357f,   0.200000f,  -0.499893f,  0.302081f,   0.200000f,  -0.398431f,
-   0.010357f,   0.100000f,  -0.499893f, -0.285319f,   0.100000f,  -0.410601f,
-   0.010357f,   0.200000f,  -0.499893f, -0.285319f,   0.100000f,  -0.410601f,
-  -0.285319f,   0.200000f,  -0.410601f,  0.010357f,   0.200000f,  -0.499893f,
-  -0.285319f,   0.100000f,  -0.410601f, -0.472120f,   0.100000f,  -0.164628f,
-  -0.285319f,   0.200000f,  -0.410601f, -0.472120f,   0.100000f,  -0.164628f,
-  -0.472120f,   0.200000f,  -0.164628f, -0.285319f,   0.200000f,  -0.410601f,
-  -0.472120f,   0.100000f,  -0.164628f, -0.478766f,   0.100000f,   0.144165f,
-  -0.472120f,   0.200000f,  -0.164628f, -0.478766f,   0.100000f,   0.144165f,
-  -0.478766f,   0.200000f,   0.144165f, -0.472120f,   0.200000f,  -0.164628f,
-  -0.478766f,   0.100000f,   0.144165f, -0.302719f,   0.100000f,   0.397946f,
-  -0.478766f,   0.200000f,   0.144165f, -0.302719f,   0.100000f,   0.397946f,
-  -0.302719f,   0.200000f,   0.397946f, -0.478766f,   0.200000f,   0.144165f,
-  -0.302719f,   0.100000f,   0.397946f, -0.011158f,   0.100000f,   0.499875f,
-  -0.302719f,   0.200000f,   0.397946f, -0.011158f,   0.100000f,   0.499875f,
-  -0.011158f,   0.200000f,   0.499875f, -0.302719f,   0.200000f,   0.397946f,
-  -0.011158f,   0.200000f,   0.499875f,  0.284661f,   0.200000f,   0.411057f,
-  -0.011158f,   0.300000f,   0.499875f,  0.284661f,   0.200000f,   0.411057f,
-   0.284661f,   0.300000f,   0.411057f, -0.011158f,   0.300000f,   0.499875f,
-   0.284661f,   0.200000f,   0.411057f,  0.471856f,   0.200000f,   0.165384f,
-   0.284661f,   0.300000f,   0.411057f,  0.471856f,   0.200000f,   0.165384f,
-   0.471856f,   0.300000f,   0.165384f,  0.284661f,   0.300000f,   0.411057f,
-   0.471856f,   0.200000f,   0.165384f,  0.478996f,   0.200000f,  -0.143398f,
-   0.471856f,   0.300000f,   0.165384f,  0.478996f,   0.200000f,  -0.143398f,
-   0.478996f,   0.300000f,  -0.143398f,  0.471856f,   0.300000f,   0.165384f,
-   0.478996f,   0.200000f,  -0.143398f,  0.303355f,   0.200000f,  -0.397461f,
-   0.478996f,   0.300000f,  -0.143398f,  0.303355f,   0.200000f,  -0.397461f,
-   0.303355f,   0.300000f,  -0.397461f,  0.478996f,   0.300000f,  -0.143398f,
-   0.303355f,   0.200000f,  -0.397461f,  0.011958f,   0.200000f,  -0.499857f,
-   0.303355f,   0.300000f,  -0.397461f,  0.011958f,   0.200000f,  -0.499857f,
-   0.011958f,   0.300000f,  -0.499857f,  0.303355f,   0.300000f,  -0.397461f,
-   0.011958f,   0.200000f,  -0.499857f, -0.284003f,   0.200000f,  -0.411512f,
-   0.011958f,   0.300000f,  -0.499857f, -0.284003f,   0.200000f,  -0.411512f,
-  -0.284003f,   0.300000f,  -0.411512f,  0.011958f,   0.300000f,  -0.499857f,
-  -0.284003f,   0.200000f,  -0.411512f, -0.471591f,   0.200000f,  -0.166139f,
-  -0.284003f,   0.300000f,  -0.411512f, -0.471591f,   0.200000f,  -0.166139f,
-  -0.471591f,   0.300000f,  -0.166139f, -0.284003f,   0.300000f,  -0.411512f,
-  -0.471591f,   0.200000f,  -0.166139f, -0.479225f,   0.200000f,   0.142631f,
-  -0.471591f,   0.300000f,  -0.166139f, -0.479225f,   0.200000f,   0.142631f,
-  -0.479225f,   0.300000f,   0.142631f, -0.471591f,   0.300000f,  -0.166139f,
-  -0.479225f,   0.200000f,   0.142631f, -0.303991f,   0.200000f,   0.396975f,
-  -0.479225f,   0.300000f,   0.142631f, -0.303991f,   0.200000f,   0.396975f,
-  -0.303991f,   0.300000f,   0.396975f, -0.479225f,   0.300000f,   0.142631f,
-  -0.303991f,   0.200000f,   0.396975f, -0.012758f,   0.200000f,   0.499837f,
-  -0.303991f,   0.300000f,   0.396975f, -0.012758f,   0.200000f,   0.499837f,
-  -0.012758f,   0.300000f,   0.499837f, -0.303991f,   0.300000f,   0.396975f,
-  -0.012758f,   0.300000f,   0.499837f,  0.283344f,   0.300000f,   0.411967f,
-  -0.012758f,   0.400000f,   0.499837f,  0.283344f,   0.300000f,   0.411967f,
-   0.283344f,   0.400000f,   0.411967f, -0.012758f,   0.400000f,   0.499837f,
-   0.283344f,   0.300000f,   0.411967f,  0.471324f,   0.300000f,   0.166894f,
-   0.283344f,   0.400000f,   0.411967f,  0.471324f,   0.300000f,   0.166894f,
-   0.471324f,   0.400000f,   0.166894f,  0.283344f,   0.400000f,   0.411967f,
-   0.471324f,   0.300000f,   0.166894f,  0.479452f,   0.300000f,  -0.141864f,
-   0.471324f,   0.400000f,   0.166894f,  0.479452f,   0.300000f,  -0.141864f,
-   0.479452f,   0.400000f,  -0.141864f,  0.471324f,   0.400000f,   0.166894f,
-   0.479452f,   0.300000f,  -0.141864f,  0.304626f,   0.300000f,  -0.396488f,
-   0.479452f,   0.400000f,  -0.141864f,  0.304626f,   0.300000f,  -0.396488f,
-   0.304626f,   0.400000f,  -0.396488f,  0.479452f,   0.400000f,  -0.141864f,
-   0.304626f,   0.300000f,  -0.396488f,  0.013558f,   0.300000f,  -0.499816f,
-   0.304626f,   0.400000f,  -0.396488f,  0.013558f,   0.300000f,  -0.499816f,
-   0.013558f,   0.400000f,  -0.499816f,  0.304626f,   0.400000f,  -0.396488f,
-   0.013558f,   0.300000f,  -0.499816f, -0.282684f,   0.300000f,  -0.412420f,
-   0.013558f,   0.400000f,  -0.499816f, -0.282684f,   0.300000f,  -0.412420f,
-  -0.282684f,   0.400000f,  -0.412420f,  0.013558f,   0.400000f,  -0.499816f,
-  -0.282684f,   0.300000f,  -0.412420f, -0.471056f,   0.300000f,  -0.167648f,
-  -0.282684f,   0.400000f,  -0.412420f, -0.471056f,   0.300000f,  -0.167648f,
-  -0.471056f,   0.400000f,  -0.167648f, -0.282684f,   0.400000f,  -0.412420f,
-  -0.471056f,   0.300000f,  -0.167648f, -0.479679f,   0.300000f,   0.141096f,
-  -0.471056f,   0.400000f,  -0.167648f, -0.479679f,   0.300000f,   0.141096f,
-  -0.479679f,   0.400000f,   0.141096f, -0.471056f,   0.400000f,  -0.167648f,
-  -0.479679f,   0.300000f,   0.141096f, -0.305261f,   0.300000f,   0.396000f,
-  -0.479679f,   0.400000f,   0.141096f, -0.305261f,   0.300000f,   0.396000f,
-  -0.305261f,   0.400000f,   0.396000f, -0.479679f,   0.400000f,   0.141096f,
-  -0.305261f,   0.300000f,   0.396000f, -0.014358f,   0.300000f,   0.499794f,
-  -0.305261f,   0.400000f,   0.396000f, -0.014358f,   0.300000f,   0.499794f,
-  -0.014358f,   0.400000f,   0.499794f, -0.305261f,   0.400000f,   0.396000f,
-  -0.014358f,   0.400000f,   0.499794f,  0.282023f,   0.400000f,   0.412872f,
-  -0.014358f,   0.500000f,   0.499794f,  0.282023f,   0.400000f,   0.412872f,
-   0.282023f,   0.500000f,   0.412872f, -0.014358f,   0.500000f,   0.499794f,
-   0.282023f,   0.400000f,   0.412872f,  0.470787f,   0.400000f,   0.168402f,
-   0.282023f,   0.500000f,   0.412872f,  0.470787f,   0.400000f,   0.168402f,
-   0.470787f,   0.500000f,   0.168402f,  0.282023f,   0.500000f,   0.412872f,
-   0.470787f,   0.400000f,   0.168402f,  0.479904f,   0.400000f,  -0.140328f,
-   0.470787f,   0.500000f,   0.168402f,  0.479904f,   0.400000f,  -0.140328f,
-   0.479904f,   0.500000f,  -0.140328f,  0.470787f,   0.500000f,   0.168402f,
-   0.479904f,   0.400000f,  -0.140328f,  0.305894f,   0.400000f,  -0.395511f,
-   0.479904f,   0.500000f,  -0.140328f,  0.305894f,   0.400000f,  -0.395511f,
-   0.305894f,   0.500000f,  -0.395511f,  0.479904f,   0.500000f,  -0.140328f,
-   0.305894f,   0.400000f,  -0.395511f,  0.015158f,   0.400000f,  -0.499770f,
-   0.305894f,   0.500000f,  -0.395511f,  0.015158f,   0.400000f,  -0.499770f,
-   0.015158f,   0.500000f,  -0.499770f,  0.305894f,   0.500000f,  -0.395511f,
-   0.015158f,   0.400000f,  -0.499770f, -0.281362f,   0.400000f,  -0.413323f,
-   0.015158f,   0.500000f,  -0.499770f, -0.281362f,   0.400000f,  -0.413323f,
-  -0.281362f,   0.500000f,  -0.413323f,  0.015158f,   0.500000f,  -0.499770f,
-  -0.281362f,   0.400000f,  -0.413323f, -0.470517f,   0.400000f,  -0.169155f,
-  -0.281362f,   0.500000f,  -0.413323f, -0.470517f,   0.400000f,  -0.169155f,
-  -0.470517f,   0.500000f,  -0.169155f, -0.281362f,   0.500000f,  -0.413323f,
-  -0.470517f,   0.400000f,  -0.169155f, -0.480128f,   0.400000f,   0.139560f,
-  -0.470517f,   0.500000f,  -0.169155f, -0.480128f,   0.400000f,   0.139560f,
-  -0.480128f,   0.500000f,   0.139560f, -0.470517f,   0.500000f,  -0.169155f,
-  -0.480128f,   0.400000f,   0.139560f, -0.306527f,   0.400000f,   0.395020f,
-  -0.480128f,   0.500000f,   0.139560f, -0.306527f,   0.400000f,   0.395020f,
-  -0.306527f,   0.500000f,   0.395020f, -0.480128f,   0.500000f,   0.139560f,
-  -0.306527f,   0.400000f,   0.395020f, -0.015959f,   0.400000f,   0.499745f,
-  -0.306527f,   0.500000f,   0.395020f, -0.015959f,   0.400000f,   0.499745f,
-  -0.015959f,   0.500000f,   0.499745f, -0.306527f,   0.500000f,   0.395020f,
-   0.293764f,   0.500000f,   0.404602f,  0.000000f,   0.500000f,   0.000000f,
-   0.000000f,   0.500000f,   0.500000f,  0.475430f,   0.500000f,   0.154811f,
-   0.000000f,   0.500000f,   0.000000f,  0.293764f,   0.500000f,   0.404602f,
-   0.475676f,   0.500000f,  -0.154054f,  0.000000f,   0.500000f,   0.000000f,
-   0.475430f,   0.500000f,   0.154811f,  0.294408f,   0.500000f,  -0.404134f,
-   0.000000f,   0.500000f,   0.000000f,  0.475676f,   0.500000f,  -0.154054f,
-   0.000796f,   0.500000f,  -0.499999f,  0.000000f,   0.500000f,   0.000000f,
-   0.294408f,   0.500000f,  -0.404134f, -0.293119f,   0.500000f,  -0.405069f,
-   0.000000f,   0.500000f,   0.000000f,  0.000796f,   0.500000f,  -0.499999f,
-  -0.475183f,   0.500000f,  -0.155568f,  0.000000f,   0.500000f,   0.000000f,
-  -0.293119f,   0.500000f,  -0.405069f, -0.475920f,   0.500000f,   0.153296f,
-   0.000000f,   0.500000f,   0.000000f, -0.475183f,   0.500000f,  -0.155568f,
-  -0.295051f,   0.500000f,   0.403664f,  0.000000f,   0.500000f,   0.000000f,
-  -0.475920f,   0.500000f,   0.153296f, -0.001592f,   0.500000f,   0.499997f,
-   0.000000f,   0.500000f,   0.000000f, -0.295051f,   0.500000f,   0.403664f
-};
-
-int cylinderVerticesLength = sizeof(cylinderVertices) / sizeof(float);
-
 //
-// Each group of three values specifies a cylinder triangle
+// makeCone() - create a cone object, with its apex at the top
 //
-int cylinderElements[] = {
-	 0,     1,     2,     3,     4,     5,     6,     7,     8,     9,
-	10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-	20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-	30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-	40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-	50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-	60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-	70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-	80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-	90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
-   100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
-   110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
-   120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
-   130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
-   140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
-   150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
-   160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
-   170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
-   180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-   190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
-   200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
-   210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
-   220,   221,   222,   223,   224,   225,   226,   227,   228,   229,
-   230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-   240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
-   250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
-   260,   261,   262,   263,   264,   265,   266,   267,   268,   269,
-   270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
-   280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
-   290,   291,   292,   293,   294,   295,   296,   297,   298,   299,
-   300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
-   310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
-   320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
-   330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
-   340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
-   350,   351,   352,   353,   354,   355,   356,   357,   358,   359,
-   360,   361,   362,   363,   364,   365,   366,   367,   368,   369,
-   370,   371,   372,   373,   374,   375,   376,   377,   378,   379,
-   380,   381,   382,   383,   384,   385,   386,   387,   388,   389,
-   390,   391,   392,   393,   394,   395,   396,   397,   398,   399,
-   400,   401,   402,   403,   404,   405,   406,   407,   408,   409,
-   410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
-   420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
-   430,   431,   432,   433,   434,   435,   436,   437,   438,   439,
-   440,   441,   442,   443,   444,   445,   446,   447,   448,   449,
-   450,   451,   452,   453,   454,   455,   456,   457,   458,   459,
-   460,   461,   462,   463,   464,   465,   466,   467,   468,   469,
-   470,   471,   472,   473,   474,   475,   476,   477,   478,   479,
-   480,   481,   482,   483,   484,   485,   486,   487,   488,   489,
-   490,   491,   492,   493,   494,   495,   496,   497,   498,   499,
-   500,   501,   502,   503,   504,   505,   506,   507,   508,   509,
-   510,   511,   512,   513,   514,   515,   516,   517,   518,   519,
-   520,   521,   522,   523,   524,   525,   526,   527,   528,   529,
-   530,   531,   532,   533,   534,   535,   536,   537,   538,   539,
-   540,   541,   542,   543,   544,   545,   546,   547,   548,   549,
-   550,   551,   552,   553,   554,   555,   556,   557,   558,   559,
-   560,   561,   562,   563,   564,   565,   566,   567,   568,   569,
-   570,   571,   572,   573,   574,   575,   576,   577,   578,   579,
-   580,   581,   582,   583,   584,   585,   586,   587,   588,   589,
-   590,   591,   592,   593,   594,   595,   596,   597,   598,   599,
-   600,   601,   602,   603,   604,   605,   606,   607,   608,   609,
-   610,   611,   612,   613,   614,   615,   616,   617,   618,   619,
-   620,   621,   622,   623,   624,   625,   626,   627,   628,   629,
-   630,   631,   632,   633,   634,   635,   636,   637,   638,   639,
-   640,   641,   642,   643,   644,   645,   646,   647,   648,   649,
-   650,   651,   652,   653,   654,   655,   656,   657,   658,   659
-};
-
-int cylinderElementsLength = sizeof(cylinderElements) / sizeof(int);
-
-void makeCylinder(Canvas &C) {
-	int i;
-
-	for (i = 0; i < cylinderElementsLength - 2; i += 3) {
-
-		// Calculate the base indices of the three vertices
-		int point1 = 3 * cylinderElements[i];     // slots 0, 1, 2
-		int point2 = 3 * cylinderElements[i + 1]; // slots 3, 4, 5
-		int point3 = 3 * cylinderElements[i + 2]; // slots 6, 7, 8
-
-		Vertex p1 = { cylinderVertices[point1 + 0],
-					  cylinderVertices[point1 + 1],
-					  cylinderVertices[point1 + 2] };
+// @param slices - divisions around the axis (at least 3)
+// @param stacks - divisions from base to apex (at least 1)
+//
+void makeCone(Canvas &C, int slices, int stacks)
+{
+	slices = max(slices, 3);
+	stacks = max(stacks, 1);
+
+	// a ring at the bottom of each stack, an apex vertex for each
+	// slice (the normal there depends on the direction it is seen
+	// from), and the base
+	int nv = stacks * slices + slices + 1 + slices;
+	int nt = 2 * slices * (stacks - 1) + slices + slices;
+
+	float *p, *n;
+	GLuint *e;
+	GLuint base = C.addMesh(nv, nt, &p, &n, &e);
+
+	vector<float> s, c;
+	angles(slices, false, s, c);
+
+	// the side leans in by 0.5 over a height of 1, so its normal is
+	// (1, 0.5) in the (outward, up) plane, normalized
+	float len = sqrtf(1.25f);
+	float nr = 1.0f / len, ny = 0.5f / len;
+
+	for (int i = 0; i < stacks; ++i) {
+		float t = (float) i / stacks;
+		ring(p, n, s, c, 0.5f * (1.0f - t), t - 0.5f, nr, ny);
+	}
+	for (int i = 0; i + 1 < stacks; ++i) {
+		band(e, base + i * slices, base + (i + 1) * slices, slices);
+	}
 
-		Vertex p2 = { cylinderVertices[point2 + 0],
-					  cylinderVertices[point2 + 1],
-					  cylinderVertices[point2 + 2] };
+	// each apex vertex gets the normal halfway across its slice
+	vector<float> hs, hc;
+	angles(slices, true, hs, hc);
+	GLuint top = base + (stacks - 1) * slices;
+	GLuint apex = base + stacks * slices;
+	ring(p, n, hs, hc, 0.0f, 0.5f, nr, ny);
+	for (int j = 0; j < slices; ++j) {
+		GLuint k = (j + 1 == slices) ? 0 : j + 1;
+		*e++ = top + j; *e++ = top + k; *e++ = apex + j;
+	}
 
-		Vertex p3 = { cylinderVertices[point3 + 0],
-					  cylinderVertices[point3 + 1],
-					  cylinderVertices[point3 + 2] };
+	cap(p, n, e, apex + slices, s, c, -0.5f, false);
+}
 
-		// Calculate the base indices of the three normals
-		int normal1 = 3 * cylinderElements[i];     // slots 0, 1, 2
-		int normal2 = 3 * cylinderElements[i + 1]; // slots 3, 4, 5
-		int normal3 = 3 * cylinderElements[i + 2]; // slots 6, 7, 8
+//
+// makeCylinder() - create a cylinder object
+//
+// @param slices - divisions around the axis (at least 3)
+// @param stacks - divisions from bottom to top (at least 1)
+//
+void makeCylinder(Canvas &C, int slices, int stacks)
+{
+	slices = max(slices, 3);
+	stacks = max(stacks, 1);
 
-		Normal n1 = { cylinderVertices[normal1 + 0],
-					  cylinderVertices[normal1 + 1],
-					  cylinderVertices[normal1 + 2] };
+	// a ring at each end of each stack, and the two ends
+	int nv = (stacks + 1) * slices + 2 * (slices + 1);
+	int nt = 2 * slices * stacks + 2 * slices;
 
-		Normal n2 = { cylinderVertices[normal2 + 0],
-					  cylinderVertices[normal2 + 1],
-					  cylinderVertices[normal2 + 2] };
+	float *p, *n;
+	GLuint *e;
+	GLuint base = C.addMesh(nv, nt, &p, &n, &e);
 
-		Normal n3 = { cylinderVertices[normal3 + 0],
-					  cylinderVertices[normal3 + 1],
-					  cylinderVertices[normal3 + 2] };
+	vector<float> s, c;
+	angles(slices, false, s, c);
 
-		// Add triangle and vertex normals
-		C.addTriangleWithNorms(p1, n1, p2, n2, p3, n3);
+	for (int i = 0; i <= stacks; ++i) {
+		ring(p, n, s, c, 0.5f, (float) i / stacks - 0.5f, 1.0f, 0.0f);
+	}
+	for (int i = 0; i < stacks; ++i) {
+		band(e, base + i * slices, base + (i + 1) * slices, slices);
 	}
+
+	GLuint ends = base + (stacks + 1) * slices;
+	cap(p, n, e, ends, s, c, -0.5f, false);
+	cap(p, n, e, ends + slices + 1, s, c, 0.5f, true);
 }
 
 ///
@@ -2403,7 +249,7 @@ void drawShape(GLuint shader, int obj,  BufferSet &bset, Tuple scale,Tuple rotat
 
 
 
-	glUseProgram(shader);
+	stUseProgram(shader);
 	setUpProjection(shader);
 	setUpCamera(shader, eye, lookat, up);
 	setUpTransforms(shader, scale, rotation, xlate);
@@ -2411,7 +257,6 @@ void drawShape(GLuint shader, int obj,  BufferSet &bset, Tuple scale,Tuple rotat
 	{
 	case OBJ_QUAD:
 		setUpTextures(shader, obj);
-		std::cout << "drawing texture" << std::endl;
 		bset.selectBuffers(shader, "vPosition", NULL, "vNormal", "vTexCoord");
 		break;
 	default:
@@ -2430,6 +275,29 @@ void drawShape(GLuint shader, int obj,  BufferSet &bset, Tuple scale,Tuple rotat
 	//}
 
 	// draw it
-	glDrawElements(GL_TRIANGLES, bset.numElements,
-		GL_UNSIGNED_INT, (void *)0);
-}
\ No newline at end of file
+	glDrawElementsBaseVertex(GL_TRIANGLES, bset.numElements,
+		GL_UNSIGNED_INT, bset.indexOffset(), bset.baseVertex());
+}
+
+///
+//	drawInstances - Draw every instance of a mesh in one call
+///
+void drawInstances(GLuint shader, InstanceSet &inst, Tuple eye, Tuple lookat, Tuple up) {
+	if (inst.instances.empty()) {
+		return;
+	}
+
+	stUseProgram(shader);
+	setUpProjection(shader);
+	setUpCamera(shader, eye, lookat, up);
+	setUpLight();
+
+	inst.buffers->selectBuffers(shader, "vPosition", NULL, "vNormal", NULL);
+	inst.upload();
+	inst.select(shader, "iModel", "iNormal", "iMaterial");
+
+	glDrawElementsInstancedBaseVertex(GL_TRIANGLES,
+		inst.buffers->numElements, GL_UNSIGNED_INT,
+		inst.buffers->indexOffset(), inst.uploaded,
+		inst.buffers->baseVertex());
+}
@@ -18,6 +18,7 @@
 #include "Canvas.h"
 #include "Buffers.h"
 #include "Tuple.h"
+#include "Instances.h"
 
 #define OBJ_CONE	3
 #define OBJ_CYLINDER 4
@@ -35,15 +36,31 @@
 #define MATL_LEAF 15
 
 ///
-// makeSphere
+// Default tessellations of the generated shapes
+///
+#define SPHERE_SLICES	10
+#define SPHERE_STACKS	10
+#define CONE_SLICES	20
+#define CONE_STACKS	20
+#define CYLINDER_SLICES	10
+#define CYLINDER_STACKS	10
+
+///
+// makeSphere, makeCone, makeCylinder
 //
-// Invoked whenever a sphere must be created
+// Invoked whenever a sphere, cone or cylinder must be created; each is
+// added to the Canvas as an indexed mesh with exact normals
 //
-// @param C - Canvas being used
+// @param C      - Canvas being used
+// @param slices - divisions around the axis (at least 3)
+// @param stacks - divisions along the axis (at least 2 for the
+//                 sphere, 1 for the others)
 ///
-void makeSphere( Canvas &C );
-void makeCone(Canvas &C);
-void makeCylinder(Canvas &C);
+void makeSphere( Canvas &C, int slices = SPHERE_SLICES,
+	int stacks = SPHERE_STACKS );
+void makeCone(Canvas &C, int slices = CONE_SLICES, int stacks = CONE_STACKS);
+void makeCylinder(Canvas &C, int slices = CYLINDER_SLICES,
+	int stacks = CYLINDER_STACKS);
 ///
 // drawSphere
 //
@@ -54,4 +71,13 @@ void makeCylinder(Canvas &C);
 // @param bset    - the BufferSet containing the object's data
 ///
 void drawShape(GLuint pshader,int obj, BufferSet &bset, Tuple scale,Tuple rotation, Tuple xlate, Tuple eye, Tuple lookat, Tuple up);
+///
+// drawInstances
+//
+// Draws all the instances of one mesh with a single instanced draw
+//
+// @param ishader - shader program for instanced Phong shading
+// @param inst    - the mesh and its instances
+///
+void drawInstances(GLuint ishader, InstanceSet &inst, Tuple eye, Tuple lookat, Tuple up);
 #endif
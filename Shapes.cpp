@@ -525,48 +525,9 @@ int teapotNormalIndicesLength = sizeof(teapotNormalIndices) / sizeof(int);
 //
 void makeTeapot(Canvas &C)
 {
-	int i;
-
-	for (i = 0; i < teapotElementsLength - 2; i += 3) {
-
-		// Calculate the base indices of the three vertices
-		int point1 = 3 * teapotElements[i];     // slots 0, 1, 2
-		int point2 = 3 * teapotElements[i + 1]; // slots 3, 4, 5
-		int point3 = 3 * teapotElements[i + 2]; // slots 6, 7, 8
-
-		Vertex p1 = { teapotVertices[point1 + 0],
-					  teapotVertices[point1 + 1],
-					  teapotVertices[point1 + 2] };
-
-		Vertex p2 = { teapotVertices[point2 + 0],
-					  teapotVertices[point2 + 1],
-					  teapotVertices[point2 + 2] };
-
-		Vertex p3 = { teapotVertices[point3 + 0],
-					  teapotVertices[point3 + 1],
-					  teapotVertices[point3 + 2] };
-
-		// Calculate the base indices of the three normals
-		int normal1 = 3 * teapotNormalIndices[i];     // slots 0, 1, 2
-		int normal2 = 3 * teapotNormalIndices[i + 1]; // slots 3, 4, 5
-		int normal3 = 3 * teapotNormalIndices[i + 2]; // slots 6, 7, 8
-
-		Normal n1 = { teapotNormals[normal1 + 0],
-					  teapotNormals[normal1 + 1],
-					  teapotNormals[normal1 + 2] };
-
-		Normal n2 = { teapotNormals[normal2 + 0],
-					  teapotNormals[normal2 + 1],
-					  teapotNormals[normal2 + 2] };
-
-		Normal n3 = { teapotNormals[normal3 + 0],
-					  teapotNormals[normal3 + 1],
-					  teapotNormals[normal3 + 2] };
-
-		// Add triangle and vertex normals
-		C.addTriangleWithNorms(p1, n1, p2, n2, p3, n3);
-
-	}
+	// vertices and normals are indexed separately
+	C.addTriangles(teapotElementsLength / 3, teapotVertices, teapotNormals,
+		NULL, teapotElements, teapotNormalIndices);
 }
 
 /*
@@ -650,37 +611,7 @@ int quadElementsLength = sizeof(quadElements) / sizeof(int);
 //
 void makeQuad(Canvas &C)
 {
-	int i;
-
-	for (i = 0; i < quadElementsLength - 2; i += 3) {
-
-		// Calculate the base indices of the three vertices
-		int point1 = 3 * quadElements[i];     // slots 0, 1, 2
-		int point2 = 3 * quadElements[i + 1]; // slots 3, 4, 5
-		int point3 = 3 * quadElements[i + 2]; // slots 6, 7, 8
-
-		Vertex p1 = { quadVertices[point1 + 0],
-					  quadVertices[point1 + 1],
-					  quadVertices[point1 + 2] };
-
-		Vertex p2 = { quadVertices[point2 + 0],
-					  quadVertices[point2 + 1],
-					  quadVertices[point2 + 2] };
-
-		Vertex p3 = { quadVertices[point3 + 0],
-					  quadVertices[point3 + 1],
-					  quadVertices[point3 + 2] };
-
-		// Calculate the base indices of the three texture coordinates
-		int normal1 = 2 * quadElements[i];     // slots 0, 1, 2
-		int normal2 = 2 * quadElements[i + 1]; // slots 3, 4, 5
-		int normal3 = 2 * quadElements[i + 2]; // slots 6, 7, 8
-
-		TexCoord uv1 = { quadUV[normal1 + 0], quadUV[normal1 + 1] };
-		TexCoord uv2 = { quadUV[normal2 + 0], quadUV[normal2 + 1] };
-		TexCoord uv3 = { quadUV[normal3 + 0], quadUV[normal3 + 1] };
-
-		// Add triangle and texture coordinates
-		C.addTriangleWithUV(p1, uv1, p2, uv2, p3, uv3);
-	}
+	// face normals, with texture coordinates indexed like the vertices
+	C.addTriangles(quadElementsLength / 3, quadVertices, NULL, quadUV,
+		quadElements);
 }
@@ -0,0 +1,305 @@
+///
+//  StaticBatch.cpp
+//
+//  Static batching of objects which never move into world-space
+//  meshes.
+///
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+
+#include "StaticBatch.h"
+#include "Viewing.h"
+#include "Lighting.h"
+#include "GLState.h"
+
+///
+// Constructor
+///
+StaticBatcher::StaticBatcher( void ) : next(0), repack(false), changed(0) {
+    stats.draws = stats.culled = stats.rebuilt = stats.moved = 0;
+}
+
+///
+// size() - the number of batches
+///
+int StaticBatcher::size( void ) const {
+    return (int) batches.size();
+}
+
+///
+// sameTuple() - are two tuples exactly equal?
+///
+static bool sameTuple( const Tuple &a, const Tuple &b )
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+///
+// add() - give the batcher the next object of this frame
+//
+// @param mesh     - the object's BufferSet (with its data kept)
+// @param material - material id
+// @param scale, rotate, xlate - the object's transformations
+///
+void StaticBatcher::add( BufferSet *mesh, int material,
+    Tuple scale, Tuple rotate, Tuple xlate ) {
+
+    if( next == objects.size() ) {
+        Object o;
+        o.mesh = NULL;
+        o.batch = -1;
+        objects.push_back( o );
+    }
+
+    Object &o = objects[next++];
+
+    if( o.mesh != mesh ) {
+        repack = true;
+    } else if( o.material == material && sameTuple(o.scale, scale) &&
+        sameTuple(o.rotate, rotate) && sameTuple(o.xlate, xlate) ) {
+        return;
+    } else {
+        ++changed;
+        if( o.batch >= 0 ) {
+            batches[o.batch].dirty = true;
+        }
+    }
+
+    o.mesh = mesh;
+    o.material = material;
+    o.scale = scale;
+    o.rotate = rotate;
+    o.xlate = xlate;
+}
+
+///
+// pack() - share the objects out among batches, in order, and mark
+//     every batch as needing to be built
+///
+void StaticBatcher::pack( void ) {
+
+    objects.resize( next );
+
+    size_t nbatches = 0;
+    GLsizei vertices = 0;
+
+    for( size_t i = 0; i < objects.size(); ++i ) {
+        GLsizei n = objects[i].mesh->numVertices;
+        if( nbatches == 0 || vertices + n > BATCH_VERTICES ) {
+            if( nbatches == batches.size() ) {
+                Batch b;
+                b.vbuffer = b.ebuffer = 0;
+                b.vao = b.vaoProgram = 0;
+                batches.push_back( b );
+            }
+            batches[nbatches].first = i;
+            ++nbatches;
+            vertices = 0;
+        }
+        vertices += n;
+        objects[i].batch = (int) nbatches - 1;
+        batches[nbatches - 1].last = i + 1;
+    }
+
+    // give back the buffers of batches no longer needed
+    for( size_t b = nbatches; b < batches.size(); ++b ) {
+        stDeleteBuffers( 1, &batches[b].vbuffer );
+        stDeleteBuffers( 1, &batches[b].ebuffer );
+        stDeleteVertexArrays( 1, &batches[b].vao );
+    }
+    batches.resize( nbatches );
+
+    for( size_t b = 0; b < batches.size(); ++b ) {
+        batches[b].dirty = true;
+    }
+    repack = false;
+}
+
+///
+// build() - bake a batch's objects into world space and upload them
+///
+void StaticBatcher::build( Batch &b ) {
+
+    vector<BatchVertex> vertices;
+    vector<GLuint> elements;
+
+    for( size_t i = b.first; i < b.last; ++i ) {
+        const Object &o = objects[i];
+        const BufferSet *mesh = o.mesh;
+
+        if( mesh->points.empty() || mesh->indices.empty() ) {
+            cerr << "*** StaticBatcher: mesh data was not kept" << endl;
+            continue;
+        }
+
+        GLfloat m[16], n[9];
+        modelMatrix( o.scale, o.rotate, o.xlate, m );
+        normalMatrix( m, n );
+
+        GLuint base = (GLuint) vertices.size();
+        bool normals = !mesh->normals.empty();
+
+        for( int v = 0; v < mesh->numVertices; ++v ) {
+            const float *p = &mesh->points[4 * v];
+            BatchVertex bv;
+            for( int r = 0; r < 3; ++r ) {
+                bv.position[r] = m[r] * p[0] + m[4 + r] * p[1] +
+                    m[8 + r] * p[2] + m[12 + r];
+            }
+            if( normals ) {
+                const float *nv = &mesh->normals[3 * v];
+                for( int r = 0; r < 3; ++r ) {
+                    bv.normal[r] = n[r] * nv[0] + n[3 + r] * nv[1] +
+                        n[6 + r] * nv[2];
+                }
+            } else {
+                bv.normal[0] = bv.normal[1] = bv.normal[2] = 0.0f;
+            }
+            bv.material = o.material;
+            vertices.push_back( bv );
+        }
+
+        for( size_t e = 0; e < mesh->indices.size(); ++e ) {
+            elements.push_back( base + mesh->indices[e] );
+        }
+    }
+
+    b.vertices = (GLsizei) vertices.size();
+    b.elements = (GLsizei) elements.size();
+
+    // the bounding sphere:  centered on the box, as for a BufferSet
+    GLfloat lo[3] = { 0.0f, 0.0f, 0.0f }, hi[3] = { 0.0f, 0.0f, 0.0f };
+    for( size_t v = 0; v < vertices.size(); ++v ) {
+        for( int i = 0; i < 3; ++i ) {
+            GLfloat c = vertices[v].position[i];
+            if( v == 0 || c < lo[i] ) {
+                lo[i] = c;
+            }
+            if( v == 0 || c > hi[i] ) {
+                hi[i] = c;
+            }
+        }
+    }
+    float r2 = 0.0f;
+    for( int i = 0; i < 3; ++i ) {
+        b.center[i] = 0.5f * (lo[i] + hi[i]);
+    }
+    for( size_t v = 0; v < vertices.size(); ++v ) {
+        float d2 = 0.0f;
+        for( int i = 0; i < 3; ++i ) {
+            float d = vertices[v].position[i] - b.center[i];
+            d2 += d * d;
+        }
+        if( d2 > r2 ) {
+            r2 = d2;
+        }
+    }
+    b.radius = sqrtf( r2 );
+
+    // the buffers keep their names, so the vertex array stays valid
+    if( b.vbuffer == 0 ) {
+        glGenBuffers( 1, &b.vbuffer );
+        glGenBuffers( 1, &b.ebuffer );
+    }
+    stBindVertexArray( 0 );
+    stBindBuffer( GL_ARRAY_BUFFER, b.vbuffer );
+    glBufferData( GL_ARRAY_BUFFER, vertices.size() * sizeof(BatchVertex),
+        vertices.data(), GL_STATIC_DRAW );
+    stBindBuffer( GL_ELEMENT_ARRAY_BUFFER, b.ebuffer );
+    glBufferData( GL_ELEMENT_ARRAY_BUFFER, elements.size() * sizeof(GLuint),
+        elements.data(), GL_STATIC_DRAW );
+
+    b.dirty = false;
+    ++stats.rebuilt;
+}
+
+///
+// select() - bind a batch's vertex array, building it if need be
+///
+void StaticBatcher::select( Batch &b, GLuint program ) {
+
+    if( b.vao != 0 && b.vaoProgram == program ) {
+        stBindVertexArray( b.vao );
+        return;
+    }
+
+    if( b.vao != 0 ) {
+        stDeleteVertexArrays( 1, &b.vao );
+    }
+    glGenVertexArrays( 1, &b.vao );
+    b.vaoProgram = program;
+    stBindVertexArray( b.vao );
+
+    stBindBuffer( GL_ARRAY_BUFFER, b.vbuffer );
+    stBindBuffer( GL_ELEMENT_ARRAY_BUFFER, b.ebuffer );
+
+    GLsizei stride = sizeof(BatchVertex);
+
+    GLint vPosition = glGetAttribLocation( program, "vPosition" );
+    glEnableVertexAttribArray( vPosition );
+    glVertexAttribPointer( vPosition, 3, GL_FLOAT, GL_FALSE, stride,
+        BUFFER_OFFSET(offsetof(BatchVertex, position)) );
+
+    GLint vNormal = glGetAttribLocation( program, "vNormal" );
+    glEnableVertexAttribArray( vNormal );
+    glVertexAttribPointer( vNormal, 3, GL_FLOAT, GL_FALSE, stride,
+        BUFFER_OFFSET(offsetof(BatchVertex, normal)) );
+
+    GLint vMaterial = glGetAttribLocation( program, "vMaterial" );
+    glEnableVertexAttribArray( vMaterial );
+    glVertexAttribIPointer( vMaterial, 1, GL_INT, stride,
+        BUFFER_OFFSET(offsetof(BatchVertex, material)) );
+}
+
+///
+// flush() - rebuild whichever batches need it, and draw the ones
+//     inside the view frustum
+//
+// @param program - shader program to draw with (phong_batch.vert)
+// @param eye, lookat, up - the camera for this frame
+///
+void StaticBatcher::flush( GLuint program, Tuple eye, Tuple lookat,
+    Tuple up ) {
+
+    stats.draws = stats.culled = stats.rebuilt = 0;
+    stats.moved = changed;
+    changed = 0;
+
+    if( repack || next != objects.size() ) {
+        pack();
+    }
+    next = 0;
+
+    spheres.clear();
+    for( size_t b = 0; b < batches.size(); ++b ) {
+        if( batches[b].dirty ) {
+            build( batches[b] );
+        }
+        spheres.add( batches[b].center, batches[b].radius );
+    }
+
+    GLfloat vp[16];
+    Frustum f;
+    viewProjMatrix( eye, lookat, up, vp );
+    frustumFromMatrix( vp, f );
+    spheres.cull( f, visible );
+
+    stUseProgram( program );
+    setUpProjection( program );
+    setUpCamera( program, eye, lookat, up );
+    setUpLight();
+
+    for( size_t b = 0; b < batches.size(); ++b ) {
+        if( !visible[b] ) {
+            ++stats.culled;
+            continue;
+        }
+        select( batches[b], program );
+        glDrawElements( GL_TRIANGLES, batches[b].elements, GL_UNSIGNED_INT,
+            (void *)0 );
+        ++stats.draws;
+    }
+}
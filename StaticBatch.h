@@ -0,0 +1,146 @@
+///
+//  StaticBatch.h
+//
+//  Static batching:  objects which never move are baked, with their
+//  transformations applied, into world-space meshes, and drawn with a
+//  draw call per batch instead of one per object.
+//
+//  Each vertex carries its object's material id, so a batch can mix
+//  materials; the shader (phong_batch.vert, with phong_inst.frag)
+//  needs only the camera and projection.  Objects are given to the
+//  batcher every frame, in the same order, just as they would be
+//  given to the render queue.  Objects are packed into batches of up
+//  to BATCH_VERTICES vertices in that order; an object whose material
+//  or transformations differ from the previous frame's causes only its
+//  own batch to be rebuilt, while adding, removing or replacing the
+//  mesh of an object repacks them all.
+//
+//  The meshes must have been created with their vertex data kept
+//  (see BufferSet::createBuffers()).
+///
+
+#ifndef _STATICBATCH_H_
+#define _STATICBATCH_H_
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
+#ifndef __APPLE__
+#include <GL/glew.h>
+#endif
+
+#include <GLFW/glfw3.h>
+#endif
+
+#include <vector>
+
+#include "Buffers.h"
+#include "Culling.h"
+#include "Tuple.h"
+
+using namespace std;
+
+///
+// Most vertices in one batch
+///
+#define BATCH_VERTICES          (64 * 1024)
+
+///
+// One vertex of a batch, in world space
+///
+typedef struct st_batchvertex {
+    GLfloat position[3];
+    GLfloat normal[3];
+    GLint material;
+} BatchVertex;
+
+///
+// What one flush() did
+///
+typedef struct st_bstats {
+    int draws;                  // batches drawn
+    int culled;                 // batches outside the view frustum
+    int rebuilt;                // batches rebuilt
+    int moved;                  // objects which changed
+} BatchStats;
+
+///
+// The batcher
+///
+class StaticBatcher {
+
+public:
+
+    // counts for the most recent flush()
+    BatchStats stats;
+
+    ///
+    // Constructor
+    ///
+    StaticBatcher( void );
+
+    ///
+    // add() - give the batcher the next object of this frame
+    //
+    // @param mesh     - the object's BufferSet (with its data kept)
+    // @param material - material id
+    // @param scale, rotate, xlate - the object's transformations
+    ///
+    void add( BufferSet *mesh, int material,
+        Tuple scale, Tuple rotate, Tuple xlate );
+
+    ///
+    // flush() - rebuild whichever batches need it, and draw the ones
+    //     inside the view frustum
+    //
+    // @param program - shader program to draw with (phong_batch.vert)
+    // @param eye, lookat, up - the camera for this frame
+    ///
+    void flush( GLuint program, Tuple eye, Tuple lookat, Tuple up );
+
+    ///
+    // size() - the number of batches
+    ///
+    int size( void ) const;
+
+private:
+
+    struct Object {
+        BufferSet *mesh;
+        int material;
+        Tuple scale, rotate, xlate;
+        int batch;
+    };
+
+    struct Batch {
+        size_t first, last;         // objects first..last-1
+        GLsizei vertices, elements;
+        GLuint vbuffer, ebuffer;
+        GLuint vao, vaoProgram;     // vertex array, and its program
+        bool dirty;
+        GLfloat center[3], radius;  // bounding sphere, in world space
+    };
+
+    vector<Object> objects;
+    vector<Batch> batches;
+
+    // objects given this frame, whether they no longer match the
+    // batches' objects one for one, and how many of them have changed
+    size_t next;
+    bool repack;
+    int changed;
+
+    SphereSet spheres;
+    vector<unsigned char> visible;
+
+    void pack( void );
+    void build( Batch &b );
+    void select( Batch &b, GLuint program );
+};
+
+#endif
@@ -20,11 +20,20 @@
 #endif
 
 #include "Textures.h"
+#include "Uniforms.h"
+#include "Viewing.h"
 #include "Shapes.h"
+#include "GLState.h"
 
 // this is here in case you are using SOIL;
 // if you're not, it can be deleted.
+#if defined(NO_SOIL)
+#include <cstdio>
+#include <vector>
+#include <jpeglib.h>
+#else
 #include <SOIL.h>
+#endif
 #include<iostream>
 
 #ifdef __cplusplus
@@ -34,6 +43,64 @@ using namespace std;
 // Add any global definitions and/or variables you need here.
 GLuint table_img_loc;
 
+#if defined(NO_SOIL)
+///
+// loadJPEG(name) - stand-in for SOIL_load_OGL_texture() on systems
+// without SOIL; decodes a JPEG file with libjpeg and applies the same
+// options we ask SOIL for (Y inverted, mipmapped, repeating).
+//
+// @param name - name of the image file
+//
+// @return the new texture ID, or 0 on failure
+///
+static GLuint loadJPEG( const char *name )
+{
+	FILE *fp = fopen(name, "rb");
+	if (fp == NULL) {
+		return 0;
+	}
+
+	struct jpeg_decompress_struct cinfo;
+	struct jpeg_error_mgr jerr;
+	cinfo.err = jpeg_std_error(&jerr);
+	jpeg_create_decompress(&cinfo);
+	jpeg_stdio_src(&cinfo, fp);
+	jpeg_read_header(&cinfo, TRUE);
+	cinfo.out_color_space = JCS_RGB;
+	jpeg_start_decompress(&cinfo);
+
+	int w = cinfo.output_width;
+	int h = cinfo.output_height;
+	int rowSize = w * 3;
+	vector<unsigned char> pixels(rowSize * h);
+
+	// fill from the bottom up, as SOIL_FLAG_INVERT_Y does
+	while (cinfo.output_scanline < cinfo.output_height) {
+		JSAMPROW row = &pixels[(h - 1 - cinfo.output_scanline) * rowSize];
+		jpeg_read_scanlines(&cinfo, &row, 1);
+	}
+
+	jpeg_finish_decompress(&cinfo);
+	jpeg_destroy_decompress(&cinfo);
+	fclose(fp);
+
+	GLuint tex;
+	glGenTextures(1, &tex);
+	stBindTexture(GL_TEXTURE_2D, tex);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, w, h, 0, GL_RGB,
+		GL_UNSIGNED_BYTE, &pixels[0]);
+	glGenerateMipmap(GL_TEXTURE_2D);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+		GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+	return tex;
+}
+#endif
+
 
 ///
 // This function loads texture data for the GPU.
@@ -45,6 +112,13 @@ void loadTextures( void )
 {
 	//use SOIL to import image files
 	glEnable(GL_TEXTURE_2D);
+#if defined(NO_SOIL)
+	table_img_loc = loadJPEG("table.jpg");
+
+	if (table_img_loc == 0) {
+		printf("JPEG loading error: can't read 'table.jpg'\n");
+	}
+#else
 	table_img_loc = SOIL_load_OGL_texture(
 		"table.jpg",
 		SOIL_LOAD_AUTO,
@@ -58,6 +132,10 @@ void loadTextures( void )
 		printf("SOIL loading error: '%s'\n",
 			SOIL_last_result());
 	}
+
+	// SOIL binds its texture behind our back
+	stInvalidate();
+#endif
 }
 
 ///
@@ -70,38 +148,36 @@ void loadTextures( void )
 //    parameter values are to be sent
 // @param obj - The object type of the object being drawn
 ///
-void setUpTextures( GLuint program, int obj )
+void setUpTextures( GLuint program, int /* obj */ )
 {
-	glUseProgram(program);
+	stUseProgram(program);
 	//bind texture 
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, table_img_loc);
+	stActiveTexture(GL_TEXTURE0);
+	stBindTexture(GL_TEXTURE_2D, table_img_loc);
 	
-	glActiveTexture(GL_TEXTURE2);
+	stActiveTexture(GL_TEXTURE2);
 
-	//get sampler location
-	GLint happy_loc = glGetUniformLocation(program, "happy_img");
-
-	if (happy_loc == -1) {
-		std::cout << "can't find happy loc, obj id=" << obj << endl;
-	}
+	//get sampler location (a missing one is reported by dumpUniforms())
+	GLint happy_loc = uniformLoc(program, U_HAPPY_IMG);
 
 	//assign sampler with binded texture
-	glUniform1i(happy_loc, 0);
+	stUniform1i(happy_loc, 0);
 
 	//get ka kd ks location in shader
-	GLint ka_loc = glGetUniformLocation(program, "ka");
-	GLint kd_loc = glGetUniformLocation(program, "kd");
-	GLint ks_loc = glGetUniformLocation(program, "ks");
-	GLint specular_exponent_loc = glGetUniformLocation(program, "specular_exponent");
+	GLint ka_loc = uniformLoc(program, U_KA);
+	GLint kd_loc = uniformLoc(program, U_KD);
+	GLint ks_loc = uniformLoc(program, U_KS);
+	GLint specular_exponent_loc = uniformLoc(program, U_SPECULAR_EXPONENT);
 
 	//pass light properties to shader
-	GLint light_color_loc = glGetUniformLocation(program, "light_color");
-	GLint light_position_loc = glGetUniformLocation(program, "light_position");
-	GLint light_ambient_loc = glGetUniformLocation(program, "light_ambient");
-	glUniform4f(light_color_loc, 1.0, 1.0, 1.0, 1.0);
-	glUniform3f(light_position_loc, 3.0, 9.0, 2.0);
-	glUniform4f(light_ambient_loc, 0.5, 0.5, 0.5, 1.0);
+	GLint light_color_loc = uniformLoc(program, U_LIGHT_COLOR);
+	GLint light_ambient_loc = uniformLoc(program, U_LIGHT_AMBIENT);
+	Tuple light_position = { 3.0f, 9.0f, 2.0f };
+	GLfloat light_color[] = { 1.0, 1.0, 1.0, 1.0 };
+	GLfloat light_ambient[] = { 0.5, 0.5, 0.5, 1.0 };
+	stUniform4fv(light_color_loc, 1, light_color);
+	setUpLightPosition(program, light_position);
+	stUniform4fv(light_ambient_loc, 1, light_ambient);
 
 	//pass ka kd ks variable to shader
 	/*
@@ -113,10 +189,10 @@ void setUpTextures( GLuint program, int obj )
 	Specular exponent = 40.0
 	*/
 	// Since textures are only for quad, we ignore the obj input
-	glUniform1f(ka_loc, 0.7);
-	glUniform1f(kd_loc, 0.7);
-	glUniform1f(ks_loc, 1.0);
-	glUniform1f(specular_exponent_loc, 40);
+	stUniform1f(ka_loc, 0.7);
+	stUniform1f(kd_loc, 0.7);
+	stUniform1f(ks_loc, 1.0);
+	stUniform1f(specular_exponent_loc, 40);
 
 
 }
@@ -18,11 +18,16 @@
 #include <windows.h>
 #endif
 
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
 #ifndef __APPLE__
 #include <GL/glew.h>
 #endif
 
 #include <GLFW/glfw3.h>
+#endif
 
 ///
 // This function loads texture data for the GPU.
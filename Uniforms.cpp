@@ -0,0 +1,123 @@
+///
+//  Uniforms.cpp
+//
+//  Per-program table of uniform variable locations.
+///
+
+#include <iostream>
+#include <vector>
+
+#include "Uniforms.h"
+
+using namespace std;
+
+// shader variable names, in UniformId order
+static const char *uniformNames[N_UNIFORMS] = {
+    "left", "right", "top", "bottom", "near", "far",
+    "theta", "trans", "scale",
+    "cPosition", "cLookAt", "cUp",
+    "modelViewMat", "projMat", "normalMat", "viewMat",
+    "light_color", "light_position", "light_position_eye", "light_ambient",
+    "Oa", "Od", "Os", "ka", "kd", "ks", "specular_exponent",
+    "material",
+    "happy_img"
+};
+
+// one table per program
+typedef struct st_utable {
+    GLuint program;
+    GLint loc[N_UNIFORMS];
+    bool expected[N_UNIFORMS];  // given to resolveUniforms()
+} UniformTable;
+
+static vector<UniformTable> tables;
+
+///
+// findTable(program) - find (or create) the table for a program
+//
+// @param program - GLSL program object
+//
+// @return the table for this program
+///
+static UniformTable &findTable( GLuint program )
+{
+    for( size_t i = 0; i < tables.size(); ++i ) {
+        if( tables[i].program == program ) {
+            return tables[i];
+        }
+    }
+
+    UniformTable t;
+    t.program = program;
+    for( int i = 0; i < N_UNIFORMS; ++i ) {
+        t.loc[i] = glGetUniformLocation( program, uniformNames[i] );
+        t.expected[i] = false;
+    }
+    tables.push_back( t );
+
+    return tables.back();
+}
+
+///
+// resolveUniforms(program,expected,count) - look up and record the
+//     locations of all the uniforms for a newly-linked program
+//
+// @param program  - GLSL program object
+// @param expected - the uniforms the program should have (or NULL)
+// @param count    - number of entries in 'expected'
+///
+void resolveUniforms( GLuint program, const UniformId *expected,
+    int count )
+{
+    UniformTable &t = findTable( program );
+
+    for( int i = 0; i < count; ++i ) {
+        t.expected[expected[i]] = true;
+    }
+}
+
+///
+// uniformLoc(program,which) - get the location of a uniform
+//
+// @param program - GLSL program object
+// @param which   - the uniform
+//
+// @return the location, or -1 if the program has no such uniform
+///
+GLint uniformLoc( GLuint program, UniformId which )
+{
+    return findTable( program ).loc[which];
+}
+
+///
+// dumpUniforms(program,name) - print the uniform table for a program,
+//     noting any of its expected uniforms that it does not have
+//
+// @param program - GLSL program object
+// @param name    - description of the program
+///
+void dumpUniforms( GLuint program, const char *name )
+{
+    UniformTable &t = findTable( program );
+
+    cerr << "Uniforms for " << name << " (program " << program << "):";
+    int missing = 0;
+    for( int i = 0; i < N_UNIFORMS; ++i ) {
+        if( t.loc[i] >= 0 ) {
+            cerr << " " << uniformNames[i] << "=" << t.loc[i];
+        } else if( t.expected[i] ) {
+            ++missing;
+        }
+    }
+    cerr << endl;
+
+    if( missing > 0 ) {
+        cerr << "  not found:";
+        for( int i = 0; i < N_UNIFORMS; ++i ) {
+            if( t.loc[i] < 0 && t.expected[i] ) {
+                cerr << " " << uniformNames[i];
+            }
+        }
+        cerr << endl;
+    }
+}
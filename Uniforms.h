@@ -0,0 +1,93 @@
+///
+//  Uniforms.h
+//
+//  Per-program table of uniform variable locations.
+//
+//  The locations of all the uniforms used by the still life shaders
+//  are looked up once, when a program is registered with
+//  resolveUniforms(), and are afterward fetched by index with
+//  uniformLoc() instead of by name with glGetUniformLocation().
+//
+//  Each program uses only some of them; the ones it is expected to
+//  have are given to resolveUniforms(), and dumpUniforms() reports
+//  just those of them which the program lacks.
+///
+
+#ifndef _UNIFORMS_H_
+#define _UNIFORMS_H_
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
+#ifndef __APPLE__
+#include <GL/glew.h>
+#endif
+
+#include <GLFW/glfw3.h>
+#endif
+
+#include <cstddef>
+
+///
+// The uniforms we know about
+///
+typedef enum uniformId {
+    // projection
+    U_LEFT, U_RIGHT, U_TOP, U_BOTTOM, U_NEAR, U_FAR,
+    // model transformations
+    U_THETA, U_TRANS, U_SCALE,
+    // camera
+    U_CPOSITION, U_CLOOKAT, U_CUP,
+    // matrices computed by Viewing.cpp
+    U_MODELVIEWMAT, U_PROJMAT, U_NORMALMAT, U_VIEWMAT,
+    // light source
+    U_LIGHT_COLOR, U_LIGHT_POSITION, U_LIGHT_POSITION_EYE, U_LIGHT_AMBIENT,
+    // material
+    U_OA, U_OD, U_OS, U_KA, U_KD, U_KS, U_SPECULAR_EXPONENT,
+    // material id, for shaders using the material block
+    U_MATERIAL,
+    // texture samplers
+    U_HAPPY_IMG,
+    // number of entries in the table
+    N_UNIFORMS
+} UniformId;
+
+///
+// resolveUniforms(program,expected,count) - look up and record the
+//     locations of all the uniforms for a newly-linked program
+//
+// @param program  - GLSL program object
+// @param expected - the uniforms the program should have (or NULL)
+// @param count    - number of entries in 'expected'
+///
+void resolveUniforms( GLuint program, const UniformId *expected = NULL,
+    int count = 0 );
+
+///
+// uniformLoc(program,which) - get the location of a uniform
+//
+// Programs which have not been passed to resolveUniforms() are
+// resolved on first use.
+//
+// @param program - GLSL program object
+// @param which   - the uniform
+//
+// @return the location, or -1 if the program has no such uniform
+///
+GLint uniformLoc( GLuint program, UniformId which );
+
+///
+// dumpUniforms(program,name) - print the uniform table for a program,
+//     noting any of its expected uniforms that it does not have
+//
+// @param program - GLSL program object
+// @param name    - description of the program
+///
+void dumpUniforms( GLuint program, const char *name );
+
+#endif
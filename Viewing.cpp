@@ -13,7 +13,12 @@
 //  This file should not be modified by students.
 ///
 
+#include <math.h>
+#include <string.h>
+
 #include "Viewing.h"
+#include "Uniforms.h"
+#include "GLState.h"
 
 // current values for transformations
 GLfloat rotateDefault[3]    = { 0.0f, 50.0f, 90.0f };
@@ -33,6 +38,216 @@ GLfloat cwBottom = -1.0f;
 GLfloat cwNear   = 3.0f;
 GLfloat cwFar    = 100.5f;
 
+// the matrices most recently set up, in column-major order
+GLfloat modelMat[16];
+GLfloat viewMat[16];
+GLfloat projMat[16];
+GLfloat modelViewMat[16];
+GLfloat normalMat[9];
+
+///
+// Matrix helpers.  All matrices are column-major, as GLSL expects.
+///
+
+///
+// mulMat4(a,b,out) - out = a * b (out may not be a or b)
+///
+static void mulMat4( const GLfloat *a, const GLfloat *b, GLfloat *out )
+{
+    for( int c = 0; c < 4; ++c ) {
+        for( int r = 0; r < 4; ++r ) {
+            out[c*4+r] = a[r]    * b[c*4]   + a[4+r]  * b[c*4+1] +
+                         a[8+r]  * b[c*4+2] + a[12+r] * b[c*4+3];
+        }
+    }
+}
+
+///
+// setMat4(m,...) - fill in m, one column at a time
+///
+static void setMat4( GLfloat *m,
+    GLfloat c00, GLfloat c01, GLfloat c02, GLfloat c03,
+    GLfloat c10, GLfloat c11, GLfloat c12, GLfloat c13,
+    GLfloat c20, GLfloat c21, GLfloat c22, GLfloat c23,
+    GLfloat c30, GLfloat c31, GLfloat c32, GLfloat c33 )
+{
+    m[0]  = c00; m[1]  = c01; m[2]  = c02; m[3]  = c03;
+    m[4]  = c10; m[5]  = c11; m[6]  = c12; m[7]  = c13;
+    m[8]  = c20; m[9]  = c21; m[10] = c22; m[11] = c23;
+    m[12] = c30; m[13] = c31; m[14] = c32; m[15] = c33;
+}
+
+///
+// normalize3(v) - make v unit length
+///
+static void normalize3( GLfloat *v )
+{
+    GLfloat len = sqrtf( v[0]*v[0] + v[1]*v[1] + v[2]*v[2] );
+    v[0] /= len;
+    v[1] /= len;
+    v[2] /= len;
+}
+
+///
+// cross3(a,b,out) - out = a x b
+///
+static void cross3( const GLfloat *a, const GLfloat *b, GLfloat *out )
+{
+    out[0] = a[1] * b[2] - a[2] * b[1];
+    out[1] = a[2] * b[0] - a[0] * b[2];
+    out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+///
+// buildModel(scale,rotate,xlate,m) - compute a model matrix
+//
+// Transformation order:  scale, rotate Z, rotate Y, rotate X, translate
+///
+static void buildModel( const GLfloat *scale, const GLfloat *rotate,
+    const GLfloat *xlate, GLfloat *m )
+{
+    GLfloat rad = (GLfloat) (3.14159265358979323846 / 180.0);
+    GLfloat cx = cosf( rotate[0] * rad ), sx = sinf( rotate[0] * rad );
+    GLfloat cy = cosf( rotate[1] * rad ), sy = sinf( rotate[1] * rad );
+    GLfloat cz = cosf( rotate[2] * rad ), sz = sinf( rotate[2] * rad );
+
+    GLfloat rx[16], ry[16], rz[16], t[16], s[16], tmp1[16], tmp2[16];
+    setMat4( rx, 1, 0, 0, 0,   0, cx, sx, 0,   0, -sx, cx, 0,   0, 0, 0, 1 );
+    setMat4( ry, cy, 0, -sy, 0,   0, 1, 0, 0,   sy, 0, cy, 0,   0, 0, 0, 1 );
+    setMat4( rz, cz, sz, 0, 0,   -sz, cz, 0, 0,   0, 0, 1, 0,   0, 0, 0, 1 );
+    setMat4( t, 1, 0, 0, 0,   0, 1, 0, 0,   0, 0, 1, 0,
+        xlate[0], xlate[1], xlate[2], 1 );
+    setMat4( s, scale[0], 0, 0, 0,   0, scale[1], 0, 0,
+        0, 0, scale[2], 0,   0, 0, 0, 1 );
+
+    mulMat4( t, rx, tmp1 );
+    mulMat4( tmp1, ry, tmp2 );
+    mulMat4( tmp2, rz, tmp1 );
+    mulMat4( tmp1, s, m );
+}
+
+///
+// buildNormal(m,n) - compute the normal matrix for m:  the inverse
+//     transpose of its upper 3x3, which is that submatrix's cofactor
+//     matrix over its determinant
+///
+static void buildNormal( const GLfloat *m, GLfloat *n )
+{
+    GLfloat a00 = m[0], a01 = m[4], a02 = m[8];     // a[row][col]
+    GLfloat a10 = m[1], a11 = m[5], a12 = m[9];
+    GLfloat a20 = m[2], a21 = m[6], a22 = m[10];
+
+    GLfloat c00 = a11 * a22 - a12 * a21;
+    GLfloat c01 = a12 * a20 - a10 * a22;
+    GLfloat c02 = a10 * a21 - a11 * a20;
+    GLfloat det = a00 * c00 + a01 * c01 + a02 * c02;
+
+    n[0] = c00 / det;
+    n[1] = (a02 * a21 - a01 * a22) / det;
+    n[2] = (a01 * a12 - a02 * a11) / det;
+    n[3] = c01 / det;
+    n[4] = (a00 * a22 - a02 * a20) / det;
+    n[5] = (a02 * a10 - a00 * a12) / det;
+    n[6] = c02 / det;
+    n[7] = (a01 * a20 - a00 * a21) / det;
+    n[8] = (a00 * a11 - a01 * a10) / det;
+}
+
+///
+// buildView(eye,lookat,up,m) - compute a view matrix
+///
+static void buildView( const GLfloat *eye, const GLfloat *lookat,
+    const GLfloat *up, GLfloat *m )
+{
+    GLfloat n[3] = { eye[0] - lookat[0], eye[1] - lookat[1],
+                     eye[2] - lookat[2] };
+    GLfloat upn[3] = { up[0], up[1], up[2] };
+    GLfloat u[3], v[3];
+
+    normalize3( n );
+    normalize3( upn );
+    cross3( upn, n, u );
+    normalize3( u );
+    cross3( n, u, v );
+    normalize3( v );
+
+    setMat4( m,
+        u[0], v[0], n[0], 0,
+        u[1], v[1], n[1], 0,
+        u[2], v[2], n[2], 0,
+        -(u[0] * eye[0] + u[1] * eye[1] + u[2] * eye[2]),
+        -(v[0] * eye[0] + v[1] * eye[1] + v[2] * eye[2]),
+        -(n[0] * eye[0] + n[1] * eye[1] + n[2] * eye[2]), 1 );
+}
+
+///
+// buildProjection(m) - compute the frustum projection matrix for the
+//     current clipping window
+///
+static void buildProjection( GLfloat *m )
+{
+    GLfloat rl = cwRight - cwLeft;
+    GLfloat tb = cwTop - cwBottom;
+    GLfloat fn = cwFar - cwNear;
+
+    setMat4( m,
+        (2.0f * cwNear) / rl, 0, 0, 0,
+        0, (2.0f * cwNear) / tb, 0, 0,
+        (cwRight + cwLeft) / rl, (cwTop + cwBottom) / tb,
+        -(cwFar + cwNear) / fn, -1,
+        0, 0, (-2.0f * cwFar * cwNear) / fn, 0 );
+}
+
+///
+// loadMatrices(program) - send the current model-view and normal
+//     matrices down to the shader
+///
+static void loadMatrices( GLuint program )
+{
+    stUniformMatrix4fv( uniformLoc(program, U_MODELVIEWMAT), 1, GL_FALSE,
+        modelViewMat );
+    stUniformMatrix3fv( uniformLoc(program, U_NORMALMAT), 1, GL_FALSE,
+        normalMat );
+}
+
+///
+// loadModel(program,...) - compute the model, model-view, and normal
+//     matrices and send everything down to the shader
+///
+static void loadModel( GLuint program, const GLfloat *scale,
+    const GLfloat *rotate, const GLfloat *xlate )
+{
+    // the shaders which build their own matrices want the parameters
+    stUniform3fv( uniformLoc(program, U_THETA), 1, rotate );
+    stUniform3fv( uniformLoc(program, U_TRANS), 1, xlate );
+    stUniform3fv( uniformLoc(program, U_SCALE), 1, scale );
+
+    buildModel( scale, rotate, xlate, modelMat );
+    mulMat4( viewMat, modelMat, modelViewMat );
+    buildNormal( modelViewMat, normalMat );
+
+    loadMatrices( program );
+}
+
+
+///
+// loadCamera(program,...) - compute the view matrix and send
+//     everything down to the shader
+///
+static void loadCamera( GLuint program, const GLfloat *eye,
+    const GLfloat *lookat, const GLfloat *up )
+{
+    // the shaders which build their own matrices want the parameters
+    stUniform3fv( uniformLoc(program, U_CPOSITION), 1, eye );
+    stUniform3fv( uniformLoc(program, U_CLOOKAT), 1, lookat );
+    stUniform3fv( uniformLoc(program, U_CUP), 1, up );
+
+    buildView( eye, lookat, up, viewMat );
+
+    stUniformMatrix4fv( uniformLoc(program, U_VIEWMAT), 1, GL_FALSE,
+        viewMat );
+}
+
 ///
 // This function sets up the view and projection parameters for a frustum
 // projection of the scene.
@@ -42,19 +257,24 @@ GLfloat cwFar    = 100.5f;
 ///
 void setUpProjection( GLuint program )
 {
-    GLint leftLoc = glGetUniformLocation( program, "left" );
-    GLint rightLoc = glGetUniformLocation( program, "right" );
-    GLint topLoc = glGetUniformLocation( program, "top" );
-    GLint bottomLoc = glGetUniformLocation( program, "bottom" );
-    GLint nearLoc = glGetUniformLocation( program, "near" );
-    GLint farLoc = glGetUniformLocation( program, "far" );
+    GLint leftLoc = uniformLoc( program, U_LEFT );
+    GLint rightLoc = uniformLoc( program, U_RIGHT );
+    GLint topLoc = uniformLoc( program, U_TOP );
+    GLint bottomLoc = uniformLoc( program, U_BOTTOM );
+    GLint nearLoc = uniformLoc( program, U_NEAR );
+    GLint farLoc = uniformLoc( program, U_FAR );
 
-    glUniform1f( leftLoc,   cwLeft );
-    glUniform1f( rightLoc,  cwRight );
-    glUniform1f( topLoc,    cwTop );
-    glUniform1f( bottomLoc, cwBottom );
-    glUniform1f( nearLoc,   cwNear );
-    glUniform1f( farLoc,    cwFar );
+    stUniform1f( leftLoc,   cwLeft );
+    stUniform1f( rightLoc,  cwRight );
+    stUniform1f( topLoc,    cwTop );
+    stUniform1f( bottomLoc, cwBottom );
+    stUniform1f( nearLoc,   cwNear );
+    stUniform1f( farLoc,    cwFar );
+
+    buildProjection( projMat );
+
+    stUniformMatrix4fv( uniformLoc(program, U_PROJMAT), 1, GL_FALSE,
+        projMat );
 }
 
 ///
@@ -68,13 +288,7 @@ void setUpProjection( GLuint program )
 void clearTransforms( GLuint program )
 {
     // reset the shader using global data
-    GLint thetaLoc = glGetUniformLocation( program, "theta" );
-    GLint transLoc = glGetUniformLocation( program, "trans" );
-    GLint scaleLoc = glGetUniformLocation( program, "scale" );
-
-    glUniform3fv( thetaLoc, 1, rotateDefault );
-    glUniform3fv( transLoc, 1, translateDefault );
-    glUniform3fv( scaleLoc, 1, scaleDefault );
+    loadModel( program, scaleDefault, rotateDefault, translateDefault );
 }
 
 ///
@@ -94,14 +308,8 @@ void setUpTransforms( GLuint program, Tuple scale, Tuple rotate, Tuple xlate )
     GLfloat rotateVec[]    = { rotate.x, rotate.y, rotate.z };
     GLfloat translateVec[] = { xlate.x, xlate.y, xlate.z };
 
-    GLint thetaLoc = glGetUniformLocation( program, "theta" );
-    GLint transLoc = glGetUniformLocation( program, "trans" );
-    GLint scaleLoc = glGetUniformLocation( program, "scale" );
-
     // send down to the shader
-    glUniform3fv( thetaLoc, 1, rotateVec );
-    glUniform3fv( transLoc, 1, translateVec );
-    glUniform3fv( scaleLoc, 1, scaleVec );
+    loadModel( program, scaleVec, rotateVec, translateVec );
 }
 
 ///
@@ -114,13 +322,7 @@ void setUpTransforms( GLuint program, Tuple scale, Tuple rotate, Tuple xlate )
 ///
 void clearCamera( GLuint program )
 {
-    GLint posLoc = glGetUniformLocation( program, "cPosition" );
-    GLint lookLoc = glGetUniformLocation( program, "cLookAt" );
-    GLint upVecLoc = glGetUniformLocation( program, "cUp" );
-
-    glUniform3fv( posLoc, 1, eyeDefault );
-    glUniform3fv( lookLoc, 1, lookDefault );
-    glUniform3fv( upVecLoc, 1, upDefault );
+    loadCamera( program, eyeDefault, lookDefault, upDefault );
 }
 
 ///
@@ -139,12 +341,186 @@ void setUpCamera( GLuint program, Tuple eye, Tuple lookat, Tuple up )
     GLfloat lookatVec[] = { lookat.x, lookat.y, lookat.z };
     GLfloat upVec[]     = { up.x, up.y, up.z };
 
-    GLint posLoc = glGetUniformLocation( program, "cPosition" );
-    GLint lookLoc = glGetUniformLocation( program, "cLookAt" );
-    GLint upVecLoc = glGetUniformLocation( program, "cUp" );
-
     // send down to the shader
-    glUniform3fv( posLoc, 1, eyeVec );
-    glUniform3fv( lookLoc, 1, lookatVec );
-    glUniform3fv( upVecLoc, 1, upVec );
+    loadCamera( program, eyeVec, lookatVec, upVec );
+}
+
+///
+// This function sets up the position of the light source.
+//
+// @param program - The ID of an OpenGL (GLSL) shader program to which
+//    parameter values are to be sent
+// @param pos     - light position, in world coordinates
+///
+void setUpLightPosition( GLuint program, Tuple pos )
+{
+    GLfloat world[] = { pos.x, pos.y, pos.z };
+
+    // the position in eye coordinates, from the current view matrix
+    GLfloat eye[3];
+    for( int r = 0; r < 3; ++r ) {
+        eye[r] = viewMat[r] * world[0] + viewMat[4+r] * world[1] +
+            viewMat[8+r] * world[2] + viewMat[12+r];
+    }
+
+    stUniform3fv( uniformLoc(program, U_LIGHT_POSITION), 1, world );
+    stUniform3fv( uniformLoc(program, U_LIGHT_POSITION_EYE), 1, eye );
+}
+
+///
+// This function computes the model matrix for a set of transformations,
+// without sending anything to a shader.
+//
+// @param scale  - scale factors for each axis
+// @param rotate - rotation angles around the three axes, in degrees
+// @param xlate  - amount of translation along each axis
+// @param m      - the resulting matrix (16 values, column-major)
+///
+void modelMatrix( Tuple scale, Tuple rotate, Tuple xlate, GLfloat *m )
+{
+    GLfloat scaleVec[]     = { scale.x, scale.y, scale.z };
+    GLfloat rotateVec[]    = { rotate.x, rotate.y, rotate.z };
+    GLfloat translateVec[] = { xlate.x, xlate.y, xlate.z };
+
+    buildModel( scaleVec, rotateVec, translateVec, m );
+}
+
+///
+// This function computes the normal matrix (the inverse transpose of
+// the upper 3x3) for a transformation matrix.
+//
+// @param m - the transformation (16 values, column-major)
+// @param n - the resulting normal matrix (9 values, column-major)
+///
+void normalMatrix( const GLfloat *m, GLfloat *n )
+{
+    buildNormal( m, n );
+}
+
+///
+// This function computes the combined projection and view matrix for
+// a camera, without sending anything to a shader or changing the
+// current matrices.
+//
+// @param eye    - camera location
+// @param lookat - lookat point
+// @param up     - the up vector
+// @param m      - the resulting matrix (16 values, column-major)
+///
+void viewProjMatrix( Tuple eye, Tuple lookat, Tuple up, GLfloat *m )
+{
+    GLfloat eyeVec[]    = { eye.x, eye.y, eye.z };
+    GLfloat lookatVec[] = { lookat.x, lookat.y, lookat.z };
+    GLfloat upVec[]     = { up.x, up.y, up.z };
+    GLfloat view[16], proj[16];
+
+    buildView( eyeVec, lookatVec, upVec, view );
+    buildProjection( proj );
+    mulMat4( proj, view, m );
+}
+
+///
+// This function computes the view matrix for a camera, without sending
+// anything to a shader or changing the current matrices.
+//
+// @param eye    - camera location
+// @param lookat - lookat point
+// @param up     - the up vector
+// @param m      - the resulting matrix (16 values, column-major)
+///
+void viewMatrix( Tuple eye, Tuple lookat, Tuple up, GLfloat *m )
+{
+    GLfloat eyeVec[]    = { eye.x, eye.y, eye.z };
+    GLfloat lookatVec[] = { lookat.x, lookat.y, lookat.z };
+    GLfloat upVec[]     = { up.x, up.y, up.z };
+
+    buildView( eyeVec, lookatVec, upVec, m );
+}
+
+///
+// This function computes the model, model-view, and normal matrices
+// for a set of transformations, the same way setUpTransforms() does,
+// without sending anything to a shader or changing the current
+// matrices.  It may be called from several threads at once.
+//
+// @param view   - the view matrix (16 values, column-major)
+// @param scale  - scale factors for each axis
+// @param rotate - rotation angles around the three axes, in degrees
+// @param xlate  - amount of translation along each axis
+// @param model  - the resulting model matrix (16 values)
+// @param mv     - the resulting model-view matrix (16 values)
+// @param n      - the resulting normal matrix (9 values)
+///
+void modelViewMatrices( const GLfloat *view, Tuple scale, Tuple rotate,
+    Tuple xlate, GLfloat *model, GLfloat *mv, GLfloat *n )
+{
+    GLfloat scaleVec[]     = { scale.x, scale.y, scale.z };
+    GLfloat rotateVec[]    = { rotate.x, rotate.y, rotate.z };
+    GLfloat translateVec[] = { xlate.x, xlate.y, xlate.z };
+
+    buildModel( scaleVec, rotateVec, translateVec, model );
+    mulMat4( view, model, mv );
+    buildNormal( mv, n );
+}
+
+///
+// This function sets up the transformation parameters for an object
+// whose model-view and normal matrices have already been computed by
+// modelViewMatrices(), and sends them down to the shader.
+//
+// @param program - The ID of an OpenGL (GLSL) shader program to which
+//    parameter values are to be sent
+// @param scale  - scale factors for each axis
+// @param rotate - rotation angles around the three axes, in degrees
+// @param xlate  - amount of translation along each axis
+// @param mv     - the model-view matrix (16 values, column-major)
+// @param n      - the normal matrix (9 values, column-major)
+///
+void setUpModelView( GLuint program, Tuple scale, Tuple rotate,
+    Tuple xlate, const GLfloat *mv, const GLfloat *n )
+{
+    GLfloat scaleVec[]     = { scale.x, scale.y, scale.z };
+    GLfloat rotateVec[]    = { rotate.x, rotate.y, rotate.z };
+    GLfloat translateVec[] = { xlate.x, xlate.y, xlate.z };
+
+    // the shaders which build their own matrices want the parameters
+    stUniform3fv( uniformLoc(program, U_THETA), 1, rotateVec );
+    stUniform3fv( uniformLoc(program, U_TRANS), 1, translateVec );
+    stUniform3fv( uniformLoc(program, U_SCALE), 1, scaleVec );
+
+    memcpy( modelViewMat, mv, sizeof(modelViewMat) );
+    memcpy( normalMat, n, sizeof(normalMat) );
+
+    loadMatrices( program );
+}
+
+///
+// This function estimates the radius, in pixels, at which a sphere
+// appears on the screen through the frustum projection, for a camera
+// whose view matrix has already been computed by viewMatrix().
+//
+// @param view   - the view matrix (16 values, column-major)
+// @param center - the sphere's center, in world coordinates
+// @param radius - the sphere's radius, in world coordinates
+// @param height - height of the viewport, in pixels
+//
+// @return the radius on the screen (very large if the sphere reaches
+//    the eye)
+///
+GLfloat screenRadius( const GLfloat *view, const GLfloat *center,
+    GLfloat radius, int height )
+{
+    // distance in front of the eye
+    GLfloat z = -(view[2] * center[0] + view[6] * center[1] +
+        view[10] * center[2] + view[14]);
+
+    if( z <= radius ) {
+        return 1.0e30f;
+    }
+
+    // the projection maps a height of (cwTop - cwBottom) at the near
+    // plane onto the whole viewport
+    GLfloat scale = (2.0f * cwNear) / (cwTop - cwBottom);
+
+    return radius * scale / z * (0.5f * height);
 }
@@ -18,17 +18,35 @@
 #include <windows.h>
 #endif
 
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
 #ifndef __APPLE__
 #include <GL/glew.h>
 #endif
 
 #include <GLFW/glfw3.h>
+#endif
 
 #include "Tuple.h"
 
+///
+// The matrices most recently computed by the functions below, in the
+// column-major order GLSL expects.  The model-view and normal matrices
+// are computed by setUpTransforms() and clearTransforms() from the view
+// matrix, so the camera must be set up first.
+///
+extern GLfloat modelMat[16];
+extern GLfloat viewMat[16];
+extern GLfloat projMat[16];
+extern GLfloat modelViewMat[16];
+extern GLfloat normalMat[9];
+
 ///
 // This function sets up the view and projection parameter for a frustum
-// projection of the scene.
+// projection of the scene.  Both the clipping window parameters and
+// the projection matrix are sent to the shader.
 //
 // @param program - The ID of an OpenGL (GLSL) shader program to which
 //    parameter values are to be sent
@@ -48,7 +66,8 @@ void clearTransforms( GLuint program );
 ///
 // This function sets up the transformation parameters for the vertices
 // of the teapot.  The order of application is specified in the driver
-// program.
+// program.  Both the parameters and the resulting model-view and normal
+// matrices are sent to the shader.
 //
 // @param program - The ID of an OpenGL (GLSL) shader program to which
 //    parameter values are to be sent
@@ -70,7 +89,7 @@ void clearCamera( GLuint program );
 
 ///
 // This function sets up the camera parameters controlling the viewing
-// transformation.
+// transformation, and computes the view matrix and sends it down too.
 //
 // @param program - The ID of an OpenGL (GLSL) shader program to which
 //    parameter values are to be sent
@@ -80,4 +99,107 @@ void clearCamera( GLuint program );
 ///
 void setUpCamera( GLuint program, Tuple eye, Tuple lookat, Tuple up );
 
+///
+// This function sets up the position of the light source, sending it to
+// the shader both in world coordinates and in eye coordinates (using
+// the view matrix from the most recent camera setup).
+//
+// @param program - The ID of an OpenGL (GLSL) shader program to which
+//    parameter values are to be sent
+// @param pos     - light position, in world coordinates
+///
+void setUpLightPosition( GLuint program, Tuple pos );
+
+///
+// This function computes the model matrix for a set of transformations,
+// without sending anything to a shader.
+//
+// @param scale  - scale factors for each axis
+// @param rotate - rotation angles around the three axes, in degrees
+// @param xlate  - amount of translation along each axis
+// @param m      - the resulting matrix (16 values, column-major)
+///
+void modelMatrix( Tuple scale, Tuple rotate, Tuple xlate, GLfloat *m );
+
+///
+// This function computes the normal matrix (the inverse transpose of
+// the upper 3x3) for a transformation matrix.
+//
+// @param m - the transformation (16 values, column-major)
+// @param n - the resulting normal matrix (9 values, column-major)
+///
+void normalMatrix( const GLfloat *m, GLfloat *n );
+
+///
+// This function computes the combined projection and view matrix for
+// a camera, without sending anything to a shader or changing the
+// current matrices.
+//
+// @param eye    - camera location
+// @param lookat - lookat point
+// @param up     - the up vector
+// @param m      - the resulting matrix (16 values, column-major)
+///
+void viewProjMatrix( Tuple eye, Tuple lookat, Tuple up, GLfloat *m );
+
+///
+// This function computes the view matrix for a camera, without sending
+// anything to a shader or changing the current matrices.
+//
+// @param eye    - camera location
+// @param lookat - lookat point
+// @param up     - the up vector
+// @param m      - the resulting matrix (16 values, column-major)
+///
+void viewMatrix( Tuple eye, Tuple lookat, Tuple up, GLfloat *m );
+
+///
+// This function computes the model, model-view, and normal matrices
+// for a set of transformations, the same way setUpTransforms() does,
+// without sending anything to a shader or changing the current
+// matrices.  It may be called from several threads at once.
+//
+// @param view   - the view matrix (16 values, column-major)
+// @param scale  - scale factors for each axis
+// @param rotate - rotation angles around the three axes, in degrees
+// @param xlate  - amount of translation along each axis
+// @param model  - the resulting model matrix (16 values)
+// @param mv     - the resulting model-view matrix (16 values)
+// @param n      - the resulting normal matrix (9 values)
+///
+void modelViewMatrices( const GLfloat *view, Tuple scale, Tuple rotate,
+    Tuple xlate, GLfloat *model, GLfloat *mv, GLfloat *n );
+
+///
+// This function sets up the transformation parameters for an object
+// whose model-view and normal matrices have already been computed by
+// modelViewMatrices(), and sends them down to the shader.
+//
+// @param program - The ID of an OpenGL (GLSL) shader program to which
+//    parameter values are to be sent
+// @param scale  - scale factors for each axis
+// @param rotate - rotation angles around the three axes, in degrees
+// @param xlate  - amount of translation along each axis
+// @param mv     - the model-view matrix (16 values, column-major)
+// @param n      - the normal matrix (9 values, column-major)
+///
+void setUpModelView( GLuint program, Tuple scale, Tuple rotate,
+    Tuple xlate, const GLfloat *mv, const GLfloat *n );
+
+///
+// This function estimates the radius, in pixels, at which a sphere
+// appears on the screen through the frustum projection, for a camera
+// whose view matrix has already been computed by viewMatrix().
+//
+// @param view   - the view matrix (16 values, column-major)
+// @param center - the sphere's center, in world coordinates
+// @param radius - the sphere's radius, in world coordinates
+// @param height - height of the viewport, in pixels
+//
+// @return the radius on the screen (very large if the sphere reaches
+//    the eye)
+///
+GLfloat screenRadius( const GLfloat *view, const GLfloat *center,
+    GLfloat radius, int height );
+
 #endif
@@ -0,0 +1,176 @@
+///
+//  WorkerPool.cpp
+//
+//  A small pool of worker threads for splitting a loop over disjoint
+//  ranges of indices.
+///
+
+#include <algorithm>
+
+#include "WorkerPool.h"
+
+///
+// Constructor
+//
+// @param threads - number of threads to use, including the caller
+//                  of run() (0 means one per hardware thread)
+///
+WorkerPool::WorkerPool( int threads ) :
+    job(NULL), count(0), chunk(0), next(0), busy(0), generation(0),
+    stopping(false) {
+    start( threads );
+}
+
+///
+// Destructor - stop and join the workers
+///
+WorkerPool::~WorkerPool( void ) {
+    stop();
+}
+
+///
+// size() - the number of threads used, including the caller
+///
+int WorkerPool::size( void ) const {
+    return (int) workers.size() + 1;
+}
+
+///
+// resize() - change the number of threads
+//
+// @param threads - as for the constructor
+///
+void WorkerPool::resize( int threads ) {
+    stop();
+    start( threads );
+}
+
+///
+// start() - start the workers (all but one of 'threads')
+///
+void WorkerPool::start( int threads ) {
+
+    if( threads <= 0 ) {
+        threads = (int) thread::hardware_concurrency();
+    }
+
+    stopping = false;
+    for( int i = 1; i < threads; ++i ) {
+        workers.push_back( thread(&WorkerPool::work, this, generation) );
+    }
+}
+
+///
+// stop() - tell the workers to finish, and wait for them
+///
+void WorkerPool::stop( void ) {
+
+    {
+        lock_guard<mutex> l( lock );
+        stopping = true;
+    }
+    wake.notify_all();
+
+    for( size_t i = 0; i < workers.size(); ++i ) {
+        workers[i].join();
+    }
+    workers.clear();
+}
+
+///
+// take() - claim the next range of the current job
+//
+// @return false if there is nothing left to claim
+///
+bool WorkerPool::take( size_t &begin, size_t &end ) {
+
+    lock_guard<mutex> l( lock );
+
+    if( next >= count ) {
+        return false;
+    }
+
+    begin = next;
+    end = min( count, next + chunk );
+    next = end;
+    return true;
+}
+
+///
+// work() - the body of each worker:  wait for a job, help with it,
+//     and say when done
+//
+// @param seen - the last job started before this worker was (which
+//               it must not wait for, but must not miss the next one
+//               either, even if that starts before this thread does)
+///
+void WorkerPool::work( unsigned long seen ) {
+
+    unique_lock<mutex> l( lock );
+
+    for( ;; ) {
+        while( !stopping && generation == seen ) {
+            wake.wait( l );
+        }
+        if( stopping ) {
+            return;
+        }
+        seen = generation;
+        const Job *j = job;
+        l.unlock();
+
+        size_t begin, end;
+        while( take(begin, end) ) {
+            (*j)( begin, end );
+        }
+
+        l.lock();
+        if( --busy == 0 ) {
+            done.notify_all();
+        }
+    }
+}
+
+///
+// run() - call 'job' for ranges covering 0..count-1, in parallel,
+//     and wait for all of them to finish
+//
+// @param count - the number of indices
+// @param grain - the smallest range worth handing out
+// @param job   - the work function
+///
+void WorkerPool::run( size_t count, size_t grain, const Job &job ) {
+
+    if( count == 0 ) {
+        return;
+    }
+
+    // not worth waking anybody up
+    if( workers.empty() || count <= grain ) {
+        job( 0, count );
+        return;
+    }
+
+    {
+        lock_guard<mutex> l( lock );
+        this->job = &job;
+        this->count = count;
+        // a few ranges per thread, so that a slow one can be made up for
+        chunk = max( grain, count / (4 * size()) );
+        next = 0;
+        busy = (int) workers.size();
+        ++generation;
+    }
+    wake.notify_all();
+
+    size_t begin, end;
+    while( take(begin, end) ) {
+        job( begin, end );
+    }
+
+    unique_lock<mutex> l( lock );
+    while( busy > 0 ) {
+        done.wait( l );
+    }
+    this->job = NULL;
+}
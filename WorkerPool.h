@@ -0,0 +1,88 @@
+///
+//  WorkerPool.h
+//
+//  A small pool of worker threads for splitting a loop over disjoint
+//  ranges of indices.
+//
+//  run() hands out the ranges to the workers and to the calling
+//  thread, and returns when all of them are done.  The pool never
+//  makes GL calls, so the work function must not either.
+///
+
+#ifndef _WORKERPOOL_H_
+#define _WORKERPOOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+///
+// The pool
+///
+class WorkerPool {
+
+public:
+
+    // the work function:  process indices begin..end-1
+    typedef function<void( size_t begin, size_t end )> Job;
+
+    ///
+    // Constructor
+    //
+    // @param threads - number of threads to use, including the caller
+    //                  of run() (0 means one per hardware thread)
+    ///
+    WorkerPool( int threads = 0 );
+
+    ///
+    // Destructor - stop and join the workers
+    ///
+    ~WorkerPool( void );
+
+    ///
+    // size() - the number of threads used, including the caller
+    ///
+    int size( void ) const;
+
+    ///
+    // resize() - change the number of threads
+    //
+    // @param threads - as for the constructor
+    ///
+    void resize( int threads );
+
+    ///
+    // run() - call 'job' for ranges covering 0..count-1, in parallel,
+    //     and wait for all of them to finish
+    //
+    // @param count - the number of indices
+    // @param grain - the smallest range worth handing out
+    // @param job   - the work function
+    ///
+    void run( size_t count, size_t grain, const Job &job );
+
+private:
+
+    vector<thread> workers;
+
+    // the current job, guarded by 'lock'
+    mutex lock;
+    condition_variable wake, done;
+    const Job *job;
+    size_t count, chunk, next;
+    int busy;                   // workers still working on this job
+    unsigned long generation;   // bumped for each new job
+    bool stopping;
+
+    void start( int threads );
+    void stop( void );
+    void work( unsigned long seen );
+    bool take( size_t &begin, size_t &end );
+};
+
+#endif
@@ -0,0 +1,1988 @@
+///
+//  finalBench.cpp
+//
+//  Benchmarks for the still life renderer.
+//
+//  Usage:  final_bench [mode] [options]
+//
+//  Modes:
+//
+//    frame  (default) [-n frames] [-r reps] [-w width] [-h height]
+//        Times init(), repeated createShape() calls for each object
+//        type, and 'frames' calls of display() (each followed by
+//        glFinish(), so the GPU work is included), rendering offscreen.
+//        Also counts the GL calls made by BufferSet::selectBuffers()
+//        in the first frame (which builds the vertex array objects)
+//        and in each frame after that.  display() is timed with and
+//        without instanced drawing, and the render queue's draws,
+//        indirect commands, program switches, buffer binds, material
+//        changes and culled objects per frame are reported for each,
+//        along with the triangles submitted at the levels of detail
+//        chosen and at full detail.
+//
+//    mesh   [-t triangles] [-r reps]
+//        Times building a synthetic indexed mesh in a Canvas one
+//        triangle at a time, the same with Canvas::reserve(), and
+//        with a single Canvas::addTriangles() call.  No GL needed.
+//
+//    shapes [-r reps]
+//        Times generating the sphere, cone and cylinder at a range of
+//        tessellations, from a handful of triangles to over 100000,
+//        and reports the triangles generated per second at each.  No
+//        GL needed.
+//
+//    layout [-t triangles] [-r reps] [-w width] [-h height]
+//        Draws a finely tessellated grid (positions, normals, and
+//        (u,v) data) with a pass-through shader, so that vertex fetch
+//        dominates, from a LAYOUT_PLANAR BufferSet, a LAYOUT_INTERLEAVED
+//        one, and each of the quantized layouts, and reports the
+//        bytes per vertex of each and the largest position, normal and
+//        (u,v) errors of the quantized ones.
+//
+//    transform [-t triangles] [-r reps] [-w width] [-h height]
+//        Draws the same grid, small and lit, with the Phong shader,
+//        once using phong.vert (which builds its matrices for every
+//        vertex) and once using phong_mat.vert (which is given the
+//        matrices computed by Viewing.cpp), each with its matching
+//        fragment shader.
+//
+//    instance [-c copies] [-r reps] [-w width] [-h height]
+//        Draws 'copies' small flowers (cones, in several materials),
+//        once with a drawShape() call for each and once with a single
+//        drawInstances() call (including building the instance data).
+//
+//    ring   [-c copies] [-r reps] [-w width] [-h height]
+//        Draws the 'copies' flowers from 'instance' as separate draws
+//        through the render queue, once setting each one's transforms
+//        and material with uniforms, and once writing them as records
+//        into the persistently mapped ring buffer, and counts the GL
+//        state calls each way takes per frame.
+//
+//    arena  [-c copies] [-r reps] [-w width] [-h height]
+//        Builds 'copies' meshes (spheres, cones, cylinders and teapots)
+//        both with buffers of their own and in one geometry arena, and
+//        draws them all:  binding each mesh's buffers in turn, moving
+//        through the arena with glDrawElementsBaseVertex(), and with
+//        one glMultiDrawElementsBaseVertex() call.  Then times
+//        releasing two meshes in every three (which compacts the
+//        arena) and adding them back.
+//
+//    indirect [-c copies] [-r reps] [-w width] [-h height]
+//        Draws the 'copies' flowers from 'instance' as records through
+//        the render queue, once with a draw call for each and once as
+//        indirect commands (one call for the lot), with the flowers
+//        standing still (so the command list can be reused) and with
+//        them turning (so it must be sent every frame).
+//
+//    batch  [-c copies] [-r reps] [-w width] [-h height]
+//        Draws the 'copies' flowers from 'instance' as records through
+//        the render queue, and baked into static batches, both with
+//        every flower still and with one of them turning (so that its
+//        batch is rebuilt every frame).
+//
+//    cull   [-o objects] [-r reps]
+//        Scatters 'objects' unit spheres, randomly scaled and placed,
+//        around the scene's camera and times finding their world
+//        bounding spheres and culling them against the view frustum,
+//        both four at a time (SSE) and one at a time.  No GL needed.
+//
+//    lod    [-o objects] [-r reps] [-n frames] [-w width] [-h height]
+//        Scatters 'objects' spheres as for 'cull' and times choosing
+//        a level of detail for each, reporting the triangles they take
+//        at full detail and at the levels chosen.  Then makes one
+//        sphere grow and shrink, with some jitter, across the size at
+//        which it changes level for 'frames' frames, and counts how
+//        often it changes level with and without hysteresis.
+//
+//    vcache [-t triangles] [-r reps] [-w width] [-h height]
+//        Builds the teapot, a finely tessellated sphere and the grid
+//        from 'layout' both as they are generated and after
+//        Canvas::optimize(), and reports the time optimize() takes,
+//        each order's simulated ACMR and ATVR, and the vertex and
+//        fragment shader invocations and time taken to draw each (the
+//        invocations only where the GL has ARB_pipeline_statistics_query;
+//        otherwise the simulated transforms are reported instead).
+//
+//    prep   [-o objects] [-r reps] [-w width] [-h height]
+//        Submits 'objects' cones, scattered as for 'cull', to the
+//        render queue and times preparing them (matrices, culling,
+//        sort keys) and the whole flush, with 1, 2, 4, ... threads up
+//        to the number of hardware threads (at least 4).  Without -o,
+//        this is done for 10000 and for 100000 objects.
+//
+//    meshcache [-r reps] [-w width] [-h height]
+//        Times creating the scene's meshes (at full detail) by building
+//        them through a Canvas and by loading them from mesh files, and
+//        the same for a sphere of over 250000 triangles, reporting the
+//        time to write its file and the file's size too.  The files are
+//        written to the temporary directory and removed afterwards.
+//
+//    import [-t triangles] [-r reps]
+//        Writes the grid from 'layout' (positions, normals and (u,v)
+//        data) to an OBJ file and a binary PLY file in the temporary
+//        directory, and times importing each into a Canvas with 1, 2,
+//        4, ... threads up to the number of hardware threads (at least
+//        4), reporting MB/s and triangles/s.  A third file, the PLY one
+//        with face 10 made a quad, checks (and times) the fallback from
+//        triangles split among threads to reading faces one by one;
+//        every import must give the expected number of triangles.  No
+//        GL needed.
+//
+//  Every measured quantity is written to stdout as one JSON object
+//  per line:
+//
+//    {"bench":"display","unit":"ms","count":2000,"min":...,
+//     "median":...,"p99":...,"max":...,"mean":...}
+//
+//  so that results can be collected and compared by scripts.  Counts
+//  are written the same way, with "unit":"calls" and a single "value";
+//  ratios, such as ACMR, likewise have a single (fractional) "value".
+///
+
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Headless.h"
+#include "Canvas.h"
+#include "Buffers.h"
+#include "Shapes.h"
+#include "Shape_Nonorm.h"
+#include "ShaderSetup.h"
+#include "Viewing.h"
+#include "Lighting.h"
+#include "RenderQueue.h"
+#include "Culling.h"
+#include "GeometryArena.h"
+#include "CommandBuffer.h"
+#include "StaticBatch.h"
+#include "LevelOfDetail.h"
+#include "GLState.h"
+#include "MeshCache.h"
+#include "MeshImport.h"
+
+using namespace std;
+
+///
+// Scene entry points and state, from finalMain.cpp
+///
+extern int w_width;
+extern int w_height;
+void init( void );
+void display( void );
+void createShape( int obj, BufferSet *B, CacheStats *cache = NULL );
+void quit( int status );
+extern bool instancing;
+extern GLuint pshader, ishader, bshader;
+extern LodChain sphereLod, coneLod;
+extern LodStats lodStats;
+extern Tuple eye, lookat, up;
+extern RenderQueue queue;
+extern WorkerPool workers;
+extern RingBuffer ring;
+extern CommandBuffer commands;
+extern StaticBatcher batcher;
+extern bool batching;
+extern const char *meshCache;
+
+// how long to run; all of these can be changed on the command line
+static int frames = 2000;
+static int reps = 0;            // 0 means "the default for this mode"
+static int triangles = 1000000;
+static int copies = 1000;
+static int objects = 0;          // 0 means "the default for this mode"
+
+// frames drawn (and discarded) before timing begins
+static const int WARMUP = 10;
+
+typedef chrono::steady_clock Clock;
+
+///
+// Milliseconds elapsed since 'start'
+///
+static double elapsed( Clock::time_point start )
+{
+    return chrono::duration<double, milli>( Clock::now() - start ).count();
+}
+
+///
+// report(name,samples) - print summary statistics for a set of
+//     timings as a single JSON line
+//
+// @param name    - name of the measured quantity
+// @param samples - the timings, in milliseconds (sorted in place)
+///
+static void report( const char *name, vector<double> &samples )
+{
+    if( samples.empty() ) {
+        return;
+    }
+
+    sort( samples.begin(), samples.end() );
+
+    size_t n = samples.size();
+    double sum = 0.0;
+    for( size_t i = 0; i < n; ++i ) {
+        sum += samples[i];
+    }
+
+    // nearest-rank percentiles
+    double median = samples[ (n - 1) / 2 ];
+    size_t rank = (size_t) ((99 * n + 99) / 100);
+    double p99 = samples[ rank - 1 ];
+
+    printf( "{\"bench\":\"%s\",\"unit\":\"ms\",\"count\":%lu,"
+            "\"min\":%.6f,\"median\":%.6f,\"p99\":%.6f,\"max\":%.6f,"
+            "\"mean\":%.6f}\n",
+            name, (unsigned long) n, samples[0], median, p99,
+            samples[n - 1], sum / n );
+    fflush( stdout );
+}
+
+///
+// reportCount(name,unit,value) - print a single count as a JSON line
+//
+// @param name  - name of the counted quantity
+// @param unit  - what was counted
+// @param value - the count
+///
+static void reportCount( const char *name, const char *unit, long value )
+{
+    printf( "{\"bench\":\"%s\",\"unit\":\"%s\",\"value\":%ld}\n",
+            name, unit, value );
+    fflush( stdout );
+}
+
+///
+// reportRatio(name,unit,value) - print a single ratio as a JSON line
+//
+// @param name  - name of the measured quantity
+// @param unit  - what it is a ratio of
+// @param value - the ratio
+///
+static void reportRatio( const char *name, const char *unit, double value )
+{
+    printf( "{\"bench\":\"%s\",\"unit\":\"%s\",\"value\":%.6f}\n",
+            name, unit, value );
+    fflush( stdout );
+}
+
+///
+// Time repeated creation of one type of shape
+//
+// @param name - name to report the timings under
+// @param obj  - which shape to create
+///
+static void benchShape( const char *name, int obj )
+{
+    BufferSet scratch;
+    vector<double> samples;
+
+    for( int i = 0; i < reps; ++i ) {
+        Clock::time_point start = Clock::now();
+        createShape( obj, &scratch );
+        glFinish();
+        samples.push_back( elapsed(start) );
+    }
+
+    report( name, samples );
+
+    stDeleteBuffers( 1, &scratch.vbuffer );
+    stDeleteBuffers( 1, &scratch.ebuffer );
+}
+
+///
+// Simple deterministic pseudo-random numbers in [0,1), so that every
+// run builds exactly the same synthetic mesh
+///
+static unsigned int seed = 12345;
+
+static float frand( void )
+{
+    seed = seed * 1664525u + 1013904223u;
+    return (seed >> 8) * (1.0f / 16777216.0f);
+}
+
+///
+// Add an indexed mesh to a Canvas the way the shape functions used
+// to, one addTriangleWithNorms() call per triangle
+///
+static void addOneByOne( Canvas &C, const vector<float> &positions,
+    const vector<float> &norms, const vector<int> &elements )
+{
+    for( size_t t = 0; t < elements.size(); t += 3 ) {
+        const int *e = &elements[t];
+        const float *p0 = &positions[3 * e[0]];
+        const float *p1 = &positions[3 * e[1]];
+        const float *p2 = &positions[3 * e[2]];
+        const float *n0 = &norms[3 * e[0]];
+        const float *n1 = &norms[3 * e[1]];
+        const float *n2 = &norms[3 * e[2]];
+        Vertex v0 = { p0[0], p0[1], p0[2] };
+        Vertex v1 = { p1[0], p1[1], p1[2] };
+        Vertex v2 = { p2[0], p2[1], p2[2] };
+        Normal m0 = { n0[0], n0[1], n0[2] };
+        Normal m1 = { n1[0], n1[1], n1[2] };
+        Normal m2 = { n2[0], n2[1], n2[2] };
+        C.addTriangleWithNorms( v0, m0, v1, m1, v2, m2 );
+    }
+}
+
+///
+// Mesh construction benchmark
+///
+static void benchMesh( void )
+{
+    // an indexed mesh with (roughly) one vertex per two triangles,
+    // as in a typical closed surface
+    int nv = triangles / 2 + 3;
+    vector<float> positions( 3 * nv );
+    vector<float> norms( 3 * nv );
+    vector<int> elements( 3 * (size_t) triangles );
+
+    for( size_t i = 0; i < positions.size(); ++i ) {
+        positions[i] = frand() - 0.5f;
+        norms[i] = frand() - 0.5f;
+    }
+    for( size_t i = 0; i < elements.size(); ++i ) {
+        elements[i] = (int) (frand() * nv);
+    }
+
+    vector<double> perTriangle, reserved, bulk;
+
+    // each run starts with a fresh Canvas, since clear() keeps the
+    // capacity that earlier runs have grown
+    for( int r = 0; r < reps; ++r ) {
+
+        // the original way: one addTriangleWithNorms() per triangle
+        Canvas *C = new Canvas( w_width, w_height );
+        Clock::time_point start = Clock::now();
+        addOneByOne( *C, positions, norms, elements );
+        perTriangle.push_back( elapsed(start) );
+        delete C;
+
+        // the same, with the capacity reserved up front
+        C = new Canvas( w_width, w_height );
+        start = Clock::now();
+        C->reserve( triangles, 0 );
+        addOneByOne( *C, positions, norms, elements );
+        reserved.push_back( elapsed(start) );
+        delete C;
+
+        // one bulk append
+        C = new Canvas( w_width, w_height );
+        start = Clock::now();
+        C->addTriangles( triangles, &positions[0], &norms[0], NULL,
+            &elements[0] );
+        bulk.push_back( elapsed(start) );
+        delete C;
+    }
+
+    report( "mesh.addTriangleWithNorms", perTriangle );
+    report( "mesh.reserve+addTriangleWithNorms", reserved );
+    report( "mesh.addTriangles", bulk );
+}
+
+///
+// Time generating one shape at one tessellation
+//
+// @param name   - name of the shape
+// @param make   - its generator
+// @param slices - divisions around its axis
+// @param stacks - divisions along its axis
+///
+static void benchGenerate( const char *name,
+    void (*make)( Canvas &, int, int ), int slices, int stacks )
+{
+    Canvas C( w_width, w_height );
+    vector<double> samples;
+
+    for( int r = 0; r < reps + WARMUP; ++r ) {
+        C.clear();
+        Clock::time_point start = Clock::now();
+        make( C, slices, stacks );
+        if( r >= WARMUP ) {
+            samples.push_back( elapsed(start) );
+        }
+    }
+
+    long tris = C.numIndices() / 3;
+    char label[64];
+    snprintf( label, sizeof(label), "shapes.%s.%dx%d", name, slices, stacks );
+    report( label, samples );
+
+    string count = string( label ) + ".triangles";
+    reportCount( count.c_str(), "triangles", tris );
+
+    // samples are sorted by report(); use the median
+    double ms = samples[ (samples.size() - 1) / 2 ];
+    string rate = string( label ) + ".rate";
+    reportCount( rate.c_str(), "triangles/s",
+        ms > 0.0 ? (long) (tris * 1000.0 / ms) : 0 );
+}
+
+///
+// Shape generation benchmark
+///
+static void benchShapes( void )
+{
+    // slices and stacks, from 8 triangles (for the sphere) to over
+    // 100000 (for all three)
+    static const int sizes[][2] = {
+        { 4, 2 }, { 10, 10 }, { 32, 32 }, { 100, 100 }, { 256, 256 }
+    };
+    int n = sizeof(sizes) / sizeof(sizes[0]);
+
+    for( int i = 0; i < n; ++i ) {
+        benchGenerate( "sphere", makeSphere, sizes[i][0], sizes[i][1] );
+    }
+    for( int i = 0; i < n; ++i ) {
+        benchGenerate( "cone", makeCone, sizes[i][0], sizes[i][1] );
+    }
+    for( int i = 0; i < n; ++i ) {
+        benchGenerate( "cylinder", makeCylinder, sizes[i][0], sizes[i][1] );
+    }
+}
+
+///
+// Build a grid of about 'triangles' triangles covering clip space,
+// with normals and (u,v) data, as an indexed mesh in 'C'
+///
+static void makeGrid( Canvas &C )
+{
+    int g = 2;
+    while( 2 * (g - 1) * (g - 1) < triangles ) {
+        ++g;
+    }
+
+    vector<float> positions, norms, texCoords;
+    vector<int> elements;
+
+    for( int j = 0; j < g; ++j ) {
+        for( int i = 0; i < g; ++i ) {
+            float u = i / (float) (g - 1);
+            float v = j / (float) (g - 1);
+            positions.push_back( 2.0f * u - 1.0f );
+            positions.push_back( 2.0f * v - 1.0f );
+            positions.push_back( 0.0f );
+            norms.push_back( u - 0.5f );
+            norms.push_back( v - 0.5f );
+            norms.push_back( 1.0f );
+            texCoords.push_back( u );
+            texCoords.push_back( v );
+        }
+    }
+
+    for( int j = 0; j < g - 1; ++j ) {
+        for( int i = 0; i < g - 1; ++i ) {
+            int k = j * g + i;
+            int quad[6] = { k, k + 1, k + g, k + 1, k + g + 1, k + g };
+            elements.insert( elements.end(), quad, quad + 6 );
+        }
+    }
+
+    C.addTriangles( (int) elements.size() / 3, &positions[0], &norms[0],
+        &texCoords[0], &elements[0] );
+    C.weld();
+}
+
+///
+// Compile and link a program from source strings (the shader files
+// used by the real program are read by shaderSetup() instead)
+///
+static GLuint makeProgram( const char *vsrc, const char *fsrc )
+{
+    GLuint vs = glCreateShader( GL_VERTEX_SHADER );
+    GLuint fs = glCreateShader( GL_FRAGMENT_SHADER );
+    glShaderSource( vs, 1, &vsrc, NULL );
+    glShaderSource( fs, 1, &fsrc, NULL );
+    glCompileShader( vs );
+    glCompileShader( fs );
+
+    GLuint program = glCreateProgram();
+    glAttachShader( program, vs );
+    glAttachShader( program, fs );
+    glLinkProgram( program );
+
+    GLint linked;
+    glGetProgramiv( program, GL_LINK_STATUS, &linked );
+    if( !linked ) {
+        cerr << "benchmark shader failed to link" << endl;
+        quit( 1 );
+    }
+
+    return program;
+}
+
+///
+// Vertex layout benchmark
+///
+static void benchLayout( void )
+{
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    static const char *vsrc =
+        "#version 130\n"
+        "in vec4 vPosition;\n"
+        "in vec3 vNormal;\n"
+        "in vec2 vTexCoord;\n"
+        "uniform mat4 place;\n"
+        "out vec4 color;\n"
+        "void main() {\n"
+        "    gl_Position = place * vPosition;\n"
+        "    color = vec4( vNormal, vTexCoord.x + vTexCoord.y );\n"
+        "}\n";
+    static const char *fsrc =
+        "#version 130\n"
+        "in vec4 color;\n"
+        "out vec4 finalColor;\n"
+        "void main() {\n"
+        "    finalColor = color;\n"
+        "}\n";
+
+    GLuint program = makeProgram( vsrc, fsrc );
+    stUseProgram( program );
+
+    Canvas C( w_width, w_height );
+    makeGrid( C );
+
+    const int NLAYOUTS = 4;
+    BufferSet sets[NLAYOUTS] = {
+        BufferSet( LAYOUT_PLANAR ), BufferSet( LAYOUT_INTERLEAVED ),
+        BufferSet( LAYOUT_QUANTIZED ), BufferSet( LAYOUT_QUANTIZED_HALF )
+    };
+    const char *names[NLAYOUTS] = {
+        "layout.planar", "layout.interleaved", "layout.quantized",
+        "layout.quantizedHalf"
+    };
+    vector<double> samples[NLAYOUTS];
+    GLfloat place[NLAYOUTS][16];
+    GLint placeLoc = glGetUniformLocation( program, "place" );
+
+    for( int l = 0; l < NLAYOUTS; ++l ) {
+        sets[l].createBuffers( C );
+        long bytes = sets[l].vSize + sets[l].cSize + sets[l].nSize +
+            sets[l].tSize;
+        cerr << names[l] << ": " << sets[l].numVertices << " vertices, " <<
+            bytes / sets[l].numVertices << " bytes/vertex" << endl;
+        string name = names[l];
+        reportCount( (name + ".bytes").c_str(), "bytes/vertex",
+            bytes / sets[l].numVertices );
+
+        for( int i = 0; i < 16; ++i ) {
+            place[l][i] = (i % 5 == 0) ? 1.0f : 0.0f;
+        }
+        sets[l].positionTransform( place[l] );
+
+        if( l >= 2 ) {
+            const QuantError &e = sets[l].quantError;
+            reportRatio( (name + ".error.position").c_str(), "units",
+                e.position );
+            reportRatio( (name + ".error.normal").c_str(), "degrees",
+                e.normal );
+            reportRatio( (name + ".error.uv").c_str(), "units", e.uv );
+        }
+    }
+
+    // alternate between the layouts, so neither gets a warmer cache
+    for( int r = 0; r < reps + WARMUP; ++r ) {
+        for( int l = 0; l < NLAYOUTS; ++l ) {
+            Clock::time_point start = Clock::now();
+            sets[l].selectBuffers( program, "vPosition", NULL,
+                "vNormal", "vTexCoord" );
+            glUniformMatrix4fv( placeLoc, 1, GL_FALSE, place[l] );
+            glDrawElements( GL_TRIANGLES, sets[l].numElements,
+                GL_UNSIGNED_INT, (void *)0 );
+            glFinish();
+            if( r >= WARMUP ) {
+                samples[l].push_back( elapsed(start) );
+            }
+        }
+    }
+
+    for( int l = 0; l < NLAYOUTS; ++l ) {
+        report( names[l], samples[l] );
+    }
+
+    headlessFinish();
+}
+
+///
+// Vertex transformation benchmark
+///
+static void benchTransform( void )
+{
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    const int NSHADERS = 2;
+    const char *vert[NSHADERS] = { "phong.vert", "phong_mat.vert" };
+    const char *frag[NSHADERS] = { "phong.frag", "phong_mat.frag" };
+    const char *names[NSHADERS] = {
+        "transform.perVertex", "transform.perDraw"
+    };
+    GLuint programs[NSHADERS];
+    vector<double> samples[NSHADERS];
+
+    for( int p = 0; p < NSHADERS; ++p ) {
+        ShaderError error;
+        programs[p] = shaderSetup( vert[p], frag[p], &error );
+        if( !programs[p] ) {
+            cerr << "Error setting up " << vert[p] << " - " <<
+                errorString(error) << endl;
+            quit( 1 );
+        }
+    }
+
+    initMaterials();
+    bindMaterialBlocks( programs[1] );
+
+    Canvas C( w_width, w_height );
+    makeGrid( C );
+    BufferSet grid;
+    grid.createBuffers( C );
+
+    glEnable( GL_DEPTH_TEST );
+
+    // keep the grid small on screen, so that vertex work dominates
+    Tuple eye = { 0.0f, 1.25f, 6.5f };
+    Tuple lookat = { 0.0f, 0.8f, 0.0f };
+    Tuple up = { 0.0f, 5.0f, 0.0f };
+    Tuple scale = { 0.2f, 0.2f, 0.2f };
+    Tuple rotate = { -30.0f, 20.0f, 0.0f };
+    Tuple xlate = { 0.0f, 0.8f, 0.0f };
+
+    // alternate between the shaders, so neither gets a warmer cache
+    for( int r = 0; r < reps + WARMUP; ++r ) {
+        for( int p = 0; p < NSHADERS; ++p ) {
+            Clock::time_point start = Clock::now();
+            glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+            stUseProgram( programs[p] );
+            setUpProjection( programs[p] );
+            setUpCamera( programs[p], eye, lookat, up );
+            setUpTransforms( programs[p], scale, rotate, xlate );
+            setUpPhong( programs[p], OBJ_SPHERE );
+            grid.selectBuffers( programs[p], "vPosition", NULL,
+                "vNormal", NULL );
+            glDrawElements( GL_TRIANGLES, grid.numElements,
+                GL_UNSIGNED_INT, (void *)0 );
+            glFinish();
+            if( r >= WARMUP ) {
+                samples[p].push_back( elapsed(start) );
+            }
+        }
+    }
+
+    for( int p = 0; p < NSHADERS; ++p ) {
+        report( names[p], samples[p] );
+    }
+
+    headlessFinish();
+}
+
+///
+// Instanced drawing benchmark
+///
+static void benchInstance( void )
+{
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    init();
+
+    // a field of small flowers, in several colors
+    static const int flowerMaterials[] = {
+        MATL_FLOWER, MATL_YELLOWFLOWER, MATL_LEAF, MATL_APPLE
+    };
+    int side = 1;
+    while( side * side < copies ) {
+        ++side;
+    }
+
+    InstanceSet flowers( &coneLod.levels[0] );
+    vector<Tuple> scales, rotations, xlates;
+    vector<int> materials;
+    float size = 2.0f / side;
+    for( int i = 0; i < copies; ++i ) {
+        Tuple s = { 0.3f * size, 0.3f * size, 0.3f * size };
+        Tuple r = { 250.0f, 0.0f, (float) ((i * 37) % 360) };
+        Tuple t = { -1.0f + size * (i % side), -1.0f + size * (i / side),
+                    -1.0f };
+        scales.push_back( s );
+        rotations.push_back( r );
+        xlates.push_back( t );
+        materials.push_back( flowerMaterials[i % 4] );
+    }
+
+    vector<double> separate, instanced;
+
+    for( int r = 0; r < reps + WARMUP; ++r ) {
+
+        Clock::time_point start = Clock::now();
+        glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+        for( int i = 0; i < copies; ++i ) {
+            drawShape( pshader, materials[i], coneLod.levels[0], scales[i],
+                rotations[i], xlates[i], eye, lookat, up );
+        }
+        glFinish();
+        if( r >= WARMUP ) {
+            separate.push_back( elapsed(start) );
+        }
+
+        start = Clock::now();
+        glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+        flowers.clear();
+        for( int i = 0; i < copies; ++i ) {
+            flowers.add( materials[i], scales[i], rotations[i], xlates[i] );
+        }
+        drawInstances( ishader, flowers, eye, lookat, up );
+        glFinish();
+        if( r >= WARMUP ) {
+            instanced.push_back( elapsed(start) );
+        }
+    }
+
+    report( "instance.separate", separate );
+    report( "instance.instanced", instanced );
+
+    headlessFinish();
+}
+
+///
+// Ring buffer benchmark
+///
+static void benchRing( void )
+{
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    init();
+
+    if( queue.ring == NULL ) {
+        cerr << "ring: no persistently mapped buffers here" << endl;
+        headlessFinish();
+        return;
+    }
+
+    // the same field of flowers as the instancing benchmark
+    static const int flowerMaterials[] = {
+        MATL_FLOWER, MATL_YELLOWFLOWER, MATL_LEAF, MATL_APPLE
+    };
+    int side = 1;
+    while( side * side < copies ) {
+        ++side;
+    }
+    float size = 2.0f / side;
+
+    const char *names[2] = { "ring.uniforms", "ring.records" };
+    for( int pass = 0; pass < 2; ++pass ) {
+        queue.ring = (pass == 0) ? NULL : &ring;
+
+        vector<double> samples;
+        for( int r = 0; r < reps + WARMUP; ++r ) {
+            Clock::time_point start = Clock::now();
+            glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+            stResetStats();
+            for( int i = 0; i < copies; ++i ) {
+                Tuple s = { 0.3f * size, 0.3f * size, 0.3f * size };
+                Tuple rot = { 250.0f, 0.0f, (float) ((i * 37) % 360) };
+                Tuple t = { -1.0f + size * (i % side),
+                            -1.0f + size * (i / side), -1.0f };
+                if( pass == 0 ) {
+                    queue.submit( pshader, &coneLod.levels[0],
+                        flowerMaterials[i % 4], s, rot, t );
+                } else {
+                    queue.submitRecord( ishader, &coneLod.levels[0],
+                        flowerMaterials[i % 4], s, rot, t );
+                }
+            }
+            queue.flush( eye, lookat, up );
+            glFinish();
+            if( r >= WARMUP ) {
+                samples.push_back( elapsed(start) );
+            }
+        }
+
+        string name = names[pass];
+        report( names[pass], samples );
+        reportCount( (name + ".stateIssued").c_str(), "calls",
+            stateStats.issued );
+        reportCount( (name + ".draws").c_str(), "calls",
+            queue.stats.draws );
+    }
+    reportCount( "ring.waits", "waits", ring.waits );
+
+    headlessFinish();
+}
+
+///
+// Geometry arena benchmark
+///
+static void benchArena( void )
+{
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    init();
+
+    // 'copies' meshes, cycling through the shapes, each built twice:
+    // once with buffers of its own, and once in an arena
+    static const int shapes[] = {
+        OBJ_SPHERE, OBJ_CONE, OBJ_CYLINDER, OBJ_TEAPOT
+    };
+    GeometryArena arena;
+    vector<BufferSet> own( copies ), shared( copies );
+    vector<int> handles( copies );
+    long vertices = 0;
+    for( int i = 0; i < copies; ++i ) {
+        shared[i].arena = &arena;
+        createShape( shapes[i % 4], &own[i] );
+        createShape( shapes[i % 4], &shared[i] );
+        handles[i] = shared[i].handle;
+        vertices += own[i].numVertices;
+    }
+    cerr << "arena: " << copies << " meshes, " << vertices <<
+        " vertices, " << arena.vertexCapacity << " vertex and " <<
+        arena.indexCapacity << " index capacity" << endl;
+
+    // everything drawn small, in one place, so that submitting the
+    // draws is what gets measured
+    Tuple s = { 0.01f, 0.01f, 0.01f };
+    Tuple rot = { 0.0f, 0.0f, 0.0f };
+    Tuple t = { 0.0f, 0.8f, 0.0f };
+
+    const int NPASSES = 3;
+    const char *names[NPASSES] = {
+        "arena.ownBuffers", "arena.baseVertex", "arena.multiDraw"
+    };
+    vector<double> samples[NPASSES];
+    long issued[NPASSES];
+
+    for( int r = 0; r < reps + WARMUP; ++r ) {
+        for( int pass = 0; pass < NPASSES; ++pass ) {
+            Clock::time_point start = Clock::now();
+            glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+            stResetStats();
+            stUseProgram( pshader );
+            setUpProjection( pshader );
+            setUpCamera( pshader, eye, lookat, up );
+            setUpTransforms( pshader, s, rot, t );
+            setUpPhong( pshader, MATL_VASE );
+            if( pass == 2 ) {
+                shared[0].selectBuffers( pshader, "vPosition", NULL,
+                    "vNormal", NULL );
+                arena.draw( &handles[0], copies );
+            } else {
+                vector<BufferSet> &sets = (pass == 0) ? own : shared;
+                for( int i = 0; i < copies; ++i ) {
+                    sets[i].selectBuffers( pshader, "vPosition", NULL,
+                        "vNormal", NULL );
+                    glDrawElementsBaseVertex( GL_TRIANGLES,
+                        sets[i].numElements, GL_UNSIGNED_INT,
+                        sets[i].indexOffset(), sets[i].baseVertex() );
+                }
+            }
+            glFinish();
+            if( r >= WARMUP ) {
+                samples[pass].push_back( elapsed(start) );
+            }
+            issued[pass] = stateStats.issued;
+        }
+    }
+
+    for( int pass = 0; pass < NPASSES; ++pass ) {
+        string name = names[pass];
+        report( names[pass], samples[pass] );
+        reportCount( (name + ".stateIssued").c_str(), "calls",
+            issued[pass] );
+    }
+
+    // give back two meshes in every three, which compacts the arena
+    // along the way, then put them back (filling the space at the end)
+    vector<double> release, refill;
+    for( int r = 0; r < reps; ++r ) {
+        Clock::time_point start = Clock::now();
+        for( int i = 0; i < copies; ++i ) {
+            if( i % 3 == 0 ) {
+                continue;
+            }
+            arena.release( shared[i].handle );
+            shared[i].initBuffer();
+        }
+        glFinish();
+        release.push_back( elapsed(start) );
+
+        start = Clock::now();
+        for( int i = 0; i < copies; ++i ) {
+            if( i % 3 == 0 ) {
+                continue;
+            }
+            createShape( shapes[i % 4], &shared[i] );
+        }
+        glFinish();
+        refill.push_back( elapsed(start) );
+    }
+
+    report( "arena.release", release );
+    report( "arena.refill", refill );
+    reportCount( "arena.compactions", "calls", arena.compactions );
+
+    headlessFinish();
+}
+
+///
+// Indirect drawing benchmark
+///
+static void benchIndirect( void )
+{
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    init();
+
+    if( queue.commands == NULL || coneLod.levels[0].handle < 0 ) {
+        cerr << "indirect: no indirect drawing (or no arena) here" << endl;
+        headlessFinish();
+        return;
+    }
+
+    // the same field of flowers as the instancing benchmark
+    static const int flowerMaterials[] = {
+        MATL_FLOWER, MATL_YELLOWFLOWER, MATL_LEAF, MATL_APPLE
+    };
+    int side = 1;
+    while( side * side < copies ) {
+        ++side;
+    }
+    float size = 2.0f / side;
+
+    // one call per flower; one indirect command per flower, the same
+    // every frame; and the same with the flowers turning, so that the
+    // commands must be sent again every frame
+    const int NPASSES = 3;
+    const char *names[NPASSES] = {
+        "indirect.direct", "indirect.static", "indirect.moving"
+    };
+    for( int pass = 0; pass < NPASSES; ++pass ) {
+        queue.commands = (pass == 0) ? NULL : &commands;
+        long uploads = commands.uploads, reuses = commands.reuses;
+
+        vector<double> samples;
+        for( int r = 0; r < reps + WARMUP; ++r ) {
+            float turn = (pass == 2) ? (float) r : 0.0f;
+            Clock::time_point start = Clock::now();
+            glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+            for( int i = 0; i < copies; ++i ) {
+                Tuple s = { 0.3f * size, 0.3f * size, 0.3f * size };
+                Tuple rot = { 250.0f, 0.0f,
+                              (float) ((i * 37) % 360) + turn };
+                Tuple t = { -1.0f + size * (i % side),
+                            -1.0f + size * (i / side), -1.0f };
+                queue.submitRecord( ishader, &coneLod.levels[0],
+                    flowerMaterials[i % 4], s, rot, t );
+            }
+            queue.flush( eye, lookat, up );
+            glFinish();
+            if( r >= WARMUP ) {
+                samples.push_back( elapsed(start) );
+            }
+        }
+
+        string name = names[pass];
+        report( names[pass], samples );
+        reportCount( (name + ".draws").c_str(), "calls",
+            queue.stats.draws );
+        if( pass > 0 ) {
+            reportCount( (name + ".uploads").c_str(), "calls",
+                commands.uploads - uploads );
+            reportCount( (name + ".reuses").c_str(), "calls",
+                commands.reuses - reuses );
+        }
+    }
+
+    headlessFinish();
+}
+
+///
+// Static batching benchmark
+///
+static void benchBatch( void )
+{
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    // the batcher needs the meshes' vertex data
+    batching = true;
+    init();
+
+    // the same field of flowers as the instancing benchmark
+    static const int flowerMaterials[] = {
+        MATL_FLOWER, MATL_YELLOWFLOWER, MATL_LEAF, MATL_APPLE
+    };
+    int side = 1;
+    while( side * side < copies ) {
+        ++side;
+    }
+    float size = 2.0f / side;
+
+    // the flowers as records through the queue; baked into batches;
+    // and baked, with one flower turning (so that one batch must be
+    // rebuilt every frame)
+    const int NPASSES = 3;
+    const char *names[NPASSES] = {
+        "batch.records", "batch.static", "batch.oneMoving"
+    };
+    for( int pass = 0; pass < NPASSES; ++pass ) {
+        vector<double> samples;
+        long rebuilt = 0;
+        for( int r = 0; r < reps + WARMUP; ++r ) {
+            Clock::time_point start = Clock::now();
+            glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+            for( int i = 0; i < copies; ++i ) {
+                Tuple s = { 0.3f * size, 0.3f * size, 0.3f * size };
+                Tuple rot = { 250.0f, 0.0f, (float) ((i * 37) % 360) };
+                Tuple t = { -1.0f + size * (i % side),
+                            -1.0f + size * (i / side), -1.0f };
+                if( pass == 2 && i == copies / 2 ) {
+                    rot.z += (float) r;
+                }
+                if( pass == 0 ) {
+                    queue.submitRecord( ishader, &coneLod.levels[0],
+                        flowerMaterials[i % 4], s, rot, t );
+                } else {
+                    batcher.add( &coneLod.levels[0], flowerMaterials[i % 4], s,
+                        rot, t );
+                }
+            }
+            if( pass == 0 ) {
+                queue.flush( eye, lookat, up );
+            } else {
+                batcher.flush( bshader, eye, lookat, up );
+            }
+            glFinish();
+            if( r >= WARMUP ) {
+                samples.push_back( elapsed(start) );
+                rebuilt += batcher.stats.rebuilt;
+            }
+        }
+
+        string name = names[pass];
+        report( names[pass], samples );
+        reportCount( (name + ".draws").c_str(), "calls", pass == 0 ?
+            queue.stats.draws : batcher.stats.draws );
+        if( pass > 0 ) {
+            reportCount( (name + ".rebuilt").c_str(), "batches", rebuilt );
+        }
+    }
+    reportCount( "batch.batches", "batches", batcher.size() );
+
+    headlessFinish();
+}
+
+///
+// scatter() - make transformations for objects scattered through a
+//     cube around the camera, only a few percent of which are in view
+//
+// @param n - how many objects
+// @param scales, rotations, xlates - the transformations
+///
+static void scatter( int n, vector<Tuple> &scales, vector<Tuple> &rotations,
+    vector<Tuple> &xlates )
+{
+    srand( 1 );
+    scales.clear();
+    rotations.clear();
+    xlates.clear();
+    for( int i = 0; i < n; ++i ) {
+        float s = 0.1f + 0.9f * rand() / RAND_MAX;
+        Tuple scale = { s, s, s };
+        Tuple rotate = { 360.0f * rand() / RAND_MAX,
+                         360.0f * rand() / RAND_MAX, 0.0f };
+        Tuple xlate = { eye.x + 200.0f * rand() / RAND_MAX - 100.0f,
+                        eye.y + 200.0f * rand() / RAND_MAX - 100.0f,
+                        eye.z + 200.0f * rand() / RAND_MAX - 100.0f };
+        scales.push_back( scale );
+        rotations.push_back( rotate );
+        xlates.push_back( xlate );
+    }
+}
+
+///
+// Frustum culling benchmark
+///
+static void benchCull( void )
+{
+    // a mesh which is a unit sphere, as far as culling is concerned
+    BufferSet unit;
+    unit.radius = 1.0f;
+
+    vector<Tuple> scales, rotations, xlates;
+    scatter( objects, scales, rotations, xlates );
+
+    vector<GLfloat> models( objects * 16 );
+    for( int i = 0; i < objects; ++i ) {
+        modelMatrix( scales[i], rotations[i], xlates[i], &models[i * 16] );
+    }
+
+    GLfloat vp[16];
+    Frustum f;
+    viewProjMatrix( eye, lookat, up, vp );
+    frustumFromMatrix( vp, f );
+
+    SphereSet spheres;
+    vector<unsigned char> simd, scalar;
+    vector<double> bounds, fast, slow;
+    size_t visible = 0;
+
+    for( int r = 0; r < reps + WARMUP; ++r ) {
+
+        Clock::time_point start = Clock::now();
+        spheres.clear();
+        for( int i = 0; i < objects; ++i ) {
+            spheres.add( &unit, &models[i * 16] );
+        }
+        if( r >= WARMUP ) {
+            bounds.push_back( elapsed(start) );
+        }
+
+        start = Clock::now();
+        visible = spheres.cull( f, simd );
+        if( r >= WARMUP ) {
+            fast.push_back( elapsed(start) );
+        }
+
+        start = Clock::now();
+        spheres.cullScalar( f, scalar );
+        if( r >= WARMUP ) {
+            slow.push_back( elapsed(start) );
+        }
+    }
+
+    if( simd != scalar ) {
+        cerr << "cull: SSE and scalar results differ" << endl;
+        exit( 1 );
+    }
+
+    report( "cull.bounds", bounds );
+    report( "cull.simd", fast );
+    report( "cull.scalar", slow );
+    reportCount( "cull.objects", "objects", objects );
+    reportCount( "cull.visible", "objects", (long) visible );
+}
+
+///
+// Level of detail benchmark
+///
+static void benchLod( void )
+{
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    init();
+
+    vector<Tuple> scales, rotations, xlates;
+    scatter( objects, scales, rotations, xlates );
+
+    vector<double> samples;
+    for( int r = 0; r < reps + WARMUP; ++r ) {
+        Clock::time_point start = Clock::now();
+        sphereLod.frame( eye, lookat, up, w_height );
+        for( int i = 0; i < objects; ++i ) {
+            sphereLod.select( scales[i], rotations[i], xlates[i] );
+        }
+        if( r >= WARMUP ) {
+            samples.push_back( elapsed(start) );
+        }
+    }
+
+    report( "lod.select", samples );
+    reportCount( "lod.objects", "objects", sphereLod.stats.objects );
+    reportCount( "lod.fullTriangles", "triangles",
+        sphereLod.stats.fullTriangles );
+    reportCount( "lod.triangles", "triangles", sphereLod.stats.triangles );
+
+    // one sphere at the lookat point, sized to sit right on the limit
+    // between levels 0 and 1, and then grown and shrunk a little
+    GLfloat view[16], center[3] = { lookat.x, lookat.y, lookat.z };
+    viewMatrix( eye, lookat, up, view );
+    float edge = sphereLod.limit[1] /
+        screenRadius( view, center, 0.5f, w_height );
+    Tuple none = { 0.0f, 0.0f, 0.0f };
+
+    const char *names[2] = {
+        "lod.changes.noHysteresis", "lod.changes.hysteresis"
+    };
+    GLfloat factors[2] = { 1.0f, LOD_HYSTERESIS };
+    for( int pass = 0; pass < 2; ++pass ) {
+        sphereLod.hysteresis = factors[pass];
+        seed = 12345;
+        long changes = 0;
+        for( int f = 0; f < frames; ++f ) {
+            float k = edge * (1.0f + 0.02f * sinf(f * 0.05f) +
+                0.02f * (frand() - 0.5f));
+            Tuple s = { k, k, k };
+            sphereLod.frame( eye, lookat, up, w_height );
+            sphereLod.select( s, none, lookat );
+            if( f > 0 ) {
+                changes += sphereLod.stats.switches;
+            }
+        }
+        reportCount( names[pass], "changes", changes );
+    }
+    sphereLod.hysteresis = LOD_HYSTERESIS;
+
+    headlessFinish();
+}
+
+///
+// Does the GL have ARB_pipeline_statistics_query?
+///
+static bool hasPipelineStatistics( void )
+{
+    GLint n = 0;
+    glGetIntegerv( GL_NUM_EXTENSIONS, &n );
+    for( GLint i = 0; i < n; ++i ) {
+        const char *ext = (const char *) glGetStringi( GL_EXTENSIONS, i );
+        if( ext != NULL && !strcmp(ext, "GL_ARB_pipeline_statistics_query") ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+///
+// Build one of the meshes for 'vcache' in 'C', as it is generated
+///
+static void makeVcacheMesh( Canvas &C, int which )
+{
+    C.clear();
+    switch( which ) {
+    case 0:  makeTeapot( C ); C.weld(); break;
+    case 1:  makeSphere( C, 128, 64 );  break;
+    default: makeGrid( C );             break;
+    }
+}
+
+///
+// Vertex cache and overdraw optimization benchmark
+///
+static void benchVcache( void )
+{
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    // each mesh fills the view, tilted so that its front hides its back
+    static const char *vsrc =
+        "#version 130\n"
+        "in vec4 vPosition;\n"
+        "in vec3 vNormal;\n"
+        "uniform vec4 place;\n"
+        "out vec3 normal;\n"
+        "void main() {\n"
+        "    mat3 tilt = mat3( 1.0, 0.0, 0.0,  0.0, 0.8, 0.6,"
+        "  0.0, -0.6, 0.8 );\n"
+        "    vec3 p = tilt * ((vPosition.xyz - place.xyz) * place.w);\n"
+        "    gl_Position = vec4( 0.9 * p.xy, -0.9 * p.z, 1.0 );\n"
+        "    normal = tilt * vNormal;\n"
+        "}\n";
+    static const char *fsrc =
+        "#version 130\n"
+        "in vec3 normal;\n"
+        "out vec4 finalColor;\n"
+        "void main() {\n"
+        "    vec3 n = normalize( normal );\n"
+        "    float d = max( dot(n, normalize(vec3(0.3, 0.5, 1.0))), 0.0 );\n"
+        "    float s = pow( max(n.z, 0.0), 40.0 );\n"
+        "    finalColor = vec4( vec3(0.1 + 0.7 * d + s), 1.0 );\n"
+        "}\n";
+
+    GLuint program = makeProgram( vsrc, fsrc );
+    stUseProgram( program );
+    GLint place = glGetUniformLocation( program, "place" );
+    glEnable( GL_DEPTH_TEST );
+
+    bool stats = hasPipelineStatistics();
+    if( !stats ) {
+        cerr << "no ARB_pipeline_statistics_query; reporting simulated"
+            " transforms instead of shader invocations" << endl;
+    }
+    GLuint queries[2];
+    glGenQueries( 2, queries );
+
+    const char *meshes[3] = { "teapot", "sphere", "grid" };
+    const char *orders[2] = { "plain", "optimized" };
+    for( int m = 0; m < 3; ++m ) {
+        Canvas C( w_width, w_height );
+
+        // the time optimize() takes
+        vector<double> samples;
+        for( int r = 0; r < reps; ++r ) {
+            makeVcacheMesh( C, m );
+            Clock::time_point start = Clock::now();
+            C.optimize();
+            samples.push_back( elapsed(start) );
+        }
+        string label = string( "vcache." ) + meshes[m];
+        report( (label + ".optimize").c_str(), samples );
+
+        // the mesh in both orders
+        CacheStats cache[2];
+        BufferSet B[2];
+        makeVcacheMesh( C, m );
+        reportCount( (label + ".triangles").c_str(), "triangles",
+            C.numIndices() / 3 );
+        B[0].createBuffers( C );
+        C.optimize( &cache[0], &cache[1] );
+        B[1].createBuffers( C );
+
+        for( int o = 0; o < 2; ++o ) {
+            string name = label + "." + orders[o];
+            reportRatio( (name + ".acmr").c_str(), "transforms/triangle",
+                cache[o].acmr );
+            reportRatio( (name + ".atvr").c_str(), "transforms/vertex",
+                cache[o].atvr );
+
+            B[o].selectBuffers( program, "vPosition", NULL, "vNormal",
+                NULL );
+            glUniform4f( place, B[o].center[0], B[o].center[1],
+                B[o].center[2], 1.0f / B[o].radius );
+
+            // one draw counted, then the timed ones
+            GLuint vertices = 0, fragments = 0;
+            glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+            if( stats ) {
+                glBeginQuery( GL_VERTEX_SHADER_INVOCATIONS_ARB, queries[0] );
+                glBeginQuery( GL_FRAGMENT_SHADER_INVOCATIONS_ARB,
+                    queries[1] );
+            }
+            glDrawElements( GL_TRIANGLES, B[o].numElements,
+                GL_UNSIGNED_INT, (void *)0 );
+            if( stats ) {
+                glEndQuery( GL_FRAGMENT_SHADER_INVOCATIONS_ARB );
+                glEndQuery( GL_VERTEX_SHADER_INVOCATIONS_ARB );
+                glGetQueryObjectuiv( queries[0], GL_QUERY_RESULT,
+                    &vertices );
+                glGetQueryObjectuiv( queries[1], GL_QUERY_RESULT,
+                    &fragments );
+                reportCount( (name + ".vertexInvocations").c_str(),
+                    "invocations", vertices );
+                reportCount( (name + ".fragmentInvocations").c_str(),
+                    "invocations", fragments );
+            } else {
+                reportCount( (name + ".transforms").c_str(), "transforms",
+                    cache[o].transforms );
+            }
+
+            vector<double> draws;
+            for( int r = 0; r < reps + WARMUP; ++r ) {
+                glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+                Clock::time_point start = Clock::now();
+                glDrawElements( GL_TRIANGLES, B[o].numElements,
+                    GL_UNSIGNED_INT, (void *)0 );
+                glFinish();
+                if( r >= WARMUP ) {
+                    draws.push_back( elapsed(start) );
+                }
+            }
+            report( (name + ".draw").c_str(), draws );
+        }
+
+        for( int o = 0; o < 2; ++o ) {
+            stDeleteBuffers( 1, &B[o].vbuffer );
+            stDeleteBuffers( 1, &B[o].ebuffer );
+        }
+    }
+
+    glDeleteQueries( 2, queries );
+    headlessFinish();
+}
+
+///
+// Where 'meshcache' writes its files
+///
+static string tempDir( void )
+{
+#if defined(_WIN32) || defined(_WIN64)
+    const char *dir = getenv( "TEMP" );
+    return dir != NULL ? dir : ".";
+#else
+    const char *dir = getenv( "TMPDIR" );
+    return dir != NULL ? dir : "/tmp";
+#endif
+}
+
+///
+// Mesh file benchmark
+///
+static void benchMeshCache( void )
+{
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    init();
+
+    static const char *names[5] = {
+        "quad", "teapot", "sphere", "cone", "cylinder"
+    };
+    string dir = tempDir();
+    BufferSet scratch;
+
+    // the scene's shapes, built and then loaded
+    for( int load = 0; load < 2; ++load ) {
+        meshCache = load ? dir.c_str() : NULL;
+        vector<double> samples;
+        for( int r = 0; r < reps + WARMUP; ++r ) {
+            Clock::time_point start = Clock::now();
+            for( int obj = 0; obj < 5; ++obj ) {
+                createShape( obj, &scratch );
+            }
+            glFinish();
+            if( r >= WARMUP ) {
+                samples.push_back( elapsed(start) );
+            }
+
+            // the built meshes are written (once) for loading
+            if( !load && r == 0 ) {
+                meshCache = dir.c_str();
+                for( int obj = 0; obj < 5; ++obj ) {
+                    remove( (dir + "/" + names[obj] + ".mesh").c_str() );
+                    createShape( obj, &scratch );
+                }
+                meshCache = NULL;
+            }
+        }
+        report( load ? "meshcache.scene.load" : "meshcache.scene.build",
+            samples );
+    }
+    meshCache = NULL;
+
+    long bytes = 0;
+    for( int obj = 0; obj < 5; ++obj ) {
+        string path = dir + "/" + names[obj] + ".mesh";
+        FILE *f = fopen( path.c_str(), "rb" );
+        if( f != NULL ) {
+            if( fseek(f, 0, SEEK_END) == 0 ) {
+                bytes += ftell( f );
+            }
+            fclose( f );
+        }
+        remove( path.c_str() );
+    }
+    reportCount( "meshcache.scene.fileBytes", "bytes", bytes );
+
+    // a large sphere
+    Canvas C( w_width, w_height );
+    string path = dir + "/meshcache_bench.mesh";
+    vector<double> build, write, load;
+    for( int r = 0; r < reps; ++r ) {
+        Clock::time_point start = Clock::now();
+        C.clear();
+        makeSphere( C, 512, 256 );
+        C.optimize();
+        scratch.createBuffers( C );
+        glFinish();
+        build.push_back( elapsed(start) );
+
+        C.clear();
+        makeSphere( C, 512, 256 );
+        C.optimize();
+        start = Clock::now();
+        if( !writeMeshFile(path.c_str(), C) ) {
+            cerr << "can't write " << path << endl;
+            quit( 1 );
+        }
+        write.push_back( elapsed(start) );
+
+        start = Clock::now();
+        MeshFile file;
+        if( !file.open(path.c_str()) ) {
+            cerr << "can't read " << path << endl;
+            quit( 1 );
+        }
+        scratch.createBuffers( file );
+        glFinish();
+        file.close();
+        load.push_back( elapsed(start) );
+    }
+    reportCount( "meshcache.sphere.triangles", "triangles",
+        scratch.numElements / 3 );
+    report( "meshcache.sphere.build", build );
+    report( "meshcache.sphere.write", write );
+    report( "meshcache.sphere.load", load );
+
+    MeshFile file;
+    if( file.open(path.c_str()) ) {
+        reportCount( "meshcache.sphere.fileBytes", "bytes",
+            (long) file.size() );
+    }
+    file.close();
+    remove( path.c_str() );
+
+    stDeleteBuffers( 1, &scratch.vbuffer );
+    stDeleteBuffers( 1, &scratch.ebuffer );
+
+    headlessFinish();
+}
+
+///
+// Write the mesh in 'C' as an OBJ file (with v/vt/vn corners) or a
+// little-endian binary PLY file, for 'import'.  With 'quad', only the
+// first MIXED_FACES faces are written, face 10 as a quad (its triangle
+// with the first corner repeated), so that the faces aren't all
+// triangles, and face 4095 ends in vertex 259.  Read a quad's extra
+// index out of step, as the first of the faces from 4096 on (where a
+// WorkerPool of up to 4 threads starts its second range), that looks
+// like a triangle using a vertex that doesn't exist.
+///
+#define MIXED_FACES 20000
+
+static bool writeImportFile( const string &path, Canvas &C, bool ply,
+    bool quad )
+{
+    FILE *f = fopen( path.c_str(), "wb" );
+    if( f == NULL ) {
+        return false;
+    }
+
+    int nv = C.numVertices(), ni = C.numIndices();
+    if( quad ) {
+        ni = min( ni, 3 * MIXED_FACES );
+    }
+    const float *p = C.viewVertices().data;
+    const float *n = C.viewNormals().data;
+    const float *t = C.viewUV().data;
+    const GLuint *e = C.getElements();
+
+    if( ply ) {
+        fprintf( f, "ply\nformat binary_little_endian 1.0\n"
+            "element vertex %d\nproperty float x\nproperty float y\n"
+            "property float z\nproperty float nx\nproperty float ny\n"
+            "property float nz\nproperty float u\nproperty float v\n"
+            "element face %d\nproperty list uchar int vertex_indices\n"
+            "end_header\n", nv, ni / 3 );
+        for( int i = 0; i < nv; ++i ) {
+            fwrite( p + 4 * i, sizeof(float), 3, f );
+            fwrite( n + 3 * i, sizeof(float), 3, f );
+            fwrite( t + 2 * i, sizeof(float), 2, f );
+        }
+        for( int i = 0; i < ni; i += 3 ) {
+            unsigned char corners = quad && i == 30 ? 4 : 3;
+            int32_t v[4] = { (int32_t) e[i], (int32_t) e[i + 1],
+                (int32_t) e[i + 2], (int32_t) e[i] };
+            if( quad && i == 3 * 4095 ) {
+                v[2] = 259;
+            }
+            fwrite( &corners, 1, 1, f );
+            fwrite( v, sizeof(int32_t), corners, f );
+        }
+    } else {
+        fprintf( f, "# %d triangles\n", ni / 3 );
+        for( int i = 0; i < nv; ++i ) {
+            fprintf( f, "v %.6f %.6f %.6f\n", p[4 * i], p[4 * i + 1],
+                p[4 * i + 2] );
+        }
+        for( int i = 0; i < nv; ++i ) {
+            fprintf( f, "vt %.6f %.6f\n", t[2 * i], t[2 * i + 1] );
+        }
+        for( int i = 0; i < nv; ++i ) {
+            fprintf( f, "vn %.6f %.6f %.6f\n", n[3 * i], n[3 * i + 1],
+                n[3 * i + 2] );
+        }
+        for( int i = 0; i < ni; i += 3 ) {
+            fprintf( f, "f %u/%u/%u %u/%u/%u %u/%u/%u\n",
+                e[i] + 1, e[i] + 1, e[i] + 1,
+                e[i + 1] + 1, e[i + 1] + 1, e[i + 1] + 1,
+                e[i + 2] + 1, e[i + 2] + 1, e[i + 2] + 1 );
+        }
+    }
+
+    return fclose( f ) == 0;
+}
+
+///
+// Mesh import benchmark
+///
+static void benchImport( void )
+{
+    Canvas C( w_width, w_height );
+    makeGrid( C );
+
+    // the mixed PLY file has a quad among its triangles
+    const char *formats[3] = { "obj", "ply", "mixed" };
+    string paths[3];
+    for( int k = 0; k < 3; ++k ) {
+        paths[k] = tempDir() + "/import_bench" + (k == 2 ? "_mixed" : "") +
+            "." + (k == 0 ? "obj" : "ply");
+        if( !writeImportFile(paths[k], C, k > 0, k == 2) ) {
+            cerr << "can't write " << paths[k] << endl;
+            exit( 1 );
+        }
+    }
+    reportCount( "import.triangles", "triangles", C.numIndices() / 3 );
+
+    int most = max( 4, (int) thread::hardware_concurrency() );
+    WorkerPool pool( 1 );
+
+    for( int k = 0; k < 3; ++k ) {
+        long expected = k == 2 ? min( C.numIndices() / 3, MIXED_FACES ) + 1 :
+            C.numIndices() / 3;
+        for( int threads = 1; threads <= most; threads *= 2 ) {
+            pool.resize( threads );
+
+            vector<double> samples;
+            ImportStats stats;
+            for( int r = 0; r < reps; ++r ) {
+                Canvas M( w_width, w_height );
+                if( !importMesh(paths[k].c_str(), M, pool, &stats) ) {
+                    exit( 1 );
+                }
+                if( stats.triangles != expected ) {
+                    cerr << paths[k] << ": imported " << stats.triangles <<
+                        " triangles with " << threads << " threads, not " <<
+                        expected << endl;
+                    exit( 1 );
+                }
+                samples.push_back( stats.millis );
+            }
+
+            // rates at the median time
+            vector<double> sorted( samples );
+            sort( sorted.begin(), sorted.end() );
+            double ms = sorted[sorted.size() / 2];
+
+            string name = string( "import." ) + formats[k] + ".t" +
+                to_string( threads );
+            report( name.c_str(), samples );
+            reportRatio( (name + ".rate").c_str(), "MB/s",
+                stats.bytes / 1.0e3 / ms );
+            reportRatio( (name + ".triangleRate").c_str(), "triangles/s",
+                stats.triangles * 1.0e3 / ms );
+            if( threads == 1 ) {
+                reportCount( (string("import.") + formats[k] +
+                    ".fileBytes").c_str(), "bytes", (long) stats.bytes );
+            }
+        }
+        remove( paths[k].c_str() );
+    }
+}
+
+///
+// Time preparing and flushing 'n' objects with each number of threads
+///
+static void benchPrepN( int n )
+{
+    vector<Tuple> scales, rotations, xlates;
+    scatter( n, scales, rotations, xlates );
+
+    int most = max( 4, (int) thread::hardware_concurrency() );
+
+    for( int threads = 1; threads <= most; threads *= 2 ) {
+        workers.resize( threads );
+
+        vector<double> prep, flush;
+        for( int r = 0; r < reps + WARMUP; ++r ) {
+
+            for( int i = 0; i < n; ++i ) {
+                queue.submit( pshader, &coneLod.levels[0], MATL_FLOWER,
+                    scales[i], rotations[i], xlates[i] );
+            }
+            Clock::time_point start = Clock::now();
+            queue.prepare( eye, lookat, up );
+            if( r >= WARMUP ) {
+                prep.push_back( elapsed(start) );
+            }
+            queue.packets.clear();
+
+            for( int i = 0; i < n; ++i ) {
+                queue.submit( pshader, &coneLod.levels[0], MATL_FLOWER,
+                    scales[i], rotations[i], xlates[i] );
+            }
+            start = Clock::now();
+            glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+            queue.flush( eye, lookat, up );
+            glFinish();
+            if( r >= WARMUP ) {
+                flush.push_back( elapsed(start) );
+            }
+        }
+
+        string name = "prep." + to_string( n ) + ".t" +
+            to_string( threads );
+        report( (name + ".prepare").c_str(), prep );
+        report( (name + ".flush").c_str(), flush );
+    }
+
+    reportCount( ("prep." + to_string(n) + ".draws").c_str(), "calls",
+        queue.stats.draws );
+}
+
+///
+// Packet preparation benchmark
+///
+static void benchPrep( void )
+{
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    init();
+
+    reportCount( "prep.hardwareThreads", "threads",
+        (long) thread::hardware_concurrency() );
+
+    if( objects > 0 ) {
+        benchPrepN( objects );
+    } else {
+        benchPrepN( 10000 );
+        benchPrepN( 100000 );
+    }
+
+    workers.resize( 0 );
+
+    headlessFinish();
+}
+
+///
+// Frame-time benchmark
+///
+static void benchFrame( void )
+{
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    // init() can only sensibly be run once per process
+    vector<double> samples;
+    Clock::time_point start = Clock::now();
+    init();
+    glFinish();
+    samples.push_back( elapsed(start) );
+    report( "init", samples );
+
+    benchShape( "createShape.quad", OBJ_QUAD );
+    benchShape( "createShape.teapot", OBJ_TEAPOT );
+    benchShape( "createShape.sphere", OBJ_SPHERE );
+    benchShape( "createShape.cone", OBJ_CONE );
+    benchShape( "createShape.cylinder", OBJ_CYLINDER );
+
+    // the first frame sets up the vertex array objects
+    BufferSet::selectCalls = 0;
+    display();
+    reportCount( "selectBuffers.firstFrame", "calls", BufferSet::selectCalls );
+
+    BufferSet::selectCalls = 0;
+    display();
+    reportCount( "selectBuffers.perFrame", "calls", BufferSet::selectCalls );
+
+    for( int i = 0; i < WARMUP; ++i ) {
+        display();
+    }
+    glFinish();
+
+    // time the scene with and without instanced draws
+    const char *names[2] = { "display", "display.noinst" };
+    for( int pass = 0; pass < 2; ++pass ) {
+        instancing = (pass == 0);
+        for( int i = 0; i < WARMUP; ++i ) {
+            display();
+        }
+        glFinish();
+
+        samples.clear();
+        for( int i = 0; i < frames; ++i ) {
+            start = Clock::now();
+            display();
+            glFinish();
+            samples.push_back( elapsed(start) );
+        }
+        report( names[pass], samples );
+
+        // the queue's counts for the last frame drawn
+        string name = names[pass];
+        reportCount( (name + ".draws").c_str(), "calls",
+            queue.stats.draws );
+        reportCount( (name + ".commands").c_str(), "calls",
+            queue.stats.commands );
+        reportCount( (name + ".programSwitches").c_str(), "calls",
+            queue.stats.programSwitches );
+        reportCount( (name + ".bufferBinds").c_str(), "calls",
+            queue.stats.bufferBinds );
+        reportCount( (name + ".materialChanges").c_str(), "calls",
+            queue.stats.materialChanges );
+        reportCount( (name + ".culled").c_str(), "objects",
+            queue.stats.culled );
+        reportCount( (name + ".triangles").c_str(), "triangles",
+            lodStats.triangles );
+        reportCount( (name + ".fullTriangles").c_str(), "triangles",
+            lodStats.fullTriangles );
+
+        // and the state cache's, for one more frame
+        stResetStats();
+        display();
+        reportCount( (name + ".stateIssued").c_str(), "calls",
+            stateStats.issued );
+        reportCount( (name + ".stateElided").c_str(), "calls",
+            stateStats.elided );
+        reportCount( (name + ".stateIgnored").c_str(), "calls",
+            stateStats.ignored );
+    }
+    instancing = true;
+
+    headlessFinish();
+}
+
+///
+// Main program for the benchmarks
+///
+int main( int argc, char **argv ) {
+
+    const char *mode = "frame";
+    int first = 1;
+
+    if( argc > 1 && argv[1][0] != '-' ) {
+        mode = argv[1];
+        first = 2;
+    }
+
+    for( int i = first; i < argc; ++i ) {
+        if( !strcmp(argv[i], "-n") && i + 1 < argc ) {
+            frames = atoi( argv[++i] );
+        } else if( !strcmp(argv[i], "-r") && i + 1 < argc ) {
+            reps = atoi( argv[++i] );
+        } else if( !strcmp(argv[i], "-t") && i + 1 < argc ) {
+            triangles = atoi( argv[++i] );
+        } else if( !strcmp(argv[i], "-c") && i + 1 < argc ) {
+            copies = atoi( argv[++i] );
+        } else if( !strcmp(argv[i], "-o") && i + 1 < argc ) {
+            objects = atoi( argv[++i] );
+        } else if( !strcmp(argv[i], "-w") && i + 1 < argc ) {
+            w_width = atoi( argv[++i] );
+        } else if( !strcmp(argv[i], "-h") && i + 1 < argc ) {
+            w_height = atoi( argv[++i] );
+        } else {
+            cerr << "usage: " << argv[0] << " [mode] [-n frames] [-r reps]"
+                " [-t triangles] [-c copies] [-o objects] [-w width]"
+                " [-h height]" << endl;
+            cerr << "modes: frame mesh shapes layout transform instance ring"
+                " arena indirect batch cull lod vcache prep meshcache import" << endl;
+            exit( 1 );
+        }
+    }
+
+    if( frames < 1 || reps < 0 || triangles < 1 || objects < 0 ||
+        w_width < 1 || w_height < 1 ) {
+        cerr << "counts and sizes must be positive" << endl;
+        exit( 1 );
+    }
+
+    if( !strcmp(mode, "frame") ) {
+        if( reps == 0 ) {
+            reps = 100;
+        }
+        benchFrame();
+    } else if( !strcmp(mode, "mesh") ) {
+        if( reps == 0 ) {
+            reps = 10;
+        }
+        benchMesh();
+    } else if( !strcmp(mode, "shapes") ) {
+        if( reps == 0 ) {
+            reps = 20;
+        }
+        benchShapes();
+    } else if( !strcmp(mode, "layout") ) {
+        if( reps == 0 ) {
+            reps = 50;
+        }
+        benchLayout();
+    } else if( !strcmp(mode, "transform") ) {
+        if( reps == 0 ) {
+            reps = 50;
+        }
+        benchTransform();
+    } else if( !strcmp(mode, "instance") ) {
+        if( reps == 0 ) {
+            reps = 20;
+        }
+        benchInstance();
+    } else if( !strcmp(mode, "ring") ) {
+        if( reps == 0 ) {
+            reps = 20;
+        }
+        benchRing();
+    } else if( !strcmp(mode, "batch") ) {
+        if( reps == 0 ) {
+            reps = 20;
+        }
+        benchBatch();
+    } else if( !strcmp(mode, "indirect") ) {
+        if( reps == 0 ) {
+            reps = 20;
+        }
+        benchIndirect();
+    } else if( !strcmp(mode, "arena") ) {
+        if( reps == 0 ) {
+            reps = 20;
+        }
+        benchArena();
+    } else if( !strcmp(mode, "cull") ) {
+        if( reps == 0 ) {
+            reps = 50;
+        }
+        if( objects == 0 ) {
+            objects = 100000;
+        }
+        benchCull();
+    } else if( !strcmp(mode, "lod") ) {
+        if( reps == 0 ) {
+            reps = 50;
+        }
+        if( objects == 0 ) {
+            objects = 100000;
+        }
+        benchLod();
+    } else if( !strcmp(mode, "vcache") ) {
+        if( reps == 0 ) {
+            reps = 20;
+        }
+        benchVcache();
+    } else if( !strcmp(mode, "prep") ) {
+        if( reps == 0 ) {
+            reps = 10;
+        }
+        benchPrep();
+    } else if( !strcmp(mode, "meshcache") ) {
+        if( reps == 0 ) {
+            reps = 10;
+        }
+        benchMeshCache();
+    } else if( !strcmp(mode, "import") ) {
+        if( reps == 0 ) {
+            reps = 5;
+        }
+        benchImport();
+    } else {
+        cerr << "unknown benchmark mode '" << mode << "'" << endl;
+        exit( 1 );
+    }
+
+    return 0;
+}
@@ -12,17 +12,27 @@
 ///
 
 #include <cstdlib>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <iomanip>
 #include <iostream>
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #endif
 
+#if defined(HEADLESS)
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
 #ifndef __APPLE__
 #include <GL/glew.h>
 #endif
 
 #include <GLFW/glfw3.h>
+#endif
 
 #include "Buffers.h"
 #include "ShaderSetup.h"
@@ -30,8 +40,18 @@
 #include "Shapes.h"
 #include "Shape_Nonorm.h"
 #include "Viewing.h"
+#include "Uniforms.h"
 #include "Lighting.h"
 #include "Textures.h"
+#include "Headless.h"
+#include "RenderQueue.h"
+#include "GeometryArena.h"
+#include "CommandBuffer.h"
+#include "StaticBatch.h"
+#include "LevelOfDetail.h"
+#include "GLState.h"
+#include "MeshCache.h"
+#include "MeshImport.h"
 
 using namespace std;
 
@@ -117,9 +137,92 @@ Tuple leaf_rotation = { -10,0,10 };
 //
 BufferSet quadBuffers;
 BufferSet teapotBuffers;
-BufferSet sphereBuffers;
-BufferSet coneBuffers;
-BufferSet cylinderBuffers;
+
+// the sphere, cone and cylinder come in several tessellations, and
+// each object is drawn with the coarsest one that looks the same at
+// its size on the screen; all three shapes' circles have radius 0.5,
+// and only the sphere is curved along Y
+LodChain sphereLod( 0.5f, LOD_X | LOD_Y | LOD_Z );
+LodChain coneLod( 0.5f, LOD_X | LOD_Z );
+LodChain cylinderLod( 0.5f, LOD_X | LOD_Z );
+bool useLod = true;
+
+// slices for each level, finest first; the sphere has half as many
+// stacks, while one stack is exact for the straight-sided shapes
+static const int lodSlices[LOD_LEVELS] = { 48, 24, 12, 6 };
+
+// the chains' counts for the most recent frame, added together
+LodStats lodStats;
+
+// all of the above share one vertex buffer and one element buffer,
+// unless we're asked not to
+GeometryArena geometry;
+bool useArena = true;
+
+// give each mesh buffers of its own with quantized vertex data instead
+// (LAYOUT_QUANTIZED; the arena has a format of its own)
+bool quantize = false;
+
+// instances of the Phong-shaded meshes, collected during display()
+// (the other meshes' instances are kept by their chains)
+InstanceSet teapotInstances( &teapotBuffers );
+
+// draw each Phong-shaded mesh with one instanced draw per frame?
+bool instancing = true;
+
+// everything drawn in a frame goes through here
+RenderQueue queue;
+
+// threads for preparing the queue's packets (one per hardware thread)
+WorkerPool workers;
+
+// per-frame records and instances go here, if the GL context allows
+// (and we want it); the size is per frame, and grows when needed
+#define RING_SECTION_SIZE   (256 * 1024)
+RingBuffer ring;
+bool useRing = true;
+
+// draws of records and instances of the arena's meshes become indirect
+// commands, if the GL context allows (and we want it)
+CommandBuffer commands;
+bool useIndirect = true;
+
+// bake the Phong-shaded objects into world-space batches instead?
+// (the meshes' vertex data is then kept on the CPU)
+StaticBatcher batcher;
+bool batching = false;
+
+// reorder each mesh's triangles and vertices for the vertex cache,
+// overdraw and vertex fetch when it is created?
+bool optimizeMeshes = true;
+
+// if set, the directory of mesh files (see MeshCache.h):  meshes found
+// there are loaded instead of built, and the others are written there
+// once they have been built
+const char *meshCache = NULL;
+
+// if set, an OBJ or PLY file whose mesh replaces the teapot's (scaled
+// to the teapot's size)
+const char *modelFile = NULL;
+
+// meshes loaded from the mesh cache, and the time init() took to
+// create all of them, in milliseconds
+int meshesLoaded = 0;
+double meshMillis = 0.0;
+
+// vertices removed by weld() when each shape was made, or -1 if it
+// wasn't welded (it came from the mesh cache, or from a model file)
+int welded[5] = { -1, -1, -1, -1, -1 };
+
+// names of the shapes, for their mesh files
+static const char *shapeNames[] = {
+    "quad", "teapot", "sphere", "cone", "cylinder"
+};
+
+// part of every mesh file's source key; bump it whenever a generator,
+// the importer, weld() or optimize() changes the meshes they make, so
+// that files made before are rebuilt
+#define MESH_RECIPE_VERSION 1
 
 // Animation flag
 bool animating = false;
@@ -134,19 +237,222 @@ GLfloat angles = 0.0f;
 int sphereState = 0;
 
 // program IDs for shader programs
-GLuint pshader, tshader;
+GLuint pshader, tshader, ishader, bshader;
+
+// the uniforms each program uses (the light and materials of the
+// Phong programs are in uniform blocks; the instanced and batched
+// ones read the model matrices from their vertex attributes)
+static const UniformId textureUniforms[] = {
+    U_MODELVIEWMAT, U_PROJMAT, U_NORMALMAT, U_LIGHT_POSITION_EYE,
+    U_LIGHT_AMBIENT, U_KA, U_KD, U_KS, U_SPECULAR_EXPONENT, U_HAPPY_IMG
+};
+static const UniformId phongUniforms[] = {
+    U_MODELVIEWMAT, U_PROJMAT, U_NORMALMAT, U_MATERIAL
+};
+static const UniformId recordUniforms[] = {
+    U_VIEWMAT, U_PROJMAT
+};
+
+///
+// Shut down the window system (or the offscreen context) and exit
+//
+// @param status - exit status for the program
+///
+void quit( int status )
+{
+#if defined(HEADLESS)
+    headlessFinish();
+#else
+    glfwTerminate();
+#endif
+    exit( status );
+}
+
+///
+// optimizeShape() - reorder the mesh in the Canvas for the vertex
+//     cache, overdraw and fetching, unless we're asked not to
+//
+// @param cache - receives how well the triangle order used the vertex
+//                cache before and after (two entries), or NULL
+///
+static void optimizeShape( CacheStats *cache )
+{
+    if( optimizeMeshes ) {
+        canvas->optimize( cache, cache != NULL ? cache + 1 : NULL );
+    } else if( cache != NULL ) {
+        cache[0] = cache[1] = measureCache( canvas->getElements(),
+            canvas->numIndices(), canvas->numVertices() );
+    }
+}
+
+///
+// meshPath() - the name of a mesh's file in the mesh cache
+//
+// @param name - name of the mesh
+///
+static string meshPath( const char *name )
+{
+    return string( meshCache ) + "/" + name +
+        (optimizeMeshes ? "" : ".noopt") + ".mesh";
+}
+
+///
+// shapeName() - the name of a shape, for its mesh file
+//
+// @param obj - which shape
+///
+static string shapeName( int obj )
+{
+    if( obj != OBJ_TEAPOT || modelFile == NULL ) {
+        return shapeNames[obj];
+    }
+
+    // an imported model is known by its file's name
+    string name( modelFile );
+    size_t slash = name.find_last_of( "/\\" );
+    return "model." + (slash == string::npos ? name : name.substr(slash + 1));
+}
+
+///
+// shapeSource() - the source key for a shape's mesh file
+//
+// @param obj - which shape
+// @param slices, stacks - the generator's parameters (if it has any)
+///
+static uint64_t shapeSource( int obj, int slices, int stacks )
+{
+    char recipe[128];
+    snprintf( recipe, sizeof(recipe), "%s %d %d %d %s", shapeNames[obj],
+        slices, stacks, MESH_RECIPE_VERSION,
+        optimizeMeshes ? "optimized" : "unoptimized" );
+
+    // an imported model is only as current as its file
+    if( obj == OBJ_TEAPOT && modelFile != NULL ) {
+        return meshSource( recipe, modelFile );
+    }
+    return meshSource( recipe );
+}
+
+///
+// importModel() - add the model that replaces the teapot to the
+//     Canvas, the same size as the teapot
+//
+// @return true if it was imported
+///
+static bool importModel( void )
+{
+    Canvas teapot( w_width, w_height );
+    makeTeapot( teapot );
+    BufferSet bounds;
+    bounds.computeBounds( teapot.viewVertices() );
+    float half = 0.0f;
+    for( int i = 0; i < 3; ++i ) {
+        float d = 0.5f * (bounds.boxMax[i] - bounds.boxMin[i]);
+        half += d * d;
+    }
+
+    ImportStats stats;
+    if( !importMesh(modelFile, *canvas, workers, &stats, sqrtf(half)) ) {
+        return false;
+    }
+
+    cerr << modelFile << ": " << stats.triangles << " triangles, " <<
+        stats.vertices << " vertices, imported in " << stats.millis <<
+        " ms (" << stats.bytes / 1.0e3 / stats.millis << " MB/s)" << endl;
+    return true;
+}
+
+///
+// loadShape() - create vertex and element buffers for a mesh from its
+//     file in the mesh cache, if there is a usable one
+//
+// @param name - name of the mesh
+// @param source - shapeSource() of the mesh; a file made from anything
+//                 else is stale, and isn't used
+// @param B - which BufferSet to use
+// @param cache - marked as unknown (two entries), or NULL
+//
+// @return true if it was loaded
+///
+static bool loadShape( const char *name, uint64_t source, BufferSet *B,
+    CacheStats *cache )
+{
+    MeshFile file;
+
+    if( meshCache == NULL || !file.open(meshPath(name).c_str(), source) ) {
+        return false;
+    }
+
+    B->createBuffers( file, batching );
+    if( cache != NULL ) {
+        cache[0].transforms = cache[1].transforms = -1;
+    }
+    ++meshesLoaded;
+
+    return true;
+}
+
+///
+// saveShape() - write the mesh in the Canvas to the mesh cache (if
+//     there is one)
+//
+// @param name - name of the mesh
+// @param source - shapeSource() of the mesh
+///
+static void saveShape( const char *name, uint64_t source )
+{
+    if( meshCache == NULL ) {
+        return;
+    }
+
+    string path = meshPath( name );
+    if( !writeMeshFile(path.c_str(), *canvas, source) ) {
+        cerr << "can't write mesh file " << path << endl;
+    }
+}
 
 ///
 // createShape() - create vertex and element buffers for a shape
 //
 // @param obj - which shape to create
 // @param B - which BufferSet to use
+// @param cache - receives how well the triangle order used the vertex
+//                cache before and after optimizing (two entries), or NULL
 ///
-void createShape( int obj, BufferSet *B )
+void createShape( int obj, BufferSet *B, CacheStats *cache )
 {
+    string name = shapeName( obj );
+    welded[obj] = -1;
+    uint64_t source = 0;
+    switch( obj ) {
+    case OBJ_SPHERE:
+        source = shapeSource( obj, SPHERE_SLICES, SPHERE_STACKS );
+        break;
+    case OBJ_CONE:
+        source = shapeSource( obj, CONE_SLICES, CONE_STACKS );
+        break;
+    case OBJ_CYLINDER:
+        source = shapeSource( obj, CYLINDER_SLICES, CYLINDER_STACKS );
+        break;
+    default:
+        source = shapeSource( obj, 0, 0 );
+        break;
+    }
+    if( loadShape(name.c_str(), source, B, cache) ) {
+        return;
+    }
+
     // clear any previous shape
     canvas->clear();
 
+    // an imported model is indexed already
+    if( obj == OBJ_TEAPOT && modelFile != NULL && importModel() ) {
+        optimizeShape( cache );
+        saveShape( name.c_str(), source );
+        B->createBuffers( *canvas, batching );
+        return;
+    }
+
     // make the shape
     switch( obj ) {
     case OBJ_QUAD:    makeQuad( *canvas );   break;
@@ -156,8 +462,126 @@ void createShape( int obj, BufferSet *B )
 	case OBJ_CYLINDER: makeCylinder(*canvas); break;
     }
 
+    // share identical vertices, so the element buffer does real work
+    welded[obj] = canvas->weld();
+
+    // reorder it for the vertex cache, overdraw and fetching
+    optimizeShape( cache );
+    saveShape( name.c_str(), source );
+
     // create the necessary buffers
-    B->createBuffers( *canvas );
+    B->createBuffers( *canvas, batching );
+}
+
+///
+// createLevels() - create vertex and element buffers for each level
+//     of a generated shape
+//
+// @param obj - which shape to create (sphere, cone or cylinder)
+// @param lod - the chain to put them in
+// @param cache - receives the vertex cache statistics of the finest
+//                level, as for createShape(), or NULL
+///
+void createLevels( int obj, LodChain &lod, CacheStats *cache )
+{
+    for( int i = 0; i < LOD_LEVELS; ++i ) {
+        int n = lodSlices[i];
+        char name[64];
+        snprintf( name, sizeof(name), "%s.%d", shapeNames[obj], i );
+        lod.setLevel( i, n );
+
+        int stacks = obj == OBJ_SPHERE ? n / 2 : 1;
+        uint64_t source = shapeSource( obj, n, stacks );
+        if( loadShape(name, source, &lod.levels[i], i == 0 ? cache : NULL) ) {
+            continue;
+        }
+
+        canvas->clear();
+        switch( obj ) {
+        case OBJ_SPHERE:   makeSphere( *canvas, n, stacks );   break;
+        case OBJ_CONE:     makeCone( *canvas, n, stacks );     break;
+        case OBJ_CYLINDER: makeCylinder( *canvas, n, stacks ); break;
+        }
+
+        // the generators share vertices already, so there is no need
+        // to weld
+        optimizeShape( i == 0 ? cache : NULL );
+        saveShape( name, source );
+        lod.levels[i].createBuffers( *canvas, batching );
+    }
+}
+
+///
+// reportShape() - print vertex sharing statistics for a shape
+//
+// @param name - name of the shape
+// @param B - the BufferSet holding it
+// @param removed - vertices removed by weld(), or -1 if it didn't run
+///
+void reportShape( const char *name, BufferSet &B, int removed )
+{
+    cerr << name << ": " << B.numElements / 3 << " triangles, " <<
+        B.numVertices << " vertices";
+    if( removed >= 0 ) {
+        cerr << " (" << removed << " saved by welding)";
+    }
+    cerr << endl;
+}
+
+///
+// reportCache() - print how well a shape's triangle order uses the
+//     vertex cache, before and after optimizing it
+//
+// @param name - name of the shape
+// @param cache - the statistics before and after (two entries)
+///
+void reportCache( const char *name, const CacheStats *cache )
+{
+    if( cache[0].transforms < 0 ) {
+        cerr << name << " vertex cache: as loaded from the mesh cache" <<
+            endl;
+        return;
+    }
+
+    cerr << fixed << setprecision(3) << name << " vertex cache: ACMR " <<
+        cache[0].acmr << " -> " << cache[1].acmr << ", ATVR " <<
+        cache[0].atvr << " -> " << cache[1].atvr << " (" <<
+        cache[0].transforms << " -> " << cache[1].transforms <<
+        " transforms)" << defaultfloat << endl;
+}
+
+///
+// reportQuantized() - print the size of a shape's quantized vertex
+//     data, and how far it is from the original
+//
+// @param name - name of the shape
+// @param B - the BufferSet holding it
+///
+void reportQuantized( const char *name, BufferSet &B )
+{
+    cerr << name << " quantized: " << B.stride << " bytes/vertex, error " <<
+        B.quantError.position << " (" <<
+        100.0f * B.quantError.position / B.radius << "% of radius), normal " <<
+        B.quantError.normal << " degrees, uv " << B.quantError.uv << endl;
+}
+
+///
+// reportLevels() - print the sizes of each level of a shape
+//
+// @param name - name of the shape
+// @param lod - its chain
+///
+void reportLevels( const char *name, LodChain &lod )
+{
+    cerr << name << ":";
+    for( int i = 0; i < LOD_LEVELS; ++i ) {
+        cerr << (i > 0 ? "," : "") << " " << lod.slices[i] << " slices " <<
+            lod.levels[i].numElements / 3 << " triangles";
+        if( i > 0 ) {
+            cerr << " (up to " << lod.limit[i] << " px)";
+        }
+    }
+    cerr << endl;
 }
 
 ///
@@ -170,31 +594,70 @@ void init( void )
 
     if( canvas == NULL ) {
         cerr << "error - cannot create Canvas" << endl;
-        glfwTerminate();
-        exit( 1 );
+        quit( 1 );
     }
 
     // Load texture image(s)
     loadTextures();
 
+    queue.pool = &workers;
+    if( useRing && ring.init(RING_SECTION_SIZE) ) {
+        queue.ring = &ring;
+    }
+    if( useIndirect && CommandBuffer::supported() ) {
+        queue.commands = &commands;
+    }
+
     // Load shaders, verifying each
     ShaderError error;
-    tshader = shaderSetup( "texture.vert", "texture.frag", &error );
+    tshader = shaderSetup( "texture_mat.vert", "texture.frag", &error );
     if( !tshader ) {
         cerr << "Error setting up texture shader - " <<
             errorString(error) << endl;
-        glfwTerminate();
-        exit( 1 );
+        quit( 1 );
     }
 
-    pshader = shaderSetup( "phong.vert", "phong.frag", &error );
+    pshader = shaderSetup( "phong_mat.vert", "phong_mat.frag", &error );
     if( !pshader ) {
         cerr << "Error setting up Phong shader - " <<
             errorString(error) << endl;
-        glfwTerminate();
-        exit( 1 );
+        quit( 1 );
+    }
+
+    ishader = shaderSetup( "phong_inst.vert", "phong_inst.frag", &error );
+    if( !ishader ) {
+        cerr << "Error setting up instanced Phong shader - " <<
+            errorString(error) << endl;
+        quit( 1 );
     }
 
+    bshader = shaderSetup( "phong_batch.vert", "phong_inst.frag", &error );
+    if( !bshader ) {
+        cerr << "Error setting up batched Phong shader - " <<
+            errorString(error) << endl;
+        quit( 1 );
+    }
+
+    // the material table and the light live in uniform buffers
+    initMaterials();
+    bindMaterialBlocks( pshader );
+    bindMaterialBlocks( ishader );
+    bindMaterialBlocks( bshader );
+
+    // look up the uniform locations once, and report any missing ones
+    resolveUniforms( tshader, textureUniforms,
+        sizeof(textureUniforms) / sizeof(textureUniforms[0]) );
+    resolveUniforms( pshader, phongUniforms,
+        sizeof(phongUniforms) / sizeof(phongUniforms[0]) );
+    resolveUniforms( ishader, recordUniforms,
+        sizeof(recordUniforms) / sizeof(recordUniforms[0]) );
+    resolveUniforms( bshader, recordUniforms,
+        sizeof(recordUniforms) / sizeof(recordUniforms[0]) );
+    dumpUniforms( tshader, "texture shader" );
+    dumpUniforms( pshader, "Phong shader" );
+    dumpUniforms( ishader, "instanced Phong shader" );
+    dumpUniforms( bshader, "batched Phong shader" );
+
     // Other OpenGL initialization
     glEnable( GL_DEPTH_TEST );
     glClearColor( 0.0f, 0.0f, 0.0f, 0.0f );
@@ -203,11 +666,94 @@ void init( void )
     glClearDepth( 1.0f );
 
     // Create all our objects
-    createShape( OBJ_QUAD, &quadBuffers );
-    createShape( OBJ_TEAPOT, &teapotBuffers );
-    createShape( OBJ_SPHERE, &sphereBuffers );
-	createShape( OBJ_CONE, &coneBuffers);
-	createShape(OBJ_CYLINDER, &cylinderBuffers);
+    if( quantize ) {
+        quadBuffers.layout = LAYOUT_QUANTIZED;
+        teapotBuffers.layout = LAYOUT_QUANTIZED;
+        for( int i = 0; i < LOD_LEVELS; ++i ) {
+            sphereLod.levels[i].layout = LAYOUT_QUANTIZED;
+            coneLod.levels[i].layout = LAYOUT_QUANTIZED;
+            cylinderLod.levels[i].layout = LAYOUT_QUANTIZED;
+        }
+    } else if( useArena ) {
+        quadBuffers.arena = &geometry;
+        teapotBuffers.arena = &geometry;
+        for( int i = 0; i < LOD_LEVELS; ++i ) {
+            sphereLod.levels[i].arena = &geometry;
+            coneLod.levels[i].arena = &geometry;
+            cylinderLod.levels[i].arena = &geometry;
+        }
+    }
+    sphereLod.enabled = coneLod.enabled = cylinderLod.enabled = useLod;
+
+    CacheStats cache[5][2];
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    createShape( OBJ_QUAD, &quadBuffers, cache[0] );
+    createShape( OBJ_TEAPOT, &teapotBuffers, cache[1] );
+    createLevels( OBJ_SPHERE, sphereLod, cache[2] );
+    createLevels( OBJ_CONE, coneLod, cache[3] );
+    createLevels( OBJ_CYLINDER, cylinderLod, cache[4] );
+    glFinish();
+    meshMillis = chrono::duration<double, milli>(
+        chrono::steady_clock::now() - start ).count();
+
+    reportShape( "quad", quadBuffers, welded[OBJ_QUAD] );
+    reportShape( "teapot", teapotBuffers, welded[OBJ_TEAPOT] );
+    reportLevels( "sphere", sphereLod );
+    reportLevels( "cone", coneLod );
+    reportLevels( "cylinder", cylinderLod );
+
+    for( int i = 0; i < 5; ++i ) {
+        reportCache( shapeNames[i], cache[i] );
+    }
+
+    if( quantize ) {
+        reportQuantized( "quad", quadBuffers );
+        reportQuantized( "teapot", teapotBuffers );
+        reportQuantized( "sphere", sphereLod.levels[0] );
+        reportQuantized( "cone", coneLod.levels[0] );
+        reportQuantized( "cylinder", cylinderLod.levels[0] );
+    }
+}
+
+///
+// drawObject() - queue one Phong-shaded object (to be drawn from a
+//     per-draw record when there is a ring buffer or a command list
+//     to put it in), or just record it as an instance of its mesh
+//     when instancing, or give it to the batcher when batching
+//
+// @param inst - the instances of the object's mesh
+// @param obj  - material id of the object
+// @param scale, rotate, xlate - the object's transformations
+///
+static void drawObject( InstanceSet &inst, int obj, Tuple scale,
+    Tuple rotate, Tuple xlate )
+{
+    if( batching ) {
+        batcher.add( inst.buffers, obj, scale, rotate, xlate );
+    } else if( instancing ) {
+        inst.add( obj, scale, rotate, xlate );
+    } else if( queue.ring != NULL || queue.commands != NULL ) {
+        queue.submitRecord( ishader, inst.buffers, obj, scale, rotate,
+            xlate );
+    } else {
+        queue.submit( pshader, inst.buffers, obj, scale, rotate, xlate );
+    }
+}
+
+///
+// drawObject() - queue one object of a generated shape, at the level
+//     of detail its size on the screen calls for
+//
+// @param lod - the shape's chain of levels
+// @param obj - material id of the object
+// @param scale, rotate, xlate - the object's transformations
+///
+static void drawObject( LodChain &lod, int obj, Tuple scale,
+    Tuple rotate, Tuple xlate )
+{
+    int level = lod.select( scale, rotate, xlate );
+
+    drawObject( lod.instances[level], obj, scale, rotate, xlate );
 }
 
 ///
@@ -218,60 +764,100 @@ void display( void )
     // clear and draw params..
     glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
 
+    // objects drawn more than once are moved between draws; work on
+    // copies so that every frame draws the same scene
+    Tuple muffin_bot_s = muffin_bot_scale;
+    Tuple muffin_bot_t = muffin_bot_xlate;
+    Tuple flower_t = flower_xlate;
+    Tuple flower_r = flower_rotation;
+    Tuple leaf_t = leaf_xlate;
+    Tuple leaf_r = leaf_rotation;
+
+    sphereLod.frame( eye, lookat, up, w_height );
+    coneLod.frame( eye, lookat, up, w_height );
+    cylinderLod.frame( eye, lookat, up, w_height );
+
 	//draw table
-	drawShape(tshader, OBJ_QUAD, quadBuffers, table_scale, table_rotation, table_xlate, eye, lookat, up);
+	queue.submit(tshader, &quadBuffers, OBJ_QUAD, table_scale, table_rotation, table_xlate);
 
     // draw apple
-    drawShape(pshader, MATL_APPLE, sphereBuffers, apple_scale, apple_rotation, apple_xlate, eye, lookat, up);
+    drawObject(sphereLod, MATL_APPLE, apple_scale, apple_rotation, apple_xlate);
 
 	// draw muffin
-	drawShape(pshader, MATL_MUFFIN, sphereBuffers, muffin_scale,muffin_rotation, muffin_xlate, eye, lookat, up);
-	drawShape(pshader, MATL_MUFFINCUP, cylinderBuffers, muffin_bot_scale, muffin_bot_rotation, muffin_bot_xlate, eye, lookat, up);
-	muffin_bot_scale = { 0.7,0.1,0.7 };
-	muffin_bot_xlate.y -= 0.1;
-	drawShape(pshader, MATL_CUP, cylinderBuffers, muffin_bot_scale, muffin_bot_rotation, muffin_bot_xlate, eye, lookat, up);
+	drawObject(sphereLod, MATL_MUFFIN, muffin_scale, muffin_rotation, muffin_xlate);
+	drawObject(cylinderLod, MATL_MUFFINCUP, muffin_bot_s, muffin_bot_rotation, muffin_bot_t);
+	muffin_bot_s = { 0.7,0.1,0.7 };
+	muffin_bot_t.y -= 0.1;
+	drawObject(cylinderLod, MATL_CUP, muffin_bot_s, muffin_bot_rotation, muffin_bot_t);
 
 	//draw flowers
-	drawShape(pshader, MATL_FLOWER, coneBuffers, flower_scale, flower_rotation, flower_xlate, eye, lookat, up);
-	flower_xlate.x += 0.5;
-	flower_xlate.y += 0.2;
-	flower_rotation.z += 25;
-	drawShape(pshader, MATL_FLOWER, coneBuffers, flower_scale, flower_rotation, flower_xlate, eye, lookat, up);
-	flower_xlate.x -= 0.8;
-	flower_xlate.z -= 0.2;
-	flower_rotation.z -= 65;
-	drawShape(pshader, MATL_FLOWER, coneBuffers, flower_scale, flower_rotation, flower_xlate, eye, lookat, up);
-	flower_xlate.x += 0.4;
-	flower_xlate.y += 0.2;
-	flower_xlate.z -= 0.3;
-	flower_rotation.z += 10;
-	drawShape(pshader, MATL_YELLOWFLOWER, coneBuffers, flower_scale, flower_rotation, flower_xlate, eye, lookat, up);
+	drawObject(coneLod, MATL_FLOWER, flower_scale, flower_r, flower_t);
+	flower_t.x += 0.5;
+	flower_t.y += 0.2;
+	flower_r.z += 25;
+	drawObject(coneLod, MATL_FLOWER, flower_scale, flower_r, flower_t);
+	flower_t.x -= 0.8;
+	flower_t.z -= 0.2;
+	flower_r.z -= 65;
+	drawObject(coneLod, MATL_FLOWER, flower_scale, flower_r, flower_t);
+	flower_t.x += 0.4;
+	flower_t.y += 0.2;
+	flower_t.z -= 0.3;
+	flower_r.z += 10;
+	drawObject(coneLod, MATL_YELLOWFLOWER, flower_scale, flower_r, flower_t);
 
 	//draw cup
-	drawShape(pshader, MATL_CUP, coneBuffers, cup_scale, cup_rotation, cup_xlate, eye, lookat, up);
-	drawShape(pshader, MATL_CUP, coneBuffers, cup_base_scale, cup_base_rotation, cup_base_xlate, eye, lookat, up);
+	drawObject(coneLod, MATL_CUP, cup_scale, cup_rotation, cup_xlate);
+	drawObject(coneLod, MATL_CUP, cup_base_scale, cup_base_rotation, cup_base_xlate);
 
 	//draw wood
-	drawShape(pshader, MATL_WOOD, cylinderBuffers, wood_scale, wood_rotation, wood_xlate, eye, lookat, up);
-	drawShape(pshader, MATL_CANDLE, cylinderBuffers, candle_scale, candle_rotation, candle_xlate, eye, lookat, up);
+	drawObject(cylinderLod, MATL_WOOD, wood_scale, wood_rotation, wood_xlate);
+	drawObject(cylinderLod, MATL_CANDLE, candle_scale, candle_rotation, candle_xlate);
 
 	//draw base base
-	drawShape(pshader, MATL_VASE, cylinderBuffers, vase_base_scale, vase_base_rotation, vase_base_xlate, eye, lookat, up);
+	drawObject(cylinderLod, MATL_VASE, vase_base_scale, vase_base_rotation, vase_base_xlate);
 	//draw vase mid
-	drawShape(pshader, MATL_VASE, sphereBuffers, vase_mid_scale, vase_mid_rotation, vase_mid_xlate, eye, lookat, up);
+	drawObject(sphereLod, MATL_VASE, vase_mid_scale, vase_mid_rotation, vase_mid_xlate);
 	//upper part vase
-	drawShape(pshader, MATL_VASE, coneBuffers, vase_top_scale, vase_top_rotation, vase_top_xlate, eye, lookat, up);
+	drawObject(coneLod, MATL_VASE, vase_top_scale, vase_top_rotation, vase_top_xlate);
     //draw the teapot
-	drawShape(pshader, OBJ_TEAPOT, teapotBuffers , teapot_scale, teapot_rotation, teapot_xlate, eye, lookat, up);
+	drawObject(teapotInstances, OBJ_TEAPOT, teapot_scale, teapot_rotation, teapot_xlate);
 	//draw leaf
-	drawShape(pshader, MATL_LEAF, cylinderBuffers, leaf_scale, leaf_rotation, leaf_xlate, eye, lookat, up);
-	leaf_xlate.x += 0.1;
-	leaf_xlate.y -= .2;
-	leaf_rotation.x -= 5;
-	leaf_rotation.z -= 40;
-	drawShape(pshader, MATL_LEAF, cylinderBuffers, leaf_scale, leaf_rotation, leaf_xlate, eye, lookat, up);
+	drawObject(cylinderLod, MATL_LEAF, leaf_scale, leaf_r, leaf_t);
+	leaf_t.x += 0.1;
+	leaf_t.y -= .2;
+	leaf_r.x -= 5;
+	leaf_r.z -= 40;
+	drawObject(cylinderLod, MATL_LEAF, leaf_scale, leaf_r, leaf_t);
+
+    // now draw everything that was collected
+    queue.submitInstances( ishader, &teapotInstances );
+    for( int i = 0; i < LOD_LEVELS; ++i ) {
+        queue.submitInstances( ishader, &sphereLod.instances[i] );
+        queue.submitInstances( ishader, &coneLod.instances[i] );
+        queue.submitInstances( ishader, &cylinderLod.instances[i] );
+    }
+
+    queue.flush( eye, lookat, up );
+
+    if( batching ) {
+        batcher.flush( bshader, eye, lookat, up );
+    }
+
+    if( instancing ) {
+        teapotInstances.clear();
+        sphereLod.clear();
+        coneLod.clear();
+        cylinderLod.clear();
+    }
+
+    lodStats = sphereLod.stats;
+    addLodStats( lodStats, coneLod.stats );
+    addLodStats( lodStats, cylinderLod.stats );
 }
 
+#if !defined(HEADLESS)
+
 ///
 // Event callback routines
 ///
@@ -313,6 +899,8 @@ void keyboard( GLFWwindow *window, int key, int scan, int action, int mods )
     //updateDisplay = true;
 }
 
+#endif
+
 ///
 // Animation routine
 ///
@@ -370,6 +958,155 @@ void animate( void ) {
     //}
 }
 
+#if defined(FINAL_BENCH)
+
+// final_bench supplies its own main program (see finalBench.cpp)
+
+#elif defined(HEADLESS)
+
+///
+// Main program for headless (offscreen) rendering
+//
+// Usage:  final [-n frames] [-w width] [-h height] [-o prefix] [-nodump]
+//               [-noinst] [-nocull] [-noring] [-noarena] [-noindirect]
+//               [-batch] [-nolod] [-noopt] [-quantize] [-meshcache dir]
+//               [-model file] [-threads n]
+//
+// Renders 'frames' frames into an offscreen framebuffer and writes
+// each one to prefixNNNN.ppm, unless -nodump is given.  -noinst draws
+// every object separately instead of using instanced draws, and
+// -nocull turns off view-frustum culling.  -noring puts per-frame data
+// in ordinary buffers and uniforms instead of a persistently mapped
+// ring buffer.  -noarena gives each mesh buffers of its own instead of
+// putting them all in one geometry arena.  -noindirect draws each
+// record or set of instances with its own call instead of writing
+// indirect commands for them.  -batch bakes the Phong-shaded objects
+// into static world-space batches.  -nolod draws every sphere, cone
+// and cylinder at its finest level of detail.  -noopt leaves each
+// mesh's triangles and vertices in the order they were generated.
+// -quantize gives each mesh buffers of its own (as -noarena does) with
+// quantized vertex data, and reports the error that introduces.
+// -meshcache loads the meshes from mesh files in 'dir', writing any
+// that aren't there yet.  -model draws the mesh in an OBJ or binary PLY
+// file in place of the teapot.  -threads sets the number of threads
+// used to prepare each frame's draws (and to import the model).
+///
+int main( int argc, char **argv ) {
+
+    int frames = 1;
+    const char *prefix = "frame";
+    bool dump = true;
+
+    for( int i = 1; i < argc; ++i ) {
+        if( !strcmp(argv[i], "-n") && i + 1 < argc ) {
+            frames = atoi( argv[++i] );
+        } else if( !strcmp(argv[i], "-w") && i + 1 < argc ) {
+            w_width = atoi( argv[++i] );
+        } else if( !strcmp(argv[i], "-h") && i + 1 < argc ) {
+            w_height = atoi( argv[++i] );
+        } else if( !strcmp(argv[i], "-o") && i + 1 < argc ) {
+            prefix = argv[++i];
+        } else if( !strcmp(argv[i], "-noinst") ) {
+            instancing = false;
+        } else if( !strcmp(argv[i], "-nocull") ) {
+            queue.culling = false;
+        } else if( !strcmp(argv[i], "-noring") ) {
+            useRing = false;
+        } else if( !strcmp(argv[i], "-noarena") ) {
+            useArena = false;
+        } else if( !strcmp(argv[i], "-noindirect") ) {
+            useIndirect = false;
+        } else if( !strcmp(argv[i], "-batch") ) {
+            batching = true;
+        } else if( !strcmp(argv[i], "-nolod") ) {
+            useLod = false;
+        } else if( !strcmp(argv[i], "-noopt") ) {
+            optimizeMeshes = false;
+        } else if( !strcmp(argv[i], "-quantize") ) {
+            quantize = true;
+        } else if( !strcmp(argv[i], "-meshcache") && i + 1 < argc ) {
+            meshCache = argv[++i];
+        } else if( !strcmp(argv[i], "-model") && i + 1 < argc ) {
+            modelFile = argv[++i];
+        } else if( !strcmp(argv[i], "-threads") && i + 1 < argc ) {
+            workers.resize( atoi(argv[++i]) );
+        } else if( !strcmp(argv[i], "-nodump") ) {
+            dump = false;
+        } else {
+            cerr << "usage: " << argv[0] << " [-n frames] [-w width]"
+                " [-h height] [-o prefix] [-nodump] [-noinst]"
+                " [-nocull] [-noring] [-noarena] [-noindirect]"
+                " [-batch] [-nolod] [-noopt] [-quantize]"
+                " [-meshcache dir] [-model file] [-threads n]" << endl;
+            exit( 1 );
+        }
+    }
+
+    if( frames < 1 || w_width < 1 || w_height < 1 ) {
+        cerr << "frame count and size must be positive" << endl;
+        exit( 1 );
+    }
+
+    if( !headlessInit(w_width, w_height) ) {
+        quit( 1 );
+    }
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    init();
+    cerr << "startup: init() took " << chrono::duration<double, milli>(
+        chrono::steady_clock::now() - start ).count() << " ms, " <<
+        meshMillis << " ms of it creating meshes (" << meshesLoaded <<
+        " loaded from the mesh cache)" << endl;
+
+    start = chrono::steady_clock::now();
+
+    for( int i = 0; i < frames; ++i ) {
+        animate();
+        stResetStats();
+        display();
+        if( dump ) {
+            char name[1024];
+            snprintf( name, sizeof(name), "%s%04d.ppm", prefix, i );
+            if( !headlessWriteFrame(name) ) {
+                quit( 1 );
+            }
+        } else {
+            glFinish();
+        }
+    }
+
+    double ms = chrono::duration<double, milli>(
+        chrono::steady_clock::now() - start ).count();
+
+    cerr << "headless: " << frames << " frames at " << w_width << "x" <<
+        w_height << " in " << ms << " ms (" << ms / frames <<
+        " ms/frame)" << endl;
+    cerr << "last frame: " << queue.stats.draws << " draws (" <<
+        queue.stats.commands << " indirect commands), " <<
+        queue.stats.programSwitches << " program switches, " <<
+        queue.stats.bufferBinds << " buffer binds, " <<
+        queue.stats.materialChanges << " material changes, " <<
+        queue.stats.culled << " culled, " <<
+        stateStats.issued << " state calls issued, " <<
+        stateStats.elided << " elided, " <<
+        stateStats.ignored << " ignored" << endl;
+    cerr << "level of detail: " << lodStats.objects << " objects, " <<
+        lodStats.fullTriangles << " triangles at full detail, " <<
+        lodStats.triangles << " drawn, " << lodStats.switches <<
+        " level changes" << endl;
+    if( batching ) {
+        cerr << "batches: " << batcher.size() << " batches, " <<
+            batcher.stats.draws << " drawn, " << batcher.stats.culled <<
+            " culled" << endl;
+    }
+
+    headlessFinish();
+
+    return 0;
+}
+
+#else
+
 ///
 // Error callback for GLFW
 ///
@@ -410,24 +1147,35 @@ int main( int argc, char **argv ) {
         exit( 1 );
     }
 
-    if( !GLEW_VERSION_3_0 ) {
-        cerr << "GLEW: OpenGL 3.0 not available" << endl;
-        if( !GLEW_VERSION_2_1 ) {
-            cerr << "GLEW: OpenGL 2.1 not available, either!" << endl;
-            glfwTerminate();
-            exit( 1 );
-        }
+    // the shaders are GLSL 1.40, with uniform blocks, and every mesh is
+    // drawn with a base vertex
+    if( !GLEW_VERSION_3_1 ) {
+        cerr << "GLEW: OpenGL 3.1 (GLSL 1.40, uniform buffers) "
+            "not available" << endl;
+        glfwTerminate();
+        exit( 1 );
+    }
+    if( !GLEW_VERSION_3_2 && !GLEW_ARB_draw_elements_base_vertex ) {
+        cerr << "GLEW: OpenGL 3.2 (or ARB_draw_elements_base_vertex) "
+            "not available" << endl;
+        glfwTerminate();
+        exit( 1 );
     }
 #endif
 
-    // determine whether or not we can use GLSL 1.30
     int maj = glfwGetWindowAttrib( window, GLFW_CONTEXT_VERSION_MAJOR );
     int min = glfwGetWindowAttrib( window, GLFW_CONTEXT_VERSION_MINOR );
 
     cerr << "GLFW: using " << maj << "." << min << " context" << endl;
-    if( maj < 3 ) {
-        cerr << "*** GLSL 1.30 shaders may not compile" << endl;
+#ifdef __APPLE__
+    // no GLEW to ask about extensions; a core 3.2 context has it all
+    if( maj < 3 || (maj == 3 && min < 2) ) {
+        cerr << "*** OpenGL 3.2 is needed for GLSL 1.40 shaders and "
+            "base vertex draws" << endl;
+        glfwTerminate();
+        exit( 1 );
     }
+#endif
 
     init();
 
@@ -448,3 +1196,5 @@ int main( int argc, char **argv ) {
 
     return 0;
 }
+
+#endif
@@ -28,6 +28,13 @@ CCLDLIBS =
 # common compiler flags
 COMMONFLAGS = -g $(INCLUDE) -DGL_GLEXT_PROTOTYPES
 
+# for headless (offscreen) rendering on machines without a display,
+# use these instead; the program then renders through EGL into a
+# framebuffer object and needs neither GLFW nor GLEW.  NO_SOIL loads
+# the table texture with libjpeg instead of SOIL.
+# COMMONFLAGS = -g $(INCLUDE) -DGL_GLEXT_PROTOTYPES -DHEADLESS -DNO_SOIL
+# LDLIBS = -lEGL -lOpenGL -ljpeg -lm
+
 # language-specific compiler flags
 CFLAGS = -std=c99 $(COMMONFLAGS)
 CXXFLAGS = $(COMMONFLAGS)
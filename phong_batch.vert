@@ -0,0 +1,45 @@
+#version 140
+
+//
+// Phong vertex shader for static batches
+//
+// Vertices arrive already in world space, each with its object's
+// material id, so only the camera and projection are needed.  The
+// material id is passed on to phong_inst.frag.
+//
+
+// INCOMING DATA
+
+// Vertex location (in world space)
+in vec3 vPosition;
+// Normal vector at vertex (in world space)
+in vec3 vNormal;
+// Material id of the vertex's object
+in int vMaterial;
+
+// Camera and projection
+uniform mat4 viewMat;
+uniform mat4 projMat;
+
+// OUTGOING DATA
+out vec3 vPosition_out;
+out vec3 vNormal_out;
+flat out int material;
+
+///
+// Main function
+///
+
+void main()
+{
+    vec4 eyePosition = viewMat * vec4( vPosition, 1.0 );
+
+    // Transform the vertex location into clip space
+    gl_Position = projMat * eyePosition;
+
+    // the view matrix is a rigid motion, so its upper 3x3 is its own
+    // inverse transpose
+    vPosition_out = vec3( eyePosition );
+    vNormal_out = mat3( viewMat ) * vNormal;
+    material = vMaterial;
+}
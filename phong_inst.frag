@@ -0,0 +1,56 @@
+#version 140
+
+//
+// Phong fragment shader for instanced drawing
+//
+// The same as phong_mat.frag, except that the material id comes from
+// phong_inst.vert rather than from a uniform.
+//
+
+// INCOMING DATA
+in vec3 vPosition_out;
+in vec3 vNormal_out;
+flat in int material;
+
+// One entry of the material table; k holds ka, kd, ks and the
+// specular exponent
+struct MaterialData {
+    vec4 Oa;
+    vec4 Od;
+    vec4 Os;
+    vec4 k;
+};
+
+// N_MATERIALS entries (see Lighting.h)
+layout(std140) uniform Materials {
+    MaterialData materials[256];
+};
+
+layout(std140) uniform Light {
+    vec4 light_color;
+    vec4 light_ambient;
+    vec4 light_position_eye;
+};
+
+// OUTGOING DATA
+out vec4 finalColor;
+
+///
+// Main function
+///
+void main()
+{
+    MaterialData m = materials[material];
+
+    vec3 vNormal = normalize( vNormal_out );
+    vec3 vertex_2_light = normalize( light_position_eye.xyz - vPosition_out );
+    vec3 vertex_2_camera = -normalize( vPosition_out );
+
+    vec4 ambient = light_ambient * m.Oa * m.k.x;
+    vec4 diffuse = m.Od * m.k.y * max( dot(vNormal, vertex_2_light), 0 );
+    vec3 R = reflect( -vertex_2_light, vNormal );
+    vec4 specular = m.Os * m.k.z *
+        pow( max(dot(R, vertex_2_camera), 0), m.k.w );
+
+    finalColor = ambient + diffuse + specular;
+}
@@ -0,0 +1,47 @@
+#version 140
+
+//
+// Phong vertex shader for instanced drawing
+//
+// Each instance supplies its own model and normal matrices (in world
+// space) and a material id, which is passed on to phong_inst.frag.
+//
+
+// INCOMING DATA
+
+// Vertex location (in model space)
+in vec4 vPosition;
+// Normal vector at vertex (in model space)
+in vec3 vNormal;
+
+// Per-instance data
+in mat4 iModel;
+in mat3 iNormal;
+in int iMaterial;
+
+// Camera and projection
+uniform mat4 viewMat;
+uniform mat4 projMat;
+
+// OUTGOING DATA
+out vec3 vPosition_out;
+out vec3 vNormal_out;
+flat out int material;
+
+///
+// Main function
+///
+
+void main()
+{
+    vec4 eyePosition = viewMat * (iModel * vPosition);
+
+    // Transform the vertex location into clip space
+    gl_Position = projMat * eyePosition;
+
+    // the view matrix is a rigid motion, so its upper 3x3 is its own
+    // inverse transpose
+    vPosition_out = vec3( eyePosition );
+    vNormal_out = mat3( viewMat ) * (iNormal * vNormal);
+    material = iMaterial;
+}
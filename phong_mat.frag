@@ -0,0 +1,59 @@
+#version 140
+
+//
+// Phong fragment shader using the Materials and Light blocks
+//
+// The same lighting as phong.frag.  The material is chosen by id from
+// the Materials block, and the light comes from the Light block; both
+// blocks are set up once by initMaterials() (see Lighting.cpp).
+//
+
+// INCOMING DATA
+in vec3 vPosition_out;
+in vec3 vNormal_out;
+
+// One entry of the material table; k holds ka, kd, ks and the
+// specular exponent
+struct MaterialData {
+    vec4 Oa;
+    vec4 Od;
+    vec4 Os;
+    vec4 k;
+};
+
+// N_MATERIALS entries (see Lighting.h)
+layout(std140) uniform Materials {
+    MaterialData materials[256];
+};
+
+layout(std140) uniform Light {
+    vec4 light_color;
+    vec4 light_ambient;
+    vec4 light_position_eye;
+};
+
+// which material to use
+uniform int material;
+
+// OUTGOING DATA
+out vec4 finalColor;
+
+///
+// Main function
+///
+void main()
+{
+    MaterialData m = materials[material];
+
+    vec3 vNormal = normalize( vNormal_out );
+    vec3 vertex_2_light = normalize( light_position_eye.xyz - vPosition_out );
+    vec3 vertex_2_camera = -normalize( vPosition_out );
+
+    vec4 ambient = light_ambient * m.Oa * m.k.x;
+    vec4 diffuse = m.Od * m.k.y * max( dot(vNormal, vertex_2_light), 0 );
+    vec3 R = reflect( -vertex_2_light, vNormal );
+    vec4 specular = m.Os * m.k.z *
+        pow( max(dot(R, vertex_2_camera), 0), m.k.w );
+
+    finalColor = ambient + diffuse + specular;
+}
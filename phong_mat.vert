@@ -0,0 +1,41 @@
+#version 140
+
+//
+// Phong vertex shader, using matrices computed by the application
+//
+// Used with phong_mat.frag.  The model-view, projection, and normal
+// matrices are computed once per draw on the CPU (see Viewing.cpp),
+// where phong.vert builds them for every vertex.
+//
+
+// INCOMING DATA
+
+// Vertex location (in model space)
+in vec4 vPosition;
+// Normal vector at vertex (in model space)
+in vec3 vNormal;
+
+// Transformations
+uniform mat4 modelViewMat;
+uniform mat4 projMat;
+uniform mat3 normalMat;
+
+// OUTGOING DATA
+out vec3 vPosition_out;
+out vec3 vNormal_out;
+
+///
+// Main function
+///
+
+void main()
+{
+    vec4 eyePosition = modelViewMat * vPosition;
+
+    // Transform the vertex location into clip space
+    gl_Position = projMat * eyePosition;
+
+    // lighting is done in eye space, in the fragment shader
+    vPosition_out = vec3( eyePosition );
+    vNormal_out = normalMat * vNormal;
+}
@@ -0,0 +1,54 @@
+#version 130
+
+//
+// Texture mapping vertex shader, using matrices computed by the
+// application
+//
+// Produces the same outputs as texture.vert, but the model-view,
+// projection, and normal matrices and the eye-space light position
+// are computed once per draw on the CPU (see Viewing.cpp) instead of
+// once per vertex here.
+//
+
+// INCOMING DATA
+
+// Vertex location (in model space)
+in vec4 vPosition;
+
+// Normal vector at vertex (in model space)
+in vec3 vNormal;
+
+// Texture coordinate for this vertex
+in vec2 vTexCoord;
+
+// Transformations
+uniform mat4 modelViewMat;
+uniform mat4 projMat;
+uniform mat3 normalMat;
+
+// Light position (in eye space)
+uniform vec3 light_position_eye;
+
+// OUTGOING DATA
+out vec3 vPosition_out;
+out vec3 vNormal_out;
+out vec3 light_position_out;
+out vec2 texCoord;
+
+///
+// Main function
+///
+
+void main()
+{
+    vec4 eyePosition = modelViewMat * vPosition;
+
+    // Transform the vertex location into clip space
+    gl_Position = projMat * eyePosition;
+
+    // lighting is done in eye space, in the fragment shader
+    light_position_out = light_position_eye;
+    vPosition_out = vec3( eyePosition );
+    vNormal_out = normalMat * vNormal;
+    texCoord = vTexCoord;
+}